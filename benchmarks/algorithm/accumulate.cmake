@@ -0,0 +1,2 @@
+# accumulate benchmark driver
+JCLIB_ADD_BENCHMARK("accumulate" "${CMAKE_CURRENT_LIST_DIR}/accumulate.cpp")
@@ -0,0 +1,53 @@
+#include <jclib/algorithm.h>
+#include <jclib/execution.h>
+#include <jclib-bench.hpp>
+
+#include <string>
+#include <vector>
+#include <numeric>
+#include <cstdint>
+
+/*
+	Compares std::accumulate against jc::accumulate over cache resident arrays, and the
+	reassociating jc::reduce(unseq) for floating point sums.
+*/
+
+template <typename T>
+void bench_accumulate(const char* _name, size_t _count, size_t _iterations)
+{
+	std::vector<T> _data(_count);
+	for (size_t n = 0; n != _count; ++n)
+	{
+		_data[n] = static_cast<T>(n & 0x7F);
+	};
+	const size_t _bytes = _count * sizeof(T);
+
+	jcbench::run_throughput(std::string("std::accumulate ") + _name, _iterations, _bytes, [&]()
+	{
+		auto _sum = std::accumulate(_data.begin(), _data.end(), T{});
+		jcbench::do_not_optimize(_sum);
+	});
+	jcbench::run_throughput(std::string("jc::accumulate ") + _name, _iterations, _bytes, [&]()
+	{
+		auto _sum = jc::accumulate(_data);
+		jcbench::do_not_optimize(_sum);
+	});
+	jcbench::run_throughput(std::string("jc::reduce (unseq) ") + _name, _iterations, _bytes, [&]()
+	{
+		auto _sum = jc::reduce(jc::execution::unseq, _data);
+		jcbench::do_not_optimize(_sum);
+	});
+};
+
+int main()
+{
+	const size_t _count = size_t(1) << 14;
+	const size_t _iterations = 20000;
+
+	bench_accumulate<int32_t>("int32", _count, _iterations);
+	bench_accumulate<uint64_t>("uint64", _count, _iterations);
+	bench_accumulate<float>("float", _count, _iterations);
+	bench_accumulate<double>("double", _count, _iterations);
+
+	return 0;
+};
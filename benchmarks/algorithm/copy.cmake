@@ -0,0 +1,2 @@
+# copy benchmark driver
+JCLIB_ADD_BENCHMARK("copy" "${CMAKE_CURRENT_LIST_DIR}/copy.cpp")
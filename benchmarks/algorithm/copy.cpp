@@ -0,0 +1,62 @@
+#include <jclib/algorithm.h>
+#include <jclib/span.h>
+#include <jclib-bench.hpp>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+/*
+	Compares std::copy/std::fill through span iterators against jc::copy/jc::fill, and the non-temporal variants on a
+	buffer much larger than the cache.
+*/
+
+void bench_span(const char* _name, size_t _count, size_t _iterations)
+{
+	std::vector<uint32_t> _source(_count, 7);
+	std::vector<uint32_t> _dest(_count);
+	const auto _from = jc::span<const uint32_t>{ _source.data(), _source.size() };
+	auto _to = jc::span<uint32_t>{ _dest.data(), _dest.size() };
+
+	const size_t _bytes = _count * sizeof(uint32_t);
+
+	jcbench::run_throughput(std::string("std::copy (span) ") + _name, _iterations, _bytes, [&]()
+	{
+		std::copy(_from.begin(), _from.end(), _to.begin());
+		jcbench::do_not_optimize(_dest);
+	});
+	jcbench::run_throughput(std::string("jc::copy (span) ") + _name, _iterations, _bytes, [&]()
+	{
+		jc::copy(_from, _to.begin());
+		jcbench::do_not_optimize(_dest);
+	});
+	jcbench::run_throughput(std::string("jc::copy_nontemporal (span) ") + _name, _iterations, _bytes, [&]()
+	{
+		jc::copy_nontemporal(_from, _to.begin());
+		jcbench::do_not_optimize(_dest);
+	});
+	jcbench::run_throughput(std::string("std::fill (span) ") + _name, _iterations, _bytes, [&]()
+	{
+		std::fill(_to.begin(), _to.end(), 0u);
+		jcbench::do_not_optimize(_dest);
+	});
+	jcbench::run_throughput(std::string("jc::fill (span) ") + _name, _iterations, _bytes, [&]()
+	{
+		jc::fill(_to, 0u);
+		jcbench::do_not_optimize(_dest);
+	});
+	jcbench::run_throughput(std::string("jc::fill_nontemporal (span) ") + _name, _iterations, _bytes, [&]()
+	{
+		jc::fill_nontemporal(_to, 0x01020304u);
+		jcbench::do_not_optimize(_dest);
+	});
+};
+
+int main()
+{
+	bench_span("16 KiB", size_t(1) << 12, 50000);
+	bench_span("256 MiB", size_t(1) << 26, 10);
+
+	return 0;
+};
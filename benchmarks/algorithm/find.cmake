@@ -0,0 +1,2 @@
+# find benchmark driver
+JCLIB_ADD_BENCHMARK("find" "${CMAKE_CURRENT_LIST_DIR}/find.cpp")
@@ -0,0 +1,94 @@
+#include <jclib/algorithm.h>
+#include <jclib/execution.h>
+#include <jclib-bench.hpp>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+/*
+	Compares jc::find against std::find over contiguous ranges of integers, the searched value is placed in the
+	last element so the whole range is scanned.
+
+	Also compares std::find_if against the parallel jc::find_if using a predicate that does some work per element,
+	with the only match a quarter of the way through the range.
+*/
+
+// Roughly 4GB scanned per run
+size_t iterations_for(size_t _bytes)
+{
+	const size_t _total = size_t(1) << 32;
+	return std::max<size_t>(_total / _bytes, 100);
+};
+
+template <typename T>
+void bench_find(const std::string& _typeName, size_t _length)
+{
+	std::vector<T> _data(_length, T(1));
+	_data.back() = T(2);
+	const T _key = T(2);
+
+	const auto _bytes = _length * sizeof(T);
+	const auto _iterations = iterations_for(_bytes);
+	const auto _suffix = " (" + _typeName + ", " + std::to_string(_length) + " elements)";
+
+	jcbench::run_throughput("std::find" + _suffix, _iterations, _bytes, [&]()
+	{
+		auto _it = std::find(_data.begin(), _data.end(), _key);
+		jcbench::do_not_optimize(_it);
+	});
+	jcbench::run_throughput("jc::find" + _suffix, _iterations, _bytes, [&]()
+	{
+		auto _it = jc::find(_data, _key);
+		jcbench::do_not_optimize(_it);
+	});
+};
+
+// Mixes the bits of a value a few times, stands in for a predicate that does some work per element
+uint64_t mix(uint64_t _value) noexcept
+{
+	for (int n = 0; n != 16; ++n)
+	{
+		_value ^= _value >> 31;
+		_value *= 0x9E3779B97F4A7C15ull;
+	};
+	return _value;
+};
+
+void bench_find_if(size_t _length)
+{
+	std::vector<uint64_t> _data(_length);
+	for (size_t n = 0; n != _length; ++n)
+	{
+		_data[n] = n;
+	};
+
+	const uint64_t _key = mix(_data[_length / 4]);
+	const auto _pred = [_key](uint64_t v) { return mix(v) == _key; };
+
+	const auto _suffix = " (" + std::to_string(_length) + " elements)";
+	jcbench::run("std::find_if" + _suffix, 20, [&]()
+	{
+		auto _it = std::find_if(_data.begin(), _data.end(), _pred);
+		jcbench::do_not_optimize(_it);
+	});
+	jcbench::run("jc::find_if par" + _suffix, 20, [&]()
+	{
+		auto _it = jc::find_if(jc::execution::par, _data, _pred);
+		jcbench::do_not_optimize(_it);
+	});
+};
+
+int main()
+{
+	for (size_t _length : { 16, 256, 4096, 65536 })
+	{
+		bench_find<uint8_t>("uint8_t", _length);
+		bench_find<uint16_t>("uint16_t", _length);
+		bench_find<uint32_t>("uint32_t", _length);
+		bench_find<uint64_t>("uint64_t", _length);
+	};
+	bench_find_if(size_t(1) << 22);
+	return 0;
+};
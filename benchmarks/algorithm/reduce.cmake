@@ -0,0 +1,2 @@
+# reduce benchmark driver
+JCLIB_ADD_BENCHMARK("reduce" "${CMAKE_CURRENT_LIST_DIR}/reduce.cpp")
@@ -0,0 +1,47 @@
+#include <jclib/algorithm.h>
+#include <jclib/execution.h>
+#include <jclib-bench.hpp>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/*
+	Compares jc::accumulate against jc::reduce with each execution policy over a large array.
+*/
+
+int main()
+{
+	const size_t _count = size_t(1) << 26;
+	std::vector<uint64_t> _data(_count);
+	for (size_t n = 0; n != _count; ++n)
+	{
+		_data[n] = n & 0xFF;
+	};
+
+	const size_t _bytes = _count * sizeof(uint64_t);
+	const size_t _iterations = 20;
+
+	jcbench::run_throughput("jc::accumulate", _iterations, _bytes, [&]()
+	{
+		auto _sum = jc::accumulate(_data);
+		jcbench::do_not_optimize(_sum);
+	});
+	jcbench::run_throughput("jc::reduce (seq)", _iterations, _bytes, [&]()
+	{
+		auto _sum = jc::reduce(jc::execution::seq, _data);
+		jcbench::do_not_optimize(_sum);
+	});
+	jcbench::run_throughput("jc::reduce (par)", _iterations, _bytes, [&]()
+	{
+		auto _sum = jc::reduce(jc::execution::par, _data);
+		jcbench::do_not_optimize(_sum);
+	});
+	jcbench::run_throughput("jc::transform_reduce (par)", _iterations, _bytes, [&]()
+	{
+		auto _sum = jc::transform_reduce(jc::execution::par, _data, [](uint64_t v) { return v * v; });
+		jcbench::do_not_optimize(_sum);
+	});
+
+	return 0;
+};
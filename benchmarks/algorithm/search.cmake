@@ -0,0 +1,2 @@
+# search benchmark driver
+JCLIB_ADD_BENCHMARK("search" "${CMAKE_CURRENT_LIST_DIR}/search.cpp")
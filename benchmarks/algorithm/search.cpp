@@ -0,0 +1,76 @@
+#include <jclib/algorithm.h>
+#include <jclib/span.h>
+#include <jclib/eytzinger_set.h>
+#include <jclib-bench.hpp>
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+
+/*
+	Compares std::lower_bound against jc::lower_bound, jc::lower_bound_batch and jc::eytzinger_set for random queries
+	into sorted tables that fit in cache and tables that don't.
+*/
+
+void bench_search(const char* _name, size_t _count, size_t _queryCount, size_t _iterations)
+{
+	std::vector<uint64_t> _table(_count);
+	for (size_t n = 0; n != _count; ++n)
+	{
+		_table[n] = n * 2;
+	};
+
+	std::mt19937_64 _random{ 7 };
+	std::vector<uint64_t> _queries(_queryCount);
+	for (auto& v : _queries)
+	{
+		v = _random() % (_count * 2);
+	};
+
+	std::vector<const uint64_t*> _results(_queryCount);
+	const auto _table_span = jc::span<const uint64_t>{ _table.data(), _table.size() };
+	const auto _query_span = jc::span<const uint64_t>{ _queries.data(), _queries.size() };
+
+	jcbench::run(std::string("std::lower_bound ") + _name, _iterations, [&]()
+	{
+		for (size_t n = 0; n != _queryCount; ++n)
+		{
+			_results[n] = &*std::lower_bound(_table.data(), _table.data() + _count, _queries[n]);
+		};
+		jcbench::do_not_optimize(_results);
+	});
+	jcbench::run(std::string("jc::lower_bound ") + _name, _iterations, [&]()
+	{
+		for (size_t n = 0; n != _queryCount; ++n)
+		{
+			_results[n] = jc::lower_bound(_table, _queries[n]).operator->();
+		};
+		jcbench::do_not_optimize(_results);
+	});
+	jcbench::run(std::string("jc::lower_bound_batch ") + _name, _iterations, [&]()
+	{
+		std::vector<jc::impl::span_iterator<const uint64_t>> _out(_queryCount);
+		jc::lower_bound_batch(_table_span, _query_span, _out.begin());
+		jcbench::do_not_optimize(_out);
+	});
+
+	const jc::eytzinger_set<uint64_t> _eytzinger{ jc::sorted_unique, _table };
+	jcbench::run(std::string("jc::eytzinger_set::lower_bound ") + _name, _iterations, [&]()
+	{
+		for (size_t n = 0; n != _queryCount; ++n)
+		{
+			_results[n] = _eytzinger.lower_bound(_queries[n]).operator->();
+		};
+		jcbench::do_not_optimize(_results);
+	});
+};
+
+int main()
+{
+	bench_search("16 KiB table, 1M queries", size_t(1) << 11, size_t(1) << 20, 5);
+	bench_search("512 MiB table, 1M queries", size_t(1) << 26, size_t(1) << 20, 5);
+
+	return 0;
+};
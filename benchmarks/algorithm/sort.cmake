@@ -0,0 +1,2 @@
+# sort benchmark driver
+JCLIB_ADD_BENCHMARK("sort" "${CMAKE_CURRENT_LIST_DIR}/sort.cpp")
@@ -0,0 +1,52 @@
+#include <jclib/algorithm.h>
+#include <jclib/execution.h>
+#include <jclib-bench.hpp>
+
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cstdint>
+
+/*
+	Compares std::sort against jc::sort, the parallel merge sort and radix sort over random 64-bit keys.
+*/
+
+template <typename T>
+void bench_sort(const char* _name, size_t _count, size_t _iterations)
+{
+	std::vector<T> _source(_count);
+	std::mt19937_64 _random{ 42 };
+	for (auto& v : _source)
+	{
+		v = static_cast<T>(_random());
+	};
+
+	std::vector<T> _data{};
+	const size_t _bytes = _count * sizeof(T);
+
+	const auto _bench = [&](const std::string& _label, auto&& _op)
+	{
+		jcbench::run_throughput(_label + " " + _name, _iterations, _bytes, [&]()
+		{
+			_data = _source;
+			_op();
+			jcbench::do_not_optimize(_data);
+		});
+	};
+
+	_bench("copy only", [&]() {});
+	_bench("std::sort", [&]() { std::sort(_data.begin(), _data.end()); });
+	_bench("jc::sort (par)", [&]() { jc::sort(jc::execution::par, _data); });
+	_bench("jc::radix_sort", [&]() { jc::radix_sort(_data); });
+	_bench("jc::radix_sort (par)", [&]() { jc::radix_sort(jc::execution::par, _data); });
+};
+
+int main()
+{
+	bench_sort<uint64_t>("uint64 x 16M", size_t(1) << 24, 3);
+	bench_sort<uint32_t>("uint32 x 1M", size_t(1) << 20, 20);
+	bench_sort<double>("double x 1M", size_t(1) << 20, 20);
+
+	return 0;
+};
@@ -0,0 +1,2 @@
+# flat_hash_map benchmark driver
+JCLIB_ADD_BENCHMARK("flat_hash_map" "${CMAKE_CURRENT_LIST_DIR}/flat_hash_map.cpp")
@@ -0,0 +1,126 @@
+#include <jclib/flat_hash_map.h>
+#include <jclib/functional.h>
+#include <jclib-bench.hpp>
+
+#include <unordered_map>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdint>
+
+/*
+	Compares jc::flat_hash_map against std::unordered_map for insert, successful find, failed find and erase.
+	Times are reported per operation.
+*/
+
+constexpr size_t element_count = 1 << 18;
+constexpr size_t pass_count = 10;
+
+template <typename KeyT>
+std::vector<KeyT> make_keys(size_t _count, uint64_t _seed);
+
+template <>
+std::vector<uint64_t> make_keys<uint64_t>(size_t _count, uint64_t _seed)
+{
+	std::mt19937_64 _rng{ _seed };
+	std::vector<uint64_t> _keys(_count);
+	for (auto& v : _keys)
+	{
+		v = _rng();
+	};
+	return _keys;
+};
+
+template <>
+std::vector<std::string> make_keys<std::string>(size_t _count, uint64_t _seed)
+{
+	std::mt19937_64 _rng{ _seed };
+	std::vector<std::string> _keys(_count);
+	for (auto& v : _keys)
+	{
+		v = "key_" + std::to_string(_rng());
+	};
+	return _keys;
+};
+
+// Reports a time measured over whole passes as the time per operation
+void report_per_op(std::string _name, double _nanosecondsPerPass)
+{
+	jcbench::report(jcbench::result{ std::move(_name), element_count * pass_count, _nanosecondsPerPass / element_count });
+};
+
+template <typename MapT, typename KeyT>
+void bench_map(const std::string& _name, const std::vector<KeyT>& _keys, const std::vector<KeyT>& _missing)
+{
+	report_per_op(_name + " insert", jcbench::time(pass_count, [&]()
+	{
+		MapT _map{};
+		for (auto& k : _keys)
+		{
+			_map.insert({ k, 1 });
+		};
+		jcbench::do_not_optimize(_map);
+	}));
+
+	MapT _map{};
+	for (auto& k : _keys)
+	{
+		_map.insert({ k, 1 });
+	};
+
+	report_per_op(_name + " find-hit", jcbench::time(pass_count, [&]()
+	{
+		size_t _found = 0;
+		for (auto& k : _keys)
+		{
+			_found += (_map.find(k) != _map.end()) ? 1 : 0;
+		};
+		jcbench::do_not_optimize(_found);
+	}));
+
+	report_per_op(_name + " find-miss", jcbench::time(pass_count, [&]()
+	{
+		size_t _found = 0;
+		for (auto& k : _missing)
+		{
+			_found += (_map.find(k) != _map.end()) ? 1 : 0;
+		};
+		jcbench::do_not_optimize(_found);
+	}));
+
+	// Erase needs a full map every pass, only time the erasing
+	using clock = std::chrono::steady_clock;
+	clock::duration _elapsed{};
+	for (size_t n = 0; n != pass_count; ++n)
+	{
+		MapT _full = _map;
+		const auto _start = clock::now();
+		for (auto& k : _keys)
+		{
+			_full.erase(k);
+		};
+		_elapsed += clock::now() - _start;
+		jcbench::do_not_optimize(_full);
+	};
+	const auto _erase = std::chrono::duration_cast<std::chrono::nanoseconds>(_elapsed).count();
+	report_per_op(_name + " erase", static_cast<double>(_erase) / pass_count);
+};
+
+template <typename KeyT>
+void bench_key(const std::string& _keyName)
+{
+	const auto _keys = make_keys<KeyT>(element_count, 1);
+	const auto _missing = make_keys<KeyT>(element_count, 2);
+
+	bench_map<std::unordered_map<KeyT, int>>("std::unordered_map<" + _keyName + ">", _keys, _missing);
+	bench_map<std::unordered_map<KeyT, int, jc::hash_t>>("std::unordered_map<" + _keyName + ", jc::hash_t>", _keys, _missing);
+	bench_map<jc::flat_hash_map<KeyT, int>>("jc::flat_hash_map<" + _keyName + ">", _keys, _missing);
+};
+
+int main()
+{
+	bench_key<uint64_t>("uint64_t");
+	bench_key<std::string>("std::string");
+	return 0;
+};
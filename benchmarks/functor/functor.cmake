@@ -0,0 +1,2 @@
+# functor benchmark driver
+JCLIB_ADD_BENCHMARK("functor" "${CMAKE_CURRENT_LIST_DIR}/functor.cpp")
@@ -0,0 +1,76 @@
+#include <jclib/functor.h>
+#include <jclib-bench.hpp>
+
+#include <functional>
+
+/*
+	Compares the cost of invoking through jc::functor and jc::function_ref against std::function
+	and a raw function pointer.
+*/
+
+constexpr size_t iterations = 100000000;
+
+int add(int _a, int _b)
+{
+	return _a + _b;
+};
+
+struct adder
+{
+	int add(int _a, int _b)
+	{
+		return _a + _b + this->offset;
+	};
+	int offset = 1;
+};
+
+template <typename FunctionT>
+void bench_call(const char* _name, FunctionT& _function)
+{
+	int _value = 0;
+	jcbench::run(_name, iterations, [&]()
+	{
+		jcbench::do_not_optimize(_function);
+		_value = _function(_value, 1);
+		jcbench::do_not_optimize(_value);
+	});
+};
+
+int main()
+{
+	{
+		auto _raw = &add;
+		std::function<int(int, int)> _std = &add;
+		jc::functor<int(int, int)> _jc = &add;
+		jc::function_ref<int(int, int)> _ref = &add;
+
+		bench_call("free function : raw pointer", _raw);
+		bench_call("free function : std::function", _std);
+		bench_call("free function : jc::functor", _jc);
+		bench_call("free function : jc::function_ref", _ref);
+	};
+
+	{
+		int _offset = 1;
+		auto _lambda = [_offset](int _a, int _b) { return _a + _b + _offset; };
+
+		std::function<int(int, int)> _std = _lambda;
+		jc::functor<int(int, int)> _jc = _lambda;
+		jc::function_ref<int(int, int)> _ref = _lambda;
+
+		bench_call("lambda : std::function", _std);
+		bench_call("lambda : jc::functor", _jc);
+		bench_call("lambda : jc::function_ref", _ref);
+	};
+
+	{
+		adder _adder{};
+		std::function<int(int, int)> _std = std::bind(&adder::add, &_adder, std::placeholders::_1, std::placeholders::_2);
+		jc::functor<int(int, int)> _jc{ &adder::add, &_adder };
+
+		bench_call("member function : std::function", _std);
+		bench_call("member function : jc::functor", _jc);
+	};
+
+	return 0;
+};
@@ -0,0 +1,2 @@
+# hash benchmark driver
+JCLIB_ADD_BENCHMARK("hash" "${CMAKE_CURRENT_LIST_DIR}/hash.cpp")
@@ -0,0 +1,73 @@
+#include <jclib/hash.h>
+#include <jclib/functional.h>
+#include <jclib-bench.hpp>
+
+#include <string>
+#include <string_view>
+#include <functional>
+#include <cstdint>
+#include <algorithm>
+
+/*
+	Compares jc::hash against std::hash for byte strings of several lengths and for integers.
+*/
+
+// Roughly 1GB hashed per run
+size_t iterations_for(size_t _bytes)
+{
+	const size_t _total = size_t(1) << 30;
+	return std::max<size_t>(_total / std::max<size_t>(_bytes, 16), 1000);
+};
+
+void bench_length(size_t _length)
+{
+	std::string _key(_length, '\0');
+	for (size_t n = 0; n != _length; ++n)
+	{
+		_key[n] = static_cast<char>('a' + (n * 7) % 26);
+	};
+	const std::string_view _view{ _key };
+	const auto _iterations = iterations_for(_length);
+
+	const auto _suffix = " (" + std::to_string(_length) + " bytes)";
+
+	jcbench::run_throughput("std::hash<std::string_view>" + _suffix, _iterations, _length, [&]()
+	{
+		auto _hash = std::hash<std::string_view>{}(_view);
+		jcbench::do_not_optimize(_hash);
+	});
+	jcbench::run_throughput("jc::hash" + _suffix, _iterations, _length, [&]()
+	{
+		auto _hash = jc::hash(_view);
+		jcbench::do_not_optimize(_hash);
+	});
+	jcbench::run_throughput("jc::seeded_hash_t" + _suffix, _iterations, _length, [&, _hasher = jc::seeded_hash_t{ 0x1234 }]()
+	{
+		auto _hash = _hasher(_view);
+		jcbench::do_not_optimize(_hash);
+	});
+};
+
+int main()
+{
+	for (size_t _length : { 4, 8, 16, 32, 64, 256, 1024, 65536 })
+	{
+		bench_length(_length);
+	};
+
+	{
+		uint64_t _value = 0;
+		jcbench::run("std::hash<uint64_t>", 100000000, [&]()
+		{
+			_value = std::hash<uint64_t>{}(_value + 1);
+			jcbench::do_not_optimize(_value);
+		});
+		jcbench::run("jc::hash (uint64_t)", 100000000, [&]()
+		{
+			_value = jc::hash(_value + 1);
+			jcbench::do_not_optimize(_value);
+		});
+	};
+
+	return 0;
+};
@@ -0,0 +1,140 @@
+#pragma once
+#ifndef JCLIB_BENCH_HPP
+#define JCLIB_BENCH_HPP
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	Benchmark support header
+*/
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+namespace jcbench
+{
+	/**
+	 * @brief Prevents the compiler from optimizing away a value
+	 * @param _value Value to keep alive
+	*/
+	template <typename T>
+	inline void do_not_optimize(T& _value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(_value) : "memory");
+#else
+		static volatile const void* _sink = nullptr;
+		_sink = &_value;
+#endif
+	};
+
+	/**
+	 * @brief Prevents the compiler from reordering memory accesses across this point
+	*/
+	inline void clobber_memory()
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : : "memory");
+#endif
+	};
+
+	/**
+	 * @brief Result of a single benchmark run
+	*/
+	struct result
+	{
+		std::string name;
+		size_t iterations;
+		double nanoseconds_per_iteration;
+
+		// Bytes processed per iteration, 0 if not measuring throughput
+		size_t bytes_per_iteration = 0;
+	};
+
+	/**
+	 * @brief Prints a benchmark result to the output log
+	*/
+	inline void report(const result& _result)
+	{
+		std::cout << std::left << std::setw(48) << _result.name << ' '
+			<< std::right << std::setw(12) << std::fixed << std::setprecision(3)
+			<< _result.nanoseconds_per_iteration << " ns/iter";
+		if (_result.bytes_per_iteration != 0)
+		{
+			// bytes per nanosecond is the same as gigabytes per second
+			std::cout << ' ' << std::setw(10) << static_cast<double>(_result.bytes_per_iteration) / _result.nanoseconds_per_iteration << " GB/s";
+		};
+		std::cout << " (" << _result.iterations << " iterations)\n";
+	};
+
+	/**
+	 * @brief Times a function object without reporting, running it once untimed to warm up beforehand
+	 * @param _iterations Number of times to invoke the function object
+	 * @param _op Function object to time, invoked with no arguements
+	 * @return Average time per invocation in nanoseconds
+	*/
+	template <typename OpT>
+	inline double time(size_t _iterations, OpT&& _op)
+	{
+		using clock = std::chrono::steady_clock;
+
+		_op();
+
+		const auto _start = clock::now();
+		for (size_t n = 0; n != _iterations; ++n)
+		{
+			_op();
+		};
+		const auto _end = clock::now();
+
+		const auto _elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(_end - _start).count();
+		return static_cast<double>(_elapsed) / static_cast<double>(_iterations);
+	};
+
+	/**
+	 * @brief Times a function object, running it once untimed to warm up beforehand
+	 * @param _name Name to print the result under
+	 * @param _iterations Number of times to invoke the function object
+	 * @param _op Function object to time, invoked with no arguements
+	 * @return Timing result, also printed to the output log
+	*/
+	template <typename OpT>
+	inline result run(std::string _name, size_t _iterations, OpT&& _op)
+	{
+		result _result{ std::move(_name), _iterations, jcbench::time(_iterations, std::forward<OpT>(_op)) };
+		report(_result);
+		return _result;
+	};
+
+	/**
+	 * @brief Times a function object that processes a fixed number of bytes, reporting throughput
+	 * @param _name Name to print the result under
+	 * @param _iterations Number of times to invoke the function object
+	 * @param _bytes Number of bytes processed per invocation
+	 * @param _op Function object to time, invoked with no arguements
+	 * @return Timing result, also printed to the output log
+	*/
+	template <typename OpT>
+	inline result run_throughput(std::string _name, size_t _iterations, size_t _bytes, OpT&& _op)
+	{
+		result _result{ std::move(_name), _iterations, jcbench::time(_iterations, std::forward<OpT>(_op)), _bytes };
+		report(_result);
+		return _result;
+	};
+};
+
+#endif
@@ -0,0 +1,38 @@
+#
+#	C++ version to build benchmarks with
+#
+set(benchcxxversion 17)
+
+#
+#	Defines a new benchmark executable target
+#
+#	@param benchName Target name for the new benchmark
+#   @param benchSource C++ source file path, must be absolute
+#
+function(JCLIB_ADD_BENCHMARK_FN benchName benchSource)
+
+	# Benchmark name
+	set(bname jclib_bench-${benchName})
+
+	# Define the target
+	add_executable(${bname} ${benchSource})
+
+	# Link jclib
+	target_link_libraries(${bname} PRIVATE jclib)
+
+	# Link the jclib benchmark support header
+	target_link_libraries(${bname} PRIVATE jclib::bench)
+
+	set_target_properties(${bname} PROPERTIES CXX_STANDARD ${benchcxxversion})
+
+endfunction()
+
+#
+#	Defines a new benchmark executable target
+#
+#	@param benchName Target name of the new benchmark
+#   @param benchSource Benchmark C++ source file path
+#
+macro(JCLIB_ADD_BENCHMARK benchName benchSource)
+	JCLIB_ADD_BENCHMARK_FN(${benchName} ${benchSource})
+endmacro()
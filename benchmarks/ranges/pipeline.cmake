@@ -0,0 +1,2 @@
+# parallel view pipeline benchmark driver
+JCLIB_ADD_BENCHMARK("pipeline" "${CMAKE_CURRENT_LIST_DIR}/pipeline.cpp")
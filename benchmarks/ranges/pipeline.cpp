@@ -0,0 +1,65 @@
+#include <jclib/algorithm.h>
+#include <jclib/execution.h>
+#include <jclib/ranges.h>
+#include <jclib-bench.hpp>
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+/*
+	Compares reducing a filter and transform pipeline sequentially against splitting it by position in the
+	underlying vector and evaluating each chunk of the pipeline on the thread pool.
+*/
+
+bool is_odd(uint64_t v) noexcept
+{
+	return (v & 1) != 0;
+};
+uint64_t mix(uint64_t v) noexcept
+{
+	v ^= v >> 33;
+	v *= 0xff51afd7ed558ccdULL;
+	v ^= v >> 33;
+	return v & 0xFFFF;
+};
+
+int main()
+{
+	const size_t _count = size_t(1) << 25;
+	std::vector<uint64_t> _data(_count);
+	for (size_t n = 0; n != _count; ++n)
+	{
+		_data[n] = n * 2654435761u;
+	};
+
+	const size_t _bytes = _count * sizeof(uint64_t);
+	const size_t _iterations = 20;
+
+	auto _odd = _data | jc::views::filter(&is_odd);
+	auto _pipeline = _odd | jc::views::transform(&mix);
+
+	jcbench::run_throughput("jc::reduce (seq, pipeline)", _iterations, _bytes, [&]()
+	{
+		auto _sum = jc::reduce(jc::execution::seq, _pipeline);
+		jcbench::do_not_optimize(_sum);
+	});
+	jcbench::run_throughput("jc::reduce (par, pipeline)", _iterations, _bytes, [&]()
+	{
+		auto _sum = jc::reduce(jc::execution::par, _pipeline);
+		jcbench::do_not_optimize(_sum);
+	});
+	jcbench::run_throughput("jc::for_each (par, pipeline)", _iterations, _bytes, [&]()
+	{
+		std::atomic<uint64_t> _count{ 0 };
+		jc::for_each(jc::execution::par, _pipeline, [&](uint64_t v)
+		{
+			if (v == 0)
+			{
+				++_count;
+			};
+		});
+		jcbench::do_not_optimize(_count);
+	});
+	return 0;
+};
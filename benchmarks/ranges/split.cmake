@@ -0,0 +1,2 @@
+# split benchmark driver
+JCLIB_ADD_BENCHMARK("split" "${CMAKE_CURRENT_LIST_DIR}/split.cpp")
@@ -0,0 +1,102 @@
+#include <jclib/span.h>
+#include <jclib-bench.hpp>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/*
+	Compares splitting a text buffer into lines and comma separated fields by copying each field into a
+	std::vector<std::string> against jc::views::split, which gives spans into the buffer.
+*/
+
+// Generates lines of comma separated fields of varying length
+std::string make_text(size_t _bytes)
+{
+	std::string _out{};
+	_out.reserve(_bytes + 64);
+	uint64_t _state = 0x9E3779B97F4A7C15ull;
+	while (_out.size() < _bytes)
+	{
+		for (int _field = 0; _field != 8; ++_field)
+		{
+			_state ^= _state << 13;
+			_state ^= _state >> 7;
+			_state ^= _state << 17;
+			_out.append(4 + _state % 24, static_cast<char>('a' + _state % 26));
+			_out.push_back((_field == 7) ? '\n' : ',');
+		};
+	};
+	return _out;
+};
+
+// Splits by copying the fields of each line into a vector of strings
+size_t split_copying(const std::string& _text, std::vector<std::string>& _fields)
+{
+	size_t _total = 0;
+	size_t _lineBegin = 0;
+	while (_lineBegin < _text.size())
+	{
+		auto _lineEnd = _text.find('\n', _lineBegin);
+		if (_lineEnd == std::string::npos)
+		{
+			_lineEnd = _text.size();
+		};
+
+		_fields.clear();
+		size_t _fieldBegin = _lineBegin;
+		while (true)
+		{
+			size_t _fieldEnd = _fieldBegin;
+			while (_fieldEnd != _lineEnd && _text[_fieldEnd] != ',')
+			{
+				++_fieldEnd;
+			};
+			_fields.emplace_back(_text, _fieldBegin, _fieldEnd - _fieldBegin);
+			if (_fieldEnd == _lineEnd)
+			{
+				break;
+			};
+			_fieldBegin = _fieldEnd + 1;
+		};
+		for (auto& _field : _fields)
+		{
+			_total += _field.size();
+		};
+		_lineBegin = _lineEnd + 1;
+	};
+	return _total;
+};
+
+// Splits using nested split views
+size_t split_views(const std::string& _text)
+{
+	size_t _total = 0;
+	for (auto _line : _text | jc::views::split('\n'))
+	{
+		for (auto _field : _line | jc::views::split(','))
+		{
+			_total += _field.size();
+		};
+	};
+	return _total;
+};
+
+int main()
+{
+	const auto _text = make_text(size_t(1) << 26);
+	const auto _bytes = _text.size();
+
+	std::vector<std::string> _fields{};
+	jcbench::run_throughput("copy into std::vector<std::string>", 10, _bytes, [&]()
+	{
+		auto _total = split_copying(_text, _fields);
+		jcbench::do_not_optimize(_total);
+	});
+	jcbench::run_throughput("jc::views::split", 10, _bytes, [&]()
+	{
+		auto _total = split_views(_text);
+		jcbench::do_not_optimize(_total);
+	});
+	return 0;
+};
@@ -0,0 +1,2 @@
+# ranges::to benchmark driver
+JCLIB_ADD_BENCHMARK("to" "${CMAKE_CURRENT_LIST_DIR}/to.cpp")
@@ -0,0 +1,58 @@
+#include <jclib/ranges.h>
+#include <jclib-bench.hpp>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/*
+	Compares collecting a view into a std::vector by appending element by element against jc::ranges::to, which
+	reserves once for sized ranges and copies contiguous ranges of trivially copyable elements in one go.
+*/
+
+uint64_t scale(uint64_t v) noexcept
+{
+	return v * 3;
+};
+
+int main()
+{
+	const size_t _length = size_t(1) << 24;
+	std::vector<uint64_t> _data(_length);
+	for (size_t n = 0; n != _length; ++n)
+	{
+		_data[n] = n;
+	};
+	const auto _bytes = _length * sizeof(uint64_t);
+
+	jcbench::run_throughput("push_back (transform)", 20, _bytes, [&]()
+	{
+		std::vector<uint64_t> _out{};
+		for (auto v : _data | jc::views::transform(&scale))
+		{
+			_out.push_back(v);
+		};
+		jcbench::do_not_optimize(_out);
+	});
+	jcbench::run_throughput("jc::ranges::to (transform)", 20, _bytes, [&]()
+	{
+		auto _out = _data | jc::views::transform(&scale) | jc::ranges::to<std::vector>();
+		jcbench::do_not_optimize(_out);
+	});
+
+	jcbench::run_throughput("push_back (all)", 20, _bytes, [&]()
+	{
+		std::vector<uint64_t> _out{};
+		for (auto v : _data | jc::views::all)
+		{
+			_out.push_back(v);
+		};
+		jcbench::do_not_optimize(_out);
+	});
+	jcbench::run_throughput("jc::ranges::to (contiguous)", 20, _bytes, [&]()
+	{
+		auto _out = jc::ranges::to<std::vector<uint64_t>>(_data);
+		jcbench::do_not_optimize(_out);
+	});
+	return 0;
+};
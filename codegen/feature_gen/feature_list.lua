@@ -104,4 +104,14 @@ new(
     "STRING_VIEW",
     "__cpp_lib_string_view",
     "201606L"
+)
+new(
+    "HAS_UNIQUE_OBJECT_REPRESENTATIONS",
+    "__cpp_lib_has_unique_object_representations",
+    "201606L"
+)
+new(
+    "IS_CONSTANT_EVALUATED",
+    "__cpp_lib_is_constant_evaluated",
+    "201811L"
 )
\ No newline at end of file
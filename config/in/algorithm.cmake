@@ -3,7 +3,7 @@
 #
 
 # Only relevent when compiling for C++14/17
-option(JCLIB_CONSTEXPR_ALGORITHMS "Enables custom constexpr versions of std algorithms, this may affect performance" ON)
+option(JCLIB_CONSTEXPR_ALGORITHMS "Enables custom constexpr versions of std algorithms, only used during constant evaluation when the compiler can detect it" ON)
 
 
 
@@ -20,20 +20,74 @@
 
 	Constexpr versions of standard library algorithms will also be made available for C++14/17 if the
 	relevant CMake option is set.
+
+	jc::reduce, jc::transform_reduce and jc::for_each take an execution policy from jclib/execution.h and may split
+	the range across a thread pool. Filter and transform view pipelines over random access ranges are split by
+	position in the underlying range, each chunk runs the pipeline over its own part. jc::find_if and
+	jc::contains_if can also take a policy, parallel searches stop claiming work once a match is found and still
+	return the first match by position.
+
+	jc::sort uses std::sort at runtime and a constexpr introsort during constant evaluation, given an execution policy
+	it sorts chunks of the range in parallel and merges them. jc::radix_sort is a stable LSD radix sort for integer and
+	floating point keys.
+
+	jc::lower_bound uses a branchless binary search on random access ranges, jc::lower_bound_batch runs a group of
+	searches in lockstep and prefetches ahead so their cache misses overlap.
+
+	jc::copy and jc::fill hand contiguous ranges of trivially copyable elements to memmove/memset, including spans and
+	borrow_ptr destinations. jc::copy_nontemporal and jc::fill_nontemporal additionally bypass the cache for very large
+	buffers which won't be read again soon.
 */
 
 #include <jclib/ranges.h>
 #include <jclib/functional.h>
 #include <jclib/feature.h>
+#include <jclib/execution.h>
+#include <jclib/memory.h>
+#include <jclib/span.h>
 
 // Algorithm config file
 #include <jclib/config/algorithm.h>
 
 #include <algorithm>
 #include <numeric>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <array>
+#include <memory>
+#include <limits>
+#include <atomic>
 
 #define _JCLIB_ALGORITHM_
 
+#ifndef JCLIB_ALGORITHM_H_SSE2_V
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		// True/False depending on if the non-temporal algorithms use SSE2 streaming stores, may be defined as false
+		// beforehand to force the regular stores
+		#define JCLIB_ALGORITHM_H_SSE2_V true
+	#else
+		// True/False depending on if the non-temporal algorithms use SSE2 streaming stores
+		#define JCLIB_ALGORITHM_H_SSE2_V false
+	#endif
+#endif
+
+#if JCLIB_ALGORITHM_H_SSE2_V
+	#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+	// Hints that the cache line containing an address will be read soon
+	#define JCLIB_ALGORITHM_H_PREFETCH(address) __builtin_prefetch(address)
+#elif JCLIB_ALGORITHM_H_SSE2_V
+	// Hints that the cache line containing an address will be read soon
+	#define JCLIB_ALGORITHM_H_PREFETCH(address) _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0)
+#else
+	// Hints that the cache line containing an address will be read soon
+	#define JCLIB_ALGORITHM_H_PREFETCH(address) static_cast<void>(address)
+#endif
+
 
 /*
 	 Determine if the standard library has constexpr algorithms and add a macro for ease of implementation custom backports
@@ -65,6 +119,29 @@
 #endif
 
 
+/*
+	Custom algorithm backports are only needed during constant evaluation. When it can be detected, runtime calls are sent
+	to the standard library (or an optimized implementation) instead so enabling the backports costs nothing at runtime.
+	The optimized implementations can't be used in constant expressions, so this is also needed with C++20 algorithms.
+*/
+#if JCLIB_IS_CONSTANT_EVALUATED_V
+
+	// Evaluates to true if an algorithm should use its runtime implementation instead of the constexpr backport
+	#define JCLIB_ALGORITHM_H_USE_RUNTIME_IMPL() (!::jc::is_constant_evaluated())
+
+#elif defined(JCLIB_ALGORITHM_H_USE_CUSTOM_ALGORITHMS)
+
+	// Evaluates to true if an algorithm should use its runtime implementation instead of the constexpr backport
+	#define JCLIB_ALGORITHM_H_USE_RUNTIME_IMPL() false
+
+#else
+
+	// Evaluates to true if an algorithm should use its runtime implementation instead of the constexpr backport
+	#define JCLIB_ALGORITHM_H_USE_RUNTIME_IMPL() true
+
+#endif
+
+
 namespace jc
 {
 	// Contains the type constraints used with algorithm functions regardless of implementation selected
@@ -95,6 +172,231 @@ namespace jc
 #pragma endregion ACCUMULATE_CONSTRAINTS
 	};
 
+	// Helpers for algorithms that operate directly on the underlying array of a contiguous range
+	namespace impl_algorithms_contiguous
+	{
+		/**
+		 * @brief Gets a pointer to the first element of a c-array
+		*/
+		template <typename T, size_t N>
+		constexpr inline T* data(T(&_arr)[N]) noexcept
+		{
+			return _arr;
+		};
+
+		/**
+		 * @brief Gets a pointer to the first element of a range with a data() member function
+		*/
+		template <typename RangeT>
+		constexpr inline auto data(RangeT& _range) noexcept(noexcept(_range.data())) -> decltype(_range.data())
+		{
+			return _range.data();
+		};
+
+		/**
+		 * @brief Type trait checking if a range's elements can be accessed through a pointer to its first element
+		 * @tparam RangeT Range type, cv and reference qualifiers are ignored
+		*/
+		template <typename RangeT, typename Enable = void>
+		struct is_pointer_range : jc::false_type {};
+
+		template <typename RangeT>
+		struct is_pointer_range<RangeT, jc::enable_if_t<
+			jc::ranges::is_contiguous_range<jc::remove_reference_t<RangeT>>::value &&
+			std::is_pointer<decltype(impl_algorithms_contiguous::data(std::declval<jc::remove_reference_t<RangeT>&>()))>::value
+		>> : jc::bool_constant<
+			jc::is_same
+			<
+				jc::remove_cv_t<std::remove_pointer_t<decltype(impl_algorithms_contiguous::data(std::declval<jc::remove_reference_t<RangeT>&>()))>>,
+				jc::remove_cv_t<jc::ranges::value_t<jc::remove_reference_t<RangeT>>>
+			>::value
+		>
+		{};
+
+		/**
+		 * @brief Gets the address an iterator points to, only defined for iterators known to wrap a pointer
+		*/
+		template <typename T>
+		constexpr inline T* to_address(T* _at) noexcept
+		{
+			return _at;
+		};
+
+		template <typename T>
+		constexpr inline T* to_address(const jc::borrow_ptr<T>& _at) noexcept
+		{
+			return _at.get();
+		};
+
+		// Must not be called with an end iterator while debugging iterators
+		template <typename T>
+		constexpr inline T* to_address(const jc::impl::span_iterator<T>& _at) noexcept
+		{
+			return _at.operator->();
+		};
+
+		/**
+		 * @brief Type trait checking if an iterator wraps a pointer which can be retrieved using to_address()
+		*/
+		template <typename IterT, typename Enable = void>
+		struct is_pointer_iterator : jc::false_type {};
+
+		template <typename IterT>
+		struct is_pointer_iterator<IterT, jc::enable_if_t<
+			std::is_pointer<decltype(impl_algorithms_contiguous::to_address(std::declval<const IterT&>()))>::value
+		>> : jc::true_type {};
+
+		/**
+		 * @brief Type trait checking if a range's elements can be accessed through a pointer, either from data() or
+		 * from its iterators
+		*/
+		template <typename RangeT>
+		struct is_address_range : jc::bool_constant<
+			is_pointer_range<RangeT>::value ||
+			is_pointer_iterator<jc::ranges::iterator_t<jc::remove_reference_t<RangeT>>>::value
+		> {};
+
+		/**
+		 * @brief Gets a pointer to the first element of a range, the range must not be empty
+		*/
+		template <typename RangeT, typename = jc::enable_if_t<is_pointer_range<RangeT>::value>>
+		constexpr inline auto range_address(RangeT& _range) ->
+			decltype(impl_algorithms_contiguous::data(_range))
+		{
+			return impl_algorithms_contiguous::data(_range);
+		};
+
+		template <typename RangeT, typename = jc::enable_if_t<!is_pointer_range<RangeT>::value>, typename = void>
+		constexpr inline auto range_address(RangeT& _range) ->
+			decltype(impl_algorithms_contiguous::to_address(jc::begin(_range)))
+		{
+			return impl_algorithms_contiguous::to_address(jc::begin(_range));
+		};
+	};
+
+	// Implementation of accumulate, integer and opted in floating point sums and products over arrays use several
+	// independent accumulators so the additions don't form a single dependency chain and can be vectorized
+	namespace impl_algorithms_accumulate
+	{
+		/**
+		 * @brief Type trait checking if an operator object is associative and commutative for arithmetic types
+		*/
+		template <typename OpT>
+		struct is_reassociable_operator : jc::false_type {};
+
+		template <>
+		struct is_reassociable_operator<jc::plus_t> : jc::true_type {};
+
+		template <>
+		struct is_reassociable_operator<jc::times_t> : jc::true_type {};
+
+		/**
+		 * @brief Gets the identity value of a reassociable operator
+		*/
+		template <typename T>
+		constexpr inline T operator_identity(jc::plus_t) noexcept
+		{
+			return T(0);
+		};
+		template <typename T>
+		constexpr inline T operator_identity(jc::times_t) noexcept
+		{
+			return T(1);
+		};
+
+		/**
+		 * @brief Gets the type used for the independent accumulators. Integers are accumulated as unsigned so reordering
+		 * the operations can't introduce signed overflow, the wrapped result is identical.
+		*/
+		template <typename T, typename Enable = void>
+		struct accumulator
+		{
+			using type = T;
+		};
+
+		template <typename T>
+		struct accumulator<T, jc::enable_if_t<std::is_integral<T>::value>>
+		{
+			using type = std::make_unsigned_t<T>;
+		};
+
+		/**
+		 * @brief Type trait checking if accumulating elements of type E into a T can use independent accumulators
+		 * @tparam E Element type
+		 * @tparam OpT Operator object type
+		 * @tparam T Accumulated value type
+		 * @tparam Reassociate Allows floating point operations to be reordered, changing the rounding of the result
+		*/
+		template <typename E, typename OpT, typename T, bool Reassociate>
+		struct is_multi_accumulate : jc::bool_constant
+			<
+				std::is_arithmetic<E>::value && std::is_arithmetic<T>::value && !jc::is_same<T, bool>::value &&
+				is_reassociable_operator<jc::remove_cvref_t<OpT>>::value &&
+				(std::is_integral<T>::value ? std::is_integral<E>::value : Reassociate)
+			>
+		{};
+
+		/**
+		 * @brief Accumulates an array using independent accumulators, combined pairwise at the end
+		*/
+		template <typename E, typename OpT, typename T>
+		inline T accumulate_lanes(const E* _begin, const E* const _end, const OpT& _op, T _init) noexcept
+		{
+			using acc_type = typename accumulator<T>::type;
+
+			// 64 bytes of accumulators, enough to hide the operation latency and fill the vector registers
+			constexpr size_t lanes = 64 / sizeof(acc_type);
+
+			acc_type _acc[lanes];
+			for (auto& v : _acc)
+			{
+				v = impl_algorithms_accumulate::operator_identity<acc_type>(jc::remove_cvref_t<OpT>{});
+			};
+
+			while (static_cast<size_t>(_end - _begin) >= lanes)
+			{
+				for (size_t n = 0; n != lanes; ++n)
+				{
+					_acc[n] = jc::invoke(_op, _acc[n], static_cast<acc_type>(static_cast<T>(_begin[n])));
+				};
+				_begin += lanes;
+			};
+
+			for (size_t _stride = lanes / 2; _stride != 0; _stride /= 2)
+			{
+				for (size_t n = 0; n != _stride; ++n)
+				{
+					_acc[n] = jc::invoke(_op, _acc[n], _acc[n + _stride]);
+				};
+			};
+
+			acc_type _result = jc::invoke(_op, static_cast<acc_type>(_init), _acc[0]);
+			for (; _begin != _end; ++_begin)
+			{
+				_result = jc::invoke(_op, _result, static_cast<acc_type>(static_cast<T>(*_begin)));
+			};
+			return static_cast<T>(_result);
+		};
+
+		/**
+		 * @brief Runtime accumulate using independent accumulators
+		*/
+		template <typename E, typename OpT, typename T>
+		inline T accumulate(E* _begin, E* _end, const OpT& _op, T _init, jc::true_type) noexcept
+		{
+			return impl_algorithms_accumulate::accumulate_lanes(_begin, _end, _op, std::move(_init));
+		};
+
+		/**
+		 * @brief Runtime accumulate for everything else
+		*/
+		template <typename IterT, typename OpT, typename T>
+		inline T accumulate(IterT _begin, IterT _end, const OpT& _op, T _init, jc::false_type)
+		{
+			return ::std::accumulate(_begin, _end, std::move(_init), _op);
+		};
+	};
+
 	// Iterator based accumulate
 	template <typename IterT, typename OpT = jc::plus_t, typename T = jc::remove_cvref_t<jc::iterator_to_t<IterT>>>
 	JCLIB_REQUIRES((impl_algorithms_constraints::cx_accumulate_constraints<IterT, OpT, T>))
@@ -104,9 +406,15 @@ namespace jc
 		))
 		-> JCLIB_RET_SFINAE_CXSWITCH(T, impl_algorithms_constraints::accumulate_constraints<IterT, OpT, T>::value)
 	{
-#if defined(JCLIB_ALGORITHM_H_USE_STD_ALGORITHMS)
-		return ::std::accumulate(_begin, _end, std::move(_init), _op);
-#else
+		if (JCLIB_ALGORITHM_H_USE_RUNTIME_IMPL())
+		{
+			return impl_algorithms_accumulate::accumulate(_begin, _end, _op, std::move(_init), jc::bool_constant
+			<
+				std::is_pointer<IterT>::value &&
+				impl_algorithms_accumulate::is_multi_accumulate<jc::remove_cvref_t<jc::iterator_to_t<IterT>>, OpT, T, false>::value
+			>{});
+		};
+
 		// Exit early if 0 length range
 		if (_begin == _end)
 		{
@@ -121,7 +429,29 @@ namespace jc
 
 		// Return result
 		return _init;
-#endif
+	};
+
+	namespace impl_algorithms_accumulate
+	{
+		/**
+		 * @brief Range accumulate for ranges with a pointer to their elements, the pointers are passed along so the
+		 * multiple accumulator implementation can be selected
+		*/
+		template <typename RangeT, typename OpT, typename T>
+		JCLIB_ALGORITHM_H_CONSTEXPR inline T accumulate_range(RangeT& _range, const OpT& _op, T _init, jc::true_type)
+		{
+			const auto _data = impl_algorithms_contiguous::data(_range);
+			return jc::accumulate(_data, _data + (jc::end(_range) - jc::begin(_range)), _op, std::move(_init));
+		};
+
+		/**
+		 * @brief Range accumulate for everything else
+		*/
+		template <typename RangeT, typename OpT, typename T>
+		JCLIB_ALGORITHM_H_CONSTEXPR inline T accumulate_range(RangeT& _range, const OpT& _op, T _init, jc::false_type)
+		{
+			return jc::accumulate(jc::begin(_range), jc::end(_range), _op, std::move(_init));
+		};
 	};
 
 	// Range based accumulate
@@ -149,18 +479,648 @@ namespace jc
 			jc::ranges::is_range<RangeT>::value
 		)
 	{
-		return jc::accumulate(jc::begin(_range), jc::end(_range), _op, std::move(_init));
+		return impl_algorithms_accumulate::accumulate_range(_range, _op, std::move(_init),
+			jc::bool_constant<impl_algorithms_contiguous::is_pointer_range<RangeT>::value>{});
+	};
+
+
+
+	// Implementation of the execution policy algorithms
+	namespace impl_algorithms_execution
+	{
+		/**
+		 * @brief Minimum number of elements per chunk before a parallel algorithm splits a range
+		*/
+		constexpr size_t parallel_grain = 4096;
+
+		/**
+		 * @brief Holds a chunk's partial result, avoids std::vector<bool> packing results written from different threads
+		*/
+		template <typename T>
+		struct partial_result
+		{
+			T value;
+		};
+
+		/**
+		 * @brief Identity transform used to implement reduce using transform_reduce
+		*/
+		struct identity_transform
+		{
+			template <typename T>
+			constexpr T&& operator()(T&& _value) const noexcept
+			{
+				return std::forward<T>(_value);
+			};
+		};
+
+		/**
+		 * @brief Sequential transform reduce over an iterator pair
+		*/
+		template <typename IterT, typename T, typename ReduceT, typename TransformT>
+		inline T transform_reduce_seq(IterT _begin, const IterT _end, T _init, ReduceT& _reduce, TransformT& _transform, jc::false_type)
+		{
+			for (; _begin != _end; ++_begin)
+			{
+				_init = jc::invoke(_reduce, std::move(_init), jc::invoke(_transform, *_begin));
+			};
+			return _init;
+		};
+
+		/**
+		 * @brief Sequential reduce over an array using independent accumulators
+		*/
+		template <typename E, typename T, typename ReduceT, typename TransformT>
+		inline T transform_reduce_seq(E* _begin, E* const _end, T _init, ReduceT& _reduce, TransformT&, jc::true_type)
+		{
+			return impl_algorithms_accumulate::accumulate_lanes(_begin, _end, _reduce, std::move(_init));
+		};
+
+		/**
+		 * @brief Type trait checking if a sequential reduce can use independent accumulators
+		 * @tparam Reassociate Allows floating point operations to be reordered
+		*/
+		template <typename IterT, typename T, typename ReduceT, typename TransformT, bool Reassociate>
+		struct is_multi_reduce : jc::bool_constant
+			<
+				std::is_pointer<IterT>::value &&
+				jc::is_same<jc::remove_cv_t<TransformT>, identity_transform>::value &&
+				impl_algorithms_accumulate::is_multi_accumulate<jc::remove_cvref_t<jc::iterator_to_t<IterT>>, ReduceT, T, Reassociate>::value
+			>
+		{};
+
+		/**
+		 * @brief Transform reduce for iterators without random access, always sequential
+		*/
+		template <typename IterT, typename T, typename ReduceT, typename TransformT, bool Reassociate>
+		inline T transform_reduce(jc::thread_pool*, IterT _begin, IterT _end, T _init, ReduceT& _reduce, TransformT& _transform,
+			jc::bool_constant<Reassociate>, jc::false_type)
+		{
+			return impl_algorithms_execution::transform_reduce_seq(_begin, _end, std::move(_init), _reduce, _transform,
+				jc::bool_constant<is_multi_reduce<IterT, T, ReduceT, TransformT, Reassociate>::value>{});
+		};
+
+		/**
+		 * @brief Transform reduce for random access iterators, splits the range into chunks across the thread pool and
+		 * combines the partial results pairwise
+		*/
+		template <typename IterT, typename T, typename ReduceT, typename TransformT, bool Reassociate>
+		inline T transform_reduce(jc::thread_pool* _pool, IterT _begin, IterT _end, T _init, ReduceT& _reduce, TransformT& _transform,
+			jc::bool_constant<Reassociate>, jc::true_type)
+		{
+			using difference_type = decltype(_end - _begin);
+			using multi_tag = jc::bool_constant<is_multi_reduce<IterT, T, ReduceT, TransformT, Reassociate>::value>;
+
+			const size_t _count = static_cast<size_t>(_end - _begin);
+			const size_t _chunks = impl::execution_chunk_count(_pool, _count, parallel_grain);
+			if (_chunks <= 1)
+			{
+				return impl_algorithms_execution::transform_reduce_seq(_begin, _end, std::move(_init), _reduce, _transform, multi_tag{});
+			};
+
+			// Each chunk is non-empty, so it starts from its first transformed element instead of needing an identity value
+			std::vector<partial_result<T>> _partials(_chunks, partial_result<T>{ _init });
+			impl::execution_for_each_chunk(*_pool, _count, _chunks, [&](size_t _chunk, size_t _first, size_t _last)
+			{
+				auto _at = _begin + static_cast<difference_type>(_first);
+				const auto _stop = _begin + static_cast<difference_type>(_last);
+				T _value = jc::invoke(_transform, *_at);
+				_partials[_chunk].value = impl_algorithms_execution::transform_reduce_seq(++_at, _stop, std::move(_value), _reduce, _transform, multi_tag{});
+			});
+
+			// Combine neighbouring partial results as a tree, keeping them in order
+			for (size_t _stride = 1; _stride < _chunks; _stride *= 2)
+			{
+				for (size_t n = 0; n + _stride < _chunks; n += _stride * 2)
+				{
+					_partials[n].value = jc::invoke(_reduce, std::move(_partials[n].value), std::move(_partials[n + _stride].value));
+				};
+			};
+			return jc::invoke(_reduce, std::move(_init), std::move(_partials.front().value));
+		};
+
+		/**
+		 * @brief Transform reduce over a range with a pointer to its elements, passes the pointers along so the
+		 * independent accumulator implementation can be selected
+		*/
+		template <typename RangeT, typename T, typename ReduceT, typename TransformT, typename ReassociateT>
+		inline T transform_reduce_range(jc::thread_pool* _pool, RangeT& _range, T _init, ReduceT& _reduce, TransformT& _transform,
+			ReassociateT _reassociate, jc::true_type)
+		{
+			const auto _data = impl_algorithms_contiguous::data(_range);
+			return impl_algorithms_execution::transform_reduce(_pool, _data, _data + (jc::end(_range) - jc::begin(_range)),
+				std::move(_init), _reduce, _transform, _reassociate, jc::true_type{});
+		};
+
+		/**
+		 * @brief Transform reduce over a view pipeline without random access, such as a filter view, over a random access
+		 * range. Chunks are taken by position in the underlying range so some may be empty, the partial results of
+		 * the others are combined in order.
+		*/
+		template <typename IterT, typename T, typename ReduceT, typename TransformT>
+		inline T transform_reduce_pipeline(jc::thread_pool* _pool, const IterT _begin, const IterT _end, T _init, ReduceT& _reduce,
+			TransformT& _transform)
+		{
+			using chunker = jc::ranges::impl::iterator_chunker<IterT>;
+
+			const size_t _count = chunker::size(_begin, _end);
+			const size_t _chunks = impl::execution_chunk_count(_pool, _count, parallel_grain);
+			if (_chunks <= 1)
+			{
+				return impl_algorithms_execution::transform_reduce_seq(_begin, _end, std::move(_init), _reduce, _transform, jc::false_type{});
+			};
+
+			std::vector<partial_result<T>> _partials(_chunks, partial_result<T>{ _init });
+			std::vector<partial_result<bool>> _filled(_chunks, partial_result<bool>{ false });
+			impl::execution_for_each_chunk(*_pool, _count, _chunks, [&](size_t _chunk, size_t _first, size_t _last)
+			{
+				const auto _range = chunker::chunk(_begin, _end, _first, _last);
+				auto _at = _range.first;
+				if (_at == _range.second)
+				{
+					return;
+				};
+				T _value = jc::invoke(_transform, *_at);
+				_partials[_chunk].value = impl_algorithms_execution::transform_reduce_seq(++_at, _range.second, std::move(_value),
+					_reduce, _transform, jc::false_type{});
+				_filled[_chunk].value = true;
+			});
+
+			for (size_t n = 0; n != _chunks; ++n)
+			{
+				if (_filled[n].value)
+				{
+					_init = jc::invoke(_reduce, std::move(_init), std::move(_partials[n].value));
+				};
+			};
+			return _init;
+		};
+
+		/**
+		 * @brief Transform reduce over any other range
+		*/
+		template <typename RangeT, typename T, typename ReduceT, typename TransformT, typename ReassociateT>
+		inline T transform_reduce_iterators(jc::thread_pool* _pool, RangeT& _range, T _init, ReduceT& _reduce, TransformT& _transform,
+			ReassociateT _reassociate, jc::false_type /* is pipeline */)
+		{
+			return impl_algorithms_execution::transform_reduce(_pool, jc::begin(_range), jc::end(_range),
+				std::move(_init), _reduce, _transform, _reassociate,
+				jc::bool_constant<jc::ranges::is_contiguous_range<RangeT>::value>{});
+		};
+
+		/**
+		 * @brief Transform reduce over a view pipeline which can be split by position in its underlying range
+		*/
+		template <typename RangeT, typename T, typename ReduceT, typename TransformT, typename ReassociateT>
+		inline T transform_reduce_iterators(jc::thread_pool* _pool, RangeT& _range, T _init, ReduceT& _reduce, TransformT& _transform,
+			ReassociateT, jc::true_type /* is pipeline */)
+		{
+			return impl_algorithms_execution::transform_reduce_pipeline(_pool, jc::begin(_range), jc::end(_range),
+				std::move(_init), _reduce, _transform);
+		};
+
+		/**
+		 * @brief Transform reduce over any other range
+		*/
+		template <typename RangeT, typename T, typename ReduceT, typename TransformT, typename ReassociateT>
+		inline T transform_reduce_range(jc::thread_pool* _pool, RangeT& _range, T _init, ReduceT& _reduce, TransformT& _transform,
+			ReassociateT _reassociate, jc::false_type)
+		{
+			return impl_algorithms_execution::transform_reduce_iterators(_pool, _range, std::move(_init), _reduce, _transform, _reassociate,
+				jc::bool_constant<jc::ranges::impl::is_chunkable_pipeline<RangeT>::value>{});
+		};
+
+		/**
+		 * @brief Applies a function to each element, used by for_each for ranges which aren't split
+		*/
+		template <typename IterT, typename FnT>
+		inline void for_each_seq(IterT _begin, const IterT _end, FnT& _fn)
+		{
+			for (; _begin != _end; ++_begin)
+			{
+				jc::invoke(_fn, *_begin);
+			};
+		};
+
+		/**
+		 * @brief Parallel for_each for iterators without random access, always sequential
+		*/
+		template <typename IterT, typename FnT>
+		inline void for_each(jc::thread_pool*, IterT _begin, IterT _end, FnT& _fn, jc::false_type)
+		{
+			impl_algorithms_execution::for_each_seq(_begin, _end, _fn);
+		};
+
+		/**
+		 * @brief Parallel for_each for random access iterators, splits the range into chunks across the thread pool
+		*/
+		template <typename IterT, typename FnT>
+		inline void for_each(jc::thread_pool* _pool, const IterT _begin, const IterT _end, FnT& _fn, jc::true_type)
+		{
+			using difference_type = decltype(_end - _begin);
+
+			const size_t _count = static_cast<size_t>(_end - _begin);
+			const size_t _chunks = impl::execution_chunk_count(_pool, _count, parallel_grain);
+			if (_chunks <= 1)
+			{
+				impl_algorithms_execution::for_each_seq(_begin, _end, _fn);
+				return;
+			};
+
+			impl::execution_for_each_chunk(*_pool, _count, _chunks, [&](size_t, size_t _first, size_t _last)
+			{
+				impl_algorithms_execution::for_each_seq(_begin + static_cast<difference_type>(_first), _begin + static_cast<difference_type>(_last), _fn);
+			});
+		};
+
+		/**
+		 * @brief Parallel for_each for view pipelines which can be split by position in their underlying range
+		*/
+		template <typename IterT, typename FnT>
+		inline void for_each_pipeline(jc::thread_pool* _pool, const IterT _begin, const IterT _end, FnT& _fn)
+		{
+			using chunker = jc::ranges::impl::iterator_chunker<IterT>;
+
+			const size_t _count = chunker::size(_begin, _end);
+			const size_t _chunks = impl::execution_chunk_count(_pool, _count, parallel_grain);
+			if (_chunks <= 1)
+			{
+				impl_algorithms_execution::for_each_seq(_begin, _end, _fn);
+				return;
+			};
+
+			impl::execution_for_each_chunk(*_pool, _count, _chunks, [&](size_t, size_t _first, size_t _last)
+			{
+				const auto _chunk = chunker::chunk(_begin, _end, _first, _last);
+				impl_algorithms_execution::for_each_seq(_chunk.first, _chunk.second, _fn);
+			});
+		};
+
+		template <typename RangeT, typename FnT>
+		inline void for_each_range(jc::thread_pool* _pool, RangeT& _range, FnT& _fn, jc::false_type /* is pipeline */)
+		{
+			impl_algorithms_execution::for_each(_pool, jc::begin(_range), jc::end(_range), _fn,
+				jc::bool_constant<jc::ranges::is_contiguous_range<RangeT>::value>{});
+		};
+
+		template <typename RangeT, typename FnT>
+		inline void for_each_range(jc::thread_pool* _pool, RangeT& _range, FnT& _fn, jc::true_type /* is pipeline */)
+		{
+			impl_algorithms_execution::for_each_pipeline(_pool, jc::begin(_range), jc::end(_range), _fn);
+		};
+	};
+
+	/**
+	 * @brief Applies a transform to each element of a range and combines the results, the elements may be processed
+	 * in parallel depending on the execution policy.
+	 * 
+	 * Unlike jc::accumulate the reduce function must be associative as the range may be split into chunks that are
+	 * reduced separately, the chunk results are always combined in order.
+	 * 
+	 * @param _policy Execution policy, see jclib/execution.h
+	 * @param _range Range to reduce
+	 * @param _transform Function object applied to each element
+	 * @param _reduce Associative function object used to combine the transformed elements
+	 * @param _init Initial value
+	 * @return Reduced value
+	*/
+	template <typename PolicyT, typename RangeT, typename TransformT, typename ReduceT = jc::plus_t,
+		typename T = jc::remove_cvref_t<jc::invoke_result_t<TransformT, jc::ranges::reference_t<jc::remove_reference_t<RangeT>>>>>
+	JCLIB_REQUIRES((jc::execution::is_execution_policy<PolicyT>::value && jc::cx_range<RangeT>))
+	inline auto transform_reduce(PolicyT&& _policy, RangeT&& _range, const TransformT& _transform, const ReduceT& _reduce = jc::plus, T _init = T{}) ->
+		JCLIB_RET_SFINAE_CXSWITCH
+		(
+			T,
+			jc::execution::is_execution_policy<PolicyT>::value && jc::ranges::is_range<jc::remove_reference_t<RangeT>>::value
+		)
+	{
+		return impl_algorithms_execution::transform_reduce_range(impl::execution_pool(_policy), _range, std::move(_init), _reduce, _transform,
+			jc::bool_constant<impl::is_unsequenced_policy<PolicyT>::value>{},
+			jc::bool_constant<impl_algorithms_contiguous::is_pointer_range<RangeT>::value>{});
+	};
+
+	/**
+	 * @brief Combines the elements of a range, the elements may be processed in parallel depending on the execution policy.
+	 * 
+	 * Unlike jc::accumulate the reduce function must be associative as the range may be split into chunks that are
+	 * reduced separately, the chunk results are always combined in order.
+	 * 
+	 * Sums and products of arithmetic arrays using jc::plus or jc::times are computed with several independent
+	 * accumulators. Floating point values are only reordered this way with the unseq and par_unseq policies, as it
+	 * changes how the result is rounded.
+	 * 
+	 * @param _policy Execution policy, see jclib/execution.h
+	 * @param _range Range to reduce
+	 * @param _reduce Associative function object used to combine the elements
+	 * @param _init Initial value
+	 * @return Reduced value
+	*/
+	template <typename PolicyT, typename RangeT, typename ReduceT = jc::plus_t,
+		typename T = jc::remove_const_t<jc::ranges::value_t<jc::remove_reference_t<RangeT>>>>
+	JCLIB_REQUIRES((jc::execution::is_execution_policy<PolicyT>::value && jc::cx_range<RangeT>))
+	inline auto reduce(PolicyT&& _policy, RangeT&& _range, const ReduceT& _reduce = jc::plus, T _init = T{}) ->
+		JCLIB_RET_SFINAE_CXSWITCH
+		(
+			T,
+			jc::execution::is_execution_policy<PolicyT>::value && jc::ranges::is_range<jc::remove_reference_t<RangeT>>::value
+		)
+	{
+		const impl_algorithms_execution::identity_transform _transform{};
+		return impl_algorithms_execution::transform_reduce_range(impl::execution_pool(_policy), _range, std::move(_init), _reduce, _transform,
+			jc::bool_constant<impl::is_unsequenced_policy<PolicyT>::value>{},
+			jc::bool_constant<impl_algorithms_contiguous::is_pointer_range<RangeT>::value>{});
+	};
+
+	/**
+	 * @brief Applies a function to each element of a range, the elements may be processed in parallel depending on
+	 * the execution policy.
+	 * 
+	 * Random access ranges and filter or transform view pipelines over them are split into chunks across the thread
+	 * pool, each chunk is processed in order but chunks run concurrently. The function, and any view functions, must
+	 * be safe to call from several threads at once.
+	 * 
+	 * @param _policy Execution policy, see jclib/execution.h
+	 * @param _range Range to process
+	 * @param _fn Function object invoked with each element
+	*/
+	template <typename PolicyT, typename RangeT, typename FnT>
+	JCLIB_REQUIRES((jc::execution::is_execution_policy<PolicyT>::value && jc::cx_range<RangeT>))
+	inline auto for_each(PolicyT&& _policy, RangeT&& _range, FnT&& _fn) ->
+		JCLIB_RET_SFINAE_CXSWITCH
+		(
+			void,
+			jc::execution::is_execution_policy<PolicyT>::value && jc::ranges::is_range<jc::remove_reference_t<RangeT>>::value
+		)
+	{
+		impl_algorithms_execution::for_each_range(impl::execution_pool(_policy), _range, _fn,
+			jc::bool_constant<jc::ranges::impl::is_chunkable_pipeline<jc::remove_reference_t<RangeT>>::value>{});
 	};
 
 
 
+	// Implementation of jc::find, contiguous ranges of small integers and enums are searched a block at a time
+	namespace impl_algorithms_find
+	{
+		/**
+		 * @brief Simple find loop, used when an optimized implementation can't be
+		*/
+		template <typename IterT, typename SentinelT, typename T>
+		constexpr inline IterT find_scalar(IterT _begin, const SentinelT _end, const T& _val)
+		{
+			for (; _begin != _end; ++_begin)
+			{
+				if (*_begin == _val)
+				{
+					break;
+				};
+			};
+			return _begin;
+		};
+
+		/**
+		 * @brief Simple find_if loop, used during constant evaluation when backporting constexpr algorithms
+		*/
+		template <typename IterT, typename SentinelT, typename OpT>
+		constexpr inline IterT find_if_scalar(IterT _begin, const SentinelT _end, OpT& _pred)
+		{
+			for (; _begin != _end; ++_begin)
+			{
+				if (jc::invoke(_pred, *_begin))
+				{
+					break;
+				};
+			};
+			return _begin;
+		};
+
+		/**
+		 * @brief Type trait checking if elements of type E can be compared against a value of type T using their
+		 * object representations.
+		 * 
+		 * 8 byte elements are left to std::find as baseline SSE2 has no 64 bit compare for the blocked search to use.
+		*/
+		template <typename E, typename T, typename Enable = void>
+		struct is_bitwise_findable : jc::false_type {};
+
+		template <typename E, typename T>
+		struct is_bitwise_findable<E, T, jc::enable_if_t<std::is_integral<E>::value && std::is_integral<T>::value>> :
+			jc::bool_constant<sizeof(E) == 1 || sizeof(E) == 2 || sizeof(E) == 4>
+		{};
+
+		template <typename E>
+		struct is_bitwise_findable<E, E, jc::enable_if_t<std::is_enum<E>::value>> :
+			jc::bool_constant<sizeof(E) == 1 || sizeof(E) == 2 || sizeof(E) == 4>
+		{};
+
+		/**
+		 * @brief Type trait checking if the optimized find can be used for a range and value type
+		*/
+		template <typename RangeT, typename T, typename Enable = void>
+		struct is_fast_findable : jc::false_type {};
+
+		template <typename RangeT, typename T>
+		struct is_fast_findable<RangeT, T, jc::enable_if_t<impl_algorithms_contiguous::is_pointer_range<RangeT>::value>> :
+			jc::bool_constant
+			<
+				JCLIB_IS_CONSTANT_EVALUATED_V &&
+				is_bitwise_findable<jc::remove_cv_t<jc::ranges::value_t<jc::remove_reference_t<RangeT>>>, jc::remove_cvref_t<T>>::value
+			>
+		{};
+
+		/**
+		 * @brief Converts the value being searched for into the element type
+		 * @return True if an element may compare equal to the value, false if none can
+		*/
+		template <typename E, typename T>
+		constexpr inline bool to_element(const T& _val, E& _out, jc::true_type /* is integral */) noexcept
+		{
+			// Integer comparison converts both sides to this type, converting through it avoids sign-compare warnings
+			using common_type = decltype(std::declval<E>() + std::declval<T>());
+			_out = static_cast<E>(_val);
+			return static_cast<common_type>(_out) == static_cast<common_type>(_val);
+		};
+
+		template <typename E, typename T>
+		constexpr inline bool to_element(const T& _val, E& _out, jc::false_type /* is integral */) noexcept
+		{
+			_out = _val;
+			return true;
+		};
+
+		/**
+		 * @brief Searches an array of single byte elements using memchr
+		*/
+		template <typename E>
+		inline const E* find_contiguous(const E* _begin, const E* _end, E _key, std::integral_constant<size_t, 1>) noexcept
+		{
+			if (_begin == _end)
+			{
+				return _end;
+			};
+
+			unsigned char _byte{};
+			std::memcpy(&_byte, &_key, sizeof(_byte));
+			const auto _at = std::memchr(_begin, _byte, static_cast<size_t>(_end - _begin));
+			return (_at) ?
+				_begin + (static_cast<const unsigned char*>(_at) - reinterpret_cast<const unsigned char*>(_begin)) :
+				_end;
+		};
+
+		/**
+		 * @brief Searches an array of 2 or 4 byte elements a block at a time.
+		 * 
+		 * Each block is compared against the key without branching and the results are or'ed together, this keeps
+		 * the loop free of per element branches and lets the compiler vectorize the comparisons.
+		*/
+		template <typename E, size_t Size>
+		inline const E* find_contiguous(const E* _begin, const E* _end, E _key, std::integral_constant<size_t, Size>) noexcept
+		{
+			using lane_type = std::conditional_t<Size == 2, uint16_t, uint32_t>;
+
+			// Elements checked per iteration, large enough that the compiler vectorizes the comparisons instead of
+			// fully unrolling them
+			constexpr size_t block = 32;
+
+			const auto _keyBits = static_cast<lane_type>(_key);
+
+			while (static_cast<size_t>(_end - _begin) >= block)
+			{
+				lane_type _found = 0;
+				for (size_t n = 0; n != block; ++n)
+				{
+					_found |= static_cast<lane_type>(static_cast<lane_type>(_begin[n]) == _keyBits);
+				};
+				if (_found)
+				{
+					break;
+				};
+				_begin += block;
+			};
+
+			// Finish off the remaining elements, or pinpoint the match in the block that contained it
+			return impl_algorithms_find::find_scalar(_begin, _end, _key);
+		};
+
+		/**
+		 * @brief Find implementation for ranges which can't use the optimized find
+		*/
+		template <typename RangeT, typename T>
+		JCLIB_CONSTEXPR inline auto find(RangeT& _range, const T& _val, jc::false_type) -> decltype(jc::begin(_range))
+		{
+			if (JCLIB_ALGORITHM_H_USE_RUNTIME_IMPL())
+			{
+				return std::find(jc::begin(_range), jc::end(_range), _val);
+			};
+			return impl_algorithms_find::find_scalar(jc::begin(_range), jc::end(_range), _val);
+		};
+
+		/**
+		 * @brief Optimized find for contiguous ranges of integers and enums, uses the scalar loop during constant evaluation
+		*/
+		template <typename RangeT, typename T>
+		JCLIB_CONSTEXPR inline auto find(RangeT& _range, const T& _val, jc::true_type) -> decltype(jc::begin(_range))
+		{
+			using element_type = jc::remove_cv_t<std::remove_pointer_t<decltype(impl_algorithms_contiguous::data(_range))>>;
+
+			element_type _key{};
+			if (!impl_algorithms_find::to_element(_val, _key, jc::bool_constant<std::is_integral<element_type>::value>{}))
+			{
+				return jc::end(_range);
+			};
+
+			const auto _begin = jc::begin(_range);
+			if (jc::is_constant_evaluated())
+			{
+				return impl_algorithms_find::find_scalar(_begin, jc::end(_range), _key);
+			};
+			const auto _count = jc::end(_range) - _begin;
+
+			const element_type* const _data = impl_algorithms_contiguous::data(_range);
+			const auto _at = impl_algorithms_find::find_contiguous(_data, _data + _count, _key,
+				std::integral_constant<size_t, sizeof(element_type)>{});
+			return jc::next(_begin, _at - _data);
+		};
+
+		/**
+		 * @brief Minimum number of elements per block searched by a parallel find_if
+		*/
+		constexpr size_t parallel_find_grain = 1024;
+
+		/**
+		 * @brief Maximum number of blocks per thread for a parallel find_if, more blocks means less work is wasted
+		 * searching past a match but more time is spent claiming blocks
+		*/
+		constexpr size_t parallel_find_blocks_per_thread = 64;
+
+		/**
+		 * @brief Lowers an atomic position to a value if the value is lower
+		*/
+		inline void fetch_min(std::atomic<size_t>& _at, size_t _value) noexcept
+		{
+			size_t _current = _at.load(std::memory_order_relaxed);
+			while (_value < _current && !_at.compare_exchange_weak(_current, _value, std::memory_order_relaxed))
+			{};
+		};
+
+		/**
+		 * @brief Parallel find_if for iterators without random access, always sequential
+		*/
+		template <typename IterT, typename SentinelT, typename OpT>
+		inline IterT find_if(jc::thread_pool*, IterT _begin, const SentinelT _end, OpT& _pred, jc::false_type)
+		{
+			return impl_algorithms_find::find_if_scalar(_begin, _end, _pred);
+		};
+
+		/**
+		 * @brief Parallel find_if for random access iterators.
+		 * 
+		 * The range is split into blocks which are claimed in order by the threads, the position of the first match
+		 * found so far is shared and blocks starting after it are skipped. Blocks before it are still searched so the
+		 * first match by position is returned.
+		*/
+		template <typename IterT, typename OpT>
+		inline IterT find_if(jc::thread_pool* _pool, const IterT _begin, const IterT _end, OpT& _pred, jc::true_type)
+		{
+			using difference_type = decltype(_end - _begin);
+
+			const size_t _count = static_cast<size_t>(_end - _begin);
+			if (impl::execution_chunk_count(_pool, _count, parallel_find_grain) <= 1)
+			{
+				return impl_algorithms_find::find_if_scalar(_begin, _end, _pred);
+			};
+
+			const size_t _maxBlocks = (_pool->size() + 1) * parallel_find_blocks_per_thread;
+			const size_t _grainBlocks = _count / parallel_find_grain;
+			const size_t _blocks = (_grainBlocks < _maxBlocks) ? _grainBlocks : _maxBlocks;
 
+			std::atomic<size_t> _found{ _count };
+			impl::execution_for_each_chunk(*_pool, _count, _blocks, [&](size_t, size_t _first, size_t _last)
+			{
+				if (_found.load(std::memory_order_relaxed) < _first)
+				{
+					return;
+				};
 
+				const auto _blockBegin = _begin + static_cast<difference_type>(_first);
+				const auto _blockEnd = _begin + static_cast<difference_type>(_last);
+				const auto _at = impl_algorithms_find::find_if_scalar(_blockBegin, _blockEnd, _pred);
+				if (_at != _blockEnd)
+				{
+					impl_algorithms_find::fetch_min(_found, _first + static_cast<size_t>(_at - _blockBegin));
+				};
+			});
+			return _begin + static_cast<difference_type>(_found.load(std::memory_order_relaxed));
+		};
+	};
 
 
 
 	/**
-	 * @brief Returns an iterator the value specified if it exists
+	 * @brief Returns an iterator the value specified if it exists.
+	 * 
+	 * Contiguous ranges of 1, 2 and 4 byte integers and enums are searched using memchr or a vectorizable block loop
+	 * outside of constant evaluation.
+	 * 
 	 * @tparam RangeT Range object type to look in
 	 * @tparam T Value type
 	 * @param _range Range to look in
@@ -185,7 +1145,8 @@ namespace jc
 		>
 #endif
 	{
-		return std::find(jc::begin(_range), jc::end(_range), _val);
+		return impl_algorithms_find::find(_range, _val,
+			jc::bool_constant<impl_algorithms_find::is_fast_findable<RangeT, T>::value>{});
 	};
 
 	/**
@@ -214,11 +1175,301 @@ namespace jc
 		>
 #endif
 	{
-		return std::find_if(jc::begin(_range), jc::end(_range), std::forward<OpT>(_pred));
+		if (JCLIB_ALGORITHM_H_USE_RUNTIME_IMPL())
+		{
+			return std::find_if(jc::begin(_range), jc::end(_range), std::forward<OpT>(_pred));
+		};
+		return impl_algorithms_find::find_if_scalar(jc::begin(_range), jc::end(_range), _pred);
 	};
 
-
-
+	/**
+	 * @brief Returns an iterator to the first element a predicate returns true for, the range may be searched in
+	 * parallel depending on the execution policy.
+	 * 
+	 * Parallel searches split the range into blocks, once a match is found the blocks after it are skipped. The first
+	 * match by position is always returned.
+	 * 
+	 * @param _policy Execution policy, see jclib/execution.h
+	 * @param _range Range to look in
+	 * @param _pred Predicate, may be invoked concurrently from several threads
+	 * @return Iterator to the found element or jc::end(_range) if it wasn't found
+	*/
+	template <typename PolicyT, typename RangeT, typename OpT>
+	JCLIB_REQUIRES
+	((
+		jc::execution::is_execution_policy<PolicyT>::value &&
+		jc::cx_range<RangeT> &&
+		std::is_invocable_r_v<bool, OpT, jc::ranges::const_reference_t<RangeT>>
+	))
+	inline auto find_if(PolicyT&& _policy, RangeT&& _range, OpT&& _pred) ->
+		JCLIB_RET_SFINAE_CXSWITCH
+		(
+			ranges::iterator_t<remove_reference_t<RangeT>>,
+			jc::execution::is_execution_policy<PolicyT>::value && jc::ranges::is_range<jc::remove_reference_t<RangeT>>::value
+		)
+	{
+		return impl_algorithms_find::find_if(impl::execution_pool(_policy), jc::begin(_range), jc::end(_range), _pred,
+			jc::bool_constant<jc::ranges::is_contiguous_range<jc::remove_reference_t<RangeT>>::value>{});
+	};
+
+
+
+	// Implementation of copy and fill, contiguous ranges of trivially copyable elements are handed to memmove/memset
+	// directly instead of relying on the compiler to see through wrapping iterators such as span_iterator
+	namespace impl_algorithms_bulk
+	{
+		/**
+		 * @brief Buffers smaller than this many bytes are written with regular stores by the non-temporal algorithms,
+		 * streaming only pays off once the buffer would evict most of the cache anyways
+		*/
+		constexpr size_t nontemporal_threshold = 256 * 1024;
+
+		/**
+		 * @brief Gets the element type pointed to by a range's address
+		*/
+		template <typename RangeT>
+		using address_element_t = std::remove_pointer_t<decltype(impl_algorithms_contiguous::range_address(std::declval<RangeT&>()))>;
+
+		/**
+		 * @brief Type trait checking if a range can be copied into a destination iterator by copying its bytes
+		*/
+		template <typename RangeT, typename DestIterT, typename Enable = void>
+		struct is_bulk_copyable : jc::false_type {};
+
+		template <typename RangeT, typename DestIterT>
+		struct is_bulk_copyable<RangeT, DestIterT, jc::enable_if_t<
+			impl_algorithms_contiguous::is_address_range<RangeT>::value &&
+			impl_algorithms_contiguous::is_pointer_iterator<DestIterT>::value
+		>> : jc::bool_constant<
+			jc::is_same<jc::remove_cv_t<address_element_t<RangeT>>, std::remove_pointer_t<decltype(impl_algorithms_contiguous::to_address(std::declval<const DestIterT&>()))>>::value &&
+			std::is_trivially_copyable<jc::remove_cv_t<address_element_t<RangeT>>>::value
+		> {};
+
+		/**
+		 * @brief Type trait checking if a range's elements can be accessed through a pointer and written directly.
+		 * Only scalar elements are filled bytewise so that converting the value can't differ from assigning it.
+		*/
+		template <typename RangeT, typename Enable = void>
+		struct is_bulk_fillable : jc::false_type {};
+
+		template <typename RangeT>
+		struct is_bulk_fillable<RangeT, jc::enable_if_t<impl_algorithms_contiguous::is_address_range<RangeT>::value>> :
+			jc::bool_constant<std::is_scalar<address_element_t<RangeT>>::value && !std::is_const<address_element_t<RangeT>>::value>
+		{};
+
+		/**
+		 * @brief Checks if every byte of a value's representation is the same, allowing it to be filled using memset
+		 * @param _value Value to check
+		 * @param _byte Set to the repeated byte if true is returned
+		 * @return True if all bytes are equal, false otherwise
+		*/
+		template <typename T>
+		inline bool is_repeated_byte(const T& _value, unsigned char& _byte) noexcept
+		{
+			unsigned char _bytes[sizeof(T)];
+			std::memcpy(_bytes, &_value, sizeof(T));
+			for (size_t n = 1; n != sizeof(T); ++n)
+			{
+				if (_bytes[n] != _bytes[0])
+				{
+					return false;
+				};
+			};
+			_byte = _bytes[0];
+			return true;
+		};
+
+		/**
+		 * @brief Copies bytes using non-temporal stores for large buffers, the buffers must not overlap
+		*/
+		inline void stream_copy_bytes(unsigned char* _to, const unsigned char* _from, size_t _bytes) noexcept
+		{
+#if JCLIB_ALGORITHM_H_SSE2_V
+			if (_bytes >= nontemporal_threshold)
+			{
+				// Streaming stores must be aligned
+				const size_t _head = (16 - (reinterpret_cast<uintptr_t>(_to) & 15)) & 15;
+				std::memcpy(_to, _from, _head);
+				_to += _head;
+				_from += _head;
+				_bytes -= _head;
+
+				for (; _bytes >= 64; _bytes -= 64, _to += 64, _from += 64)
+				{
+					const auto _a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_from));
+					const auto _b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_from + 16));
+					const auto _c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_from + 32));
+					const auto _d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_from + 48));
+					_mm_stream_si128(reinterpret_cast<__m128i*>(_to), _a);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(_to + 16), _b);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(_to + 32), _c);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(_to + 48), _d);
+				};
+
+				// Order the streaming stores before anything written afterwards
+				_mm_sfence();
+			};
+#endif
+			std::memcpy(_to, _from, _bytes);
+		};
+
+		/**
+		 * @brief Fills elements using non-temporal stores for large buffers
+		*/
+		template <typename T>
+		inline void stream_fill(T* _to, const T& _value, size_t _count) noexcept
+		{
+#if JCLIB_ALGORITHM_H_SSE2_V
+			// The value must tile a 16 byte store exactly
+			if (16 % sizeof(T) == 0 && _count * sizeof(T) >= nontemporal_threshold)
+			{
+				// Two stores worth of the value's bytes, loading from an offset into this gives the store pattern
+				// for any position within an element
+				unsigned char _pattern[32];
+				for (size_t n = 0; n != sizeof(_pattern); n += sizeof(T))
+				{
+					std::memcpy(_pattern + n, &_value, sizeof(T));
+				};
+
+				auto _at = reinterpret_cast<unsigned char*>(_to);
+				auto _bytes = _count * sizeof(T);
+
+				// Streaming stores must be aligned
+				const size_t _head = (16 - (reinterpret_cast<uintptr_t>(_at) & 15)) & 15;
+				std::memcpy(_at, _pattern, _head);
+				_at += _head;
+				_bytes -= _head;
+
+				const unsigned char* const _phase = _pattern + (_head % sizeof(T));
+				const auto _store = _mm_loadu_si128(reinterpret_cast<const __m128i*>(_phase));
+				for (; _bytes >= 64; _bytes -= 64, _at += 64)
+				{
+					_mm_stream_si128(reinterpret_cast<__m128i*>(_at), _store);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(_at + 16), _store);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(_at + 32), _store);
+					_mm_stream_si128(reinterpret_cast<__m128i*>(_at + 48), _store);
+				};
+
+				// Order the streaming stores before anything written afterwards
+				_mm_sfence();
+
+				for (; _bytes >= 16; _bytes -= 16, _at += 16)
+				{
+					std::memcpy(_at, _phase, 16);
+				};
+				std::memcpy(_at, _phase, _bytes);
+				return;
+			};
+#endif
+			std::fill(_to, _to + _count, _value);
+		};
+
+		/**
+		 * @brief Copy implementation for ranges which can't be copied bytewise
+		*/
+		template <typename RangeT, typename DestIterT>
+		inline DestIterT copy(const RangeT& _source, DestIterT _destBegin, jc::false_type, jc::false_type)
+		{
+			return std::copy(jc::begin(_source), jc::end(_source), _destBegin);
+		};
+
+		/**
+		 * @brief Copies the source range's bytes using memmove, or streaming stores if requested
+		*/
+		template <typename RangeT, typename DestIterT, bool Stream>
+		inline DestIterT copy(const RangeT& _source, DestIterT _destBegin, jc::true_type, jc::bool_constant<Stream>)
+		{
+			const auto _count = jc::end(_source) - jc::begin(_source);
+			if (_count == 0)
+			{
+				return _destBegin;
+			};
+
+			const auto _from = impl_algorithms_contiguous::range_address(_source);
+			const auto _to = impl_algorithms_contiguous::to_address(_destBegin);
+			const size_t _bytes = static_cast<size_t>(_count) * sizeof(*_from);
+			if (Stream)
+			{
+				impl_algorithms_bulk::stream_copy_bytes(reinterpret_cast<unsigned char*>(_to),
+					reinterpret_cast<const unsigned char*>(_from), _bytes);
+			}
+			else
+			{
+				std::memmove(_to, _from, _bytes);
+			};
+			_destBegin += _count;
+			return _destBegin;
+		};
+
+		/**
+		 * @brief Copy implementation for ranges which can't be copied bytewise, streaming doesn't apply
+		*/
+		template <typename RangeT, typename DestIterT>
+		inline DestIterT copy(const RangeT& _source, DestIterT _destBegin, jc::false_type, jc::true_type)
+		{
+			return impl_algorithms_bulk::copy(_source, std::move(_destBegin), jc::false_type{}, jc::false_type{});
+		};
+
+		/**
+		 * @brief Fill implementation for ranges which can't be written through a pointer
+		*/
+		template <typename RangeT, typename ValT, bool Stream>
+		inline void fill(RangeT& _range, const ValT& _value, jc::false_type, jc::bool_constant<Stream>)
+		{
+			std::fill(jc::begin(_range), jc::end(_range), _value);
+		};
+
+		/**
+		 * @brief Fills a range through a pointer, using memset if the value is a single repeated byte
+		*/
+		template <typename RangeT, typename ValT, bool Stream>
+		inline void fill(RangeT& _range, const ValT& _value, jc::true_type, jc::bool_constant<Stream>)
+		{
+			const auto _count = static_cast<size_t>(jc::end(_range) - jc::begin(_range));
+			if (_count == 0)
+			{
+				return;
+			};
+
+			const auto _to = impl_algorithms_contiguous::range_address(_range);
+			using element_type = std::remove_pointer_t<decltype(_to)>;
+
+			// Assigned rather than converted to match the semantics of the generic fill
+			element_type _element{};
+			_element = _value;
+
+			if (Stream)
+			{
+				impl_algorithms_bulk::stream_fill(_to, _element, _count);
+				return;
+			};
+
+			unsigned char _byte = 0;
+			if (impl_algorithms_bulk::is_repeated_byte(_element, _byte))
+			{
+				std::memset(_to, _byte, _count * sizeof(element_type));
+			}
+			else
+			{
+				std::fill(_to, _to + _count, _element);
+			};
+		};
+	};
+
+
+
+	/**
+	 * @brief Assigns a value to every element in a range.
+	 * 
+	 * Outside of constant evaluation, contiguous ranges of scalars (including spans and borrow_ptr iterated ranges) are filled
+	 * through a pointer, using memset when the value is a single repeated byte.
+	 * 
+	 * @tparam RangeT Range object type to fill
+	 * @tparam ValT Value type
+	 * @param _range Range to fill
+	 * @param _value Value to assign to each element
+	 * @return The range
+	*/
 	template <typename RangeT, typename ValT = jc::ranges::value_t<RangeT>>
 	JCLIB_REQUIRES
 	((
@@ -239,22 +1490,45 @@ namespace jc
 		>
 #endif
 	{
-		std::fill(jc::begin(_range), jc::end(_range), _value);
+		if (JCLIB_ALGORITHM_H_USE_RUNTIME_IMPL())
+		{
+			impl_algorithms_bulk::fill(_range, _value,
+				jc::bool_constant<impl_algorithms_bulk::is_bulk_fillable<RangeT>::value>{}, jc::false_type{});
+		}
+		else
+		{
+			for (auto _at = jc::begin(_range); _at != jc::end(_range); ++_at)
+			{
+				*_at = _value;
+			};
+		};
 		return _range;
 	};
 
 
+	/**
+	 * @brief Copies the elements of a range into a destination iterator.
+	 * 
+	 * Outside of constant evaluation, contiguous ranges of trivially copyable elements are copied with memmove when
+	 * the destination is a pointer, span iterator or borrow_ptr to the same type.
+	 * 
+	 * @tparam RangeT Source range object type
+	 * @tparam DestIterT Destination iterator type
+	 * @param _source Range to copy from
+	 * @param _destBegin Iterator to the first element to copy into
+	 * @return Iterator one past the last element copied into
+	*/
 	template <typename RangeT, typename DestIterT>
 	JCLIB_REQUIRES
 	((
 		jc::cx_range<RangeT> &&
-		jc::is_assignable_v<jc::iterator_to_t<DestIterT>, jc::ranges::const_reference_t<RangeT>>
+		jc::is_assignable_v<decltype(*std::declval<DestIterT&>()), jc::ranges::const_reference_t<RangeT>>
 	))
 	constexpr inline auto copy(const RangeT& _source, DestIterT _destBegin) ->
 #if !JCLIB_FEATURE_CONCEPTS_V
 		jc::enable_if_t<
 			jc::is_assignable<
-				/* to   */ jc::iterator_to_t<DestIterT>, // *DestIterT
+				/* to   */ decltype(*std::declval<DestIterT&>()), // *DestIterT
 				/* from */ std::add_lvalue_reference_t<std::add_const_t<jc::ranges::value_t<RangeT>>> // const RangeT::value_type&
 			>::value &&
 			jc::ranges::is_range<RangeT>::value,
@@ -264,7 +1538,56 @@ namespace jc
 		>
 #endif
 	{
-		return std::copy(jc::begin(_source), jc::end(_source), _destBegin);
+		if (JCLIB_ALGORITHM_H_USE_RUNTIME_IMPL())
+		{
+			return impl_algorithms_bulk::copy(_source, std::move(_destBegin),
+				jc::bool_constant<impl_algorithms_bulk::is_bulk_copyable<const RangeT, DestIterT>::value>{}, jc::false_type{});
+		};
+		for (auto _at = jc::begin(_source); _at != jc::end(_source); ++_at, ++_destBegin)
+		{
+			*_destBegin = *_at;
+		};
+		return _destBegin;
+	};
+
+	/**
+	 * @brief Assigns a value to every element in a range, bypassing the cache for very large buffers.
+	 * 
+	 * Contiguous ranges of scalars larger than a few hundred kilobytes are written with non-temporal stores where the
+	 * platform supports them. Use this for buffers which won't be read again soon, otherwise prefer jc::fill.
+	 * 
+	 * @tparam RangeT Range object type to fill
+	 * @tparam ValT Value type
+	 * @param _range Range to fill
+	 * @param _value Value to assign to each element
+	 * @return The range
+	*/
+	template <typename RangeT, typename ValT = jc::ranges::value_t<RangeT>>
+	inline auto fill_nontemporal(RangeT& _range, const ValT& _value) -> decltype(jc::fill(_range, _value))
+	{
+		impl_algorithms_bulk::fill(_range, _value,
+			jc::bool_constant<impl_algorithms_bulk::is_bulk_fillable<RangeT>::value>{}, jc::true_type{});
+		return _range;
+	};
+
+	/**
+	 * @brief Copies the elements of a range into a destination iterator, bypassing the cache for very large buffers.
+	 * 
+	 * Contiguous ranges of trivially copyable elements larger than a few hundred kilobytes are written with
+	 * non-temporal stores where the platform supports them. Unlike jc::copy, the source and destination must not
+	 * overlap.
+	 * 
+	 * @tparam RangeT Source range object type
+	 * @tparam DestIterT Destination iterator type
+	 * @param _source Range to copy from
+	 * @param _destBegin Iterator to the first element to copy into
+	 * @return Iterator one past the last element copied into
+	*/
+	template <typename RangeT, typename DestIterT>
+	inline auto copy_nontemporal(const RangeT& _source, DestIterT _destBegin) -> decltype(jc::copy(_source, _destBegin))
+	{
+		return impl_algorithms_bulk::copy(_source, std::move(_destBegin),
+			jc::bool_constant<impl_algorithms_bulk::is_bulk_copyable<const RangeT, DestIterT>::value>{}, jc::true_type{});
 	};
 
 
@@ -313,6 +1636,958 @@ namespace jc
 		return jc::find_if(_source, std::forward<PredT>(_pred)) != jc::end(_source);
 	};
 
+	/**
+	 * @brief Checks if a predicate returns true for any element of a range, the range may be searched in parallel
+	 * depending on the execution policy, see the parallel jc::find_if.
+	 * 
+	 * @param _policy Execution policy, see jclib/execution.h
+	 * @param _source Range to look in
+	 * @param _pred Predicate, may be invoked concurrently from several threads
+	 * @return True if the predicate returned true for an element, false otherwise
+	*/
+	template <typename PolicyT, typename RangeT, typename PredT>
+	JCLIB_REQUIRES
+	((
+		jc::execution::is_execution_policy<PolicyT>::value &&
+		jc::cx_range<RangeT> &&
+		std::is_invocable_r_v<bool, PredT, jc::ranges::const_reference_t<RangeT>>
+	))
+	inline auto contains_if(PolicyT&& _policy, const RangeT& _source, PredT&& _pred) ->
+		JCLIB_RET_SFINAE_CXSWITCH
+		(
+			bool,
+			jc::execution::is_execution_policy<PolicyT>::value && jc::ranges::is_range<RangeT>::value
+		)
+	{
+		return jc::find_if(std::forward<PolicyT>(_policy), _source, std::forward<PredT>(_pred)) != jc::end(_source);
+	};
+
+
+
+	// Implementation of the sort family. The comparison sorts require random access iterators, the out of place
+	// parallel merge sort and radix sort also need a scratch buffer of default constructible elements.
+	namespace impl_algorithms_sort
+	{
+		/**
+		 * @brief Ranges this short are finished off with insertion sort
+		*/
+		constexpr size_t insertion_threshold = 16;
+
+		/**
+		 * @brief Minimum number of elements per chunk or merge task before sorting in parallel
+		*/
+		constexpr size_t parallel_sort_grain = 1 << 14;
+
+		/**
+		 * @brief Swaps two values, std::swap isn't constexpr before C++20
+		*/
+		template <typename T>
+		constexpr inline void swap_values(T& _lhs, T& _rhs)
+		{
+			T _temp = std::move(_lhs);
+			_lhs = std::move(_rhs);
+			_rhs = std::move(_temp);
+		};
+
+		/**
+		 * @brief Stable insertion sort, only moves an element past its neighbour if it compares less
+		*/
+		template <typename IterT, typename CompareT>
+		constexpr inline void insertion_sort(const IterT _begin, const IterT _end, CompareT& _compare)
+		{
+			if (_begin == _end)
+			{
+				return;
+			};
+			for (auto _at = _begin + 1; _at != _end; ++_at)
+			{
+				for (auto _hole = _at; _hole != _begin && jc::invoke(_compare, *_hole, *(_hole - 1)); --_hole)
+				{
+					impl_algorithms_sort::swap_values(*_hole, *(_hole - 1));
+				};
+			};
+		};
+
+		/**
+		 * @brief Restores the max heap property for the subtree rooted at an index
+		*/
+		template <typename IterT, typename CompareT>
+		constexpr inline void sift_down(const IterT _begin, size_t _root, const size_t _count, CompareT& _compare)
+		{
+			using difference_type = decltype(_begin - _begin);
+			while (true)
+			{
+				size_t _child = _root * 2 + 1;
+				if (_child >= _count)
+				{
+					break;
+				};
+				if (_child + 1 < _count &&
+					jc::invoke(_compare, *(_begin + static_cast<difference_type>(_child)), *(_begin + static_cast<difference_type>(_child + 1))))
+				{
+					++_child;
+				};
+				auto& _parentValue = *(_begin + static_cast<difference_type>(_root));
+				auto& _childValue = *(_begin + static_cast<difference_type>(_child));
+				if (!jc::invoke(_compare, _parentValue, _childValue))
+				{
+					break;
+				};
+				impl_algorithms_sort::swap_values(_parentValue, _childValue);
+				_root = _child;
+			};
+		};
+
+		/**
+		 * @brief Heap sort, the introsort fallback once partitioning has gone too deep
+		*/
+		template <typename IterT, typename CompareT>
+		constexpr inline void heap_sort(const IterT _begin, const IterT _end, CompareT& _compare)
+		{
+			using difference_type = decltype(_end - _begin);
+			const size_t _count = static_cast<size_t>(_end - _begin);
+			for (size_t n = _count / 2; n != 0; --n)
+			{
+				impl_algorithms_sort::sift_down(_begin, n - 1, _count, _compare);
+			};
+			for (size_t n = _count; n > 1; --n)
+			{
+				impl_algorithms_sort::swap_values(*_begin, *(_begin + static_cast<difference_type>(n - 1)));
+				impl_algorithms_sort::sift_down(_begin, 0, n - 1, _compare);
+			};
+		};
+
+		/**
+		 * @brief Introsort, quicksort with a median of three pivot which falls back to heap sort after too many
+		 * levels of partitioning. Used for sorting during constant evaluation.
+		 * @param _depth Remaining partitioning depth before falling back to heap sort
+		*/
+		template <typename IterT, typename CompareT>
+		constexpr inline void introsort(IterT _begin, IterT _end, CompareT& _compare, size_t _depth)
+		{
+			while (static_cast<size_t>(_end - _begin) > insertion_threshold)
+			{
+				if (_depth == 0)
+				{
+					impl_algorithms_sort::heap_sort(_begin, _end, _compare);
+					return;
+				};
+				--_depth;
+
+				// Order the first, middle and last elements then move the median to the front as the pivot. The
+				// smallest and largest of the three act as sentinels for the partitioning scans.
+				const auto _mid = _begin + (_end - _begin) / 2;
+				const auto _last = _end - 1;
+				if (jc::invoke(_compare, *_mid, *_begin))
+				{
+					impl_algorithms_sort::swap_values(*_mid, *_begin);
+				};
+				if (jc::invoke(_compare, *_last, *_mid))
+				{
+					impl_algorithms_sort::swap_values(*_last, *_mid);
+					if (jc::invoke(_compare, *_mid, *_begin))
+					{
+						impl_algorithms_sort::swap_values(*_mid, *_begin);
+					};
+				};
+				impl_algorithms_sort::swap_values(*_begin, *_mid);
+
+				// Hoare partition, elements equal to the pivot stop both scans so duplicates split evenly
+				auto _left = _begin;
+				auto _right = _end;
+				while (true)
+				{
+					do
+					{
+						++_left;
+					} while (jc::invoke(_compare, *_left, *_begin));
+					do
+					{
+						--_right;
+					} while (jc::invoke(_compare, *_begin, *_right));
+					if (!(_left < _right))
+					{
+						break;
+					};
+					impl_algorithms_sort::swap_values(*_left, *_right);
+				};
+				impl_algorithms_sort::swap_values(*_begin, *_right);
+
+				// Recurse into the smaller side so the stack depth stays logarithmic
+				if (_right - _begin < _end - (_right + 1))
+				{
+					impl_algorithms_sort::introsort(_begin, _right, _compare, _depth);
+					_begin = _right + 1;
+				}
+				else
+				{
+					impl_algorithms_sort::introsort(_right + 1, _end, _compare, _depth);
+					_end = _right;
+				};
+			};
+			impl_algorithms_sort::insertion_sort(_begin, _end, _compare);
+		};
+
+		/**
+		 * @brief Gets the introsort depth limit for a number of elements, twice the base 2 logarithm
+		*/
+		constexpr inline size_t introsort_depth(size_t _count) noexcept
+		{
+			size_t _depth = 0;
+			for (; _count > 1; _count /= 2)
+			{
+				_depth += 2;
+			};
+			return _depth;
+		};
+
+		/**
+		 * @brief Allocates scratch space for the out of place sorts, trivial elements are left uninitialized
+		*/
+		template <typename T>
+		inline std::unique_ptr<T[]> make_buffer(size_t _count)
+		{
+			return std::unique_ptr<T[]>(new T[_count]);
+		};
+
+		/**
+		 * @brief Type trait checking if a range's elements can be sorted out of place through a scratch buffer
+		*/
+		template <typename T>
+		struct is_bufferable : jc::bool_constant<
+			std::is_default_constructible<T>::value && std::is_move_assignable<T>::value
+		> {};
+
+		/**
+		 * @brief Finds how many elements of the first run are among the first elements of the stable merge of two
+		 * sorted runs, elements of the first run are placed before equivalent elements of the second
+		 * @param _diagonal Number of merged elements
+		*/
+		template <typename IterT, typename CompareT>
+		inline size_t merge_path(IterT _first, size_t _firstCount, IterT _second, size_t _secondCount, size_t _diagonal, CompareT& _compare)
+		{
+			using difference_type = decltype(_first - _first);
+			size_t _low = (_diagonal > _secondCount) ? _diagonal - _secondCount : 0;
+			size_t _high = (_diagonal < _firstCount) ? _diagonal : _firstCount;
+			while (_low < _high)
+			{
+				const size_t _mid = _low + (_high - _low) / 2;
+				if (!jc::invoke(_compare, *(_second + static_cast<difference_type>(_diagonal - 1 - _mid)), *(_first + static_cast<difference_type>(_mid))))
+				{
+					_low = _mid + 1;
+				}
+				else
+				{
+					_high = _mid;
+				};
+			};
+			return _low;
+		};
+
+		/**
+		 * @brief Merges neighbouring pairs of sorted runs into the destination, each merge is split into pieces
+		 * along its merge path so every round runs across the whole thread pool
+		 * @param _runs Boundaries of the sorted runs, updated to the boundaries of the merged runs
+		*/
+		template <typename FromT, typename ToT, typename CompareT>
+		inline void merge_round(jc::thread_pool& _pool, FromT _from, ToT _to, std::vector<size_t>& _runs, CompareT& _compare)
+		{
+			using from_difference_type = decltype(_from - _from);
+			using to_difference_type = decltype(_to - _to);
+
+			// A piece of one merge, an odd run at the end is "merged" with an empty run
+			struct merge_task
+			{
+				size_t first;
+				size_t middle;
+				size_t last;
+				size_t begin_diagonal;
+				size_t end_diagonal;
+			};
+
+			std::vector<merge_task> _tasks{};
+			std::vector<size_t> _merged{ 0 };
+			for (size_t n = 0; n + 1 < _runs.size(); n += 2)
+			{
+				const size_t _first = _runs[n];
+				const size_t _middle = _runs[n + 1];
+				const size_t _last = (n + 2 < _runs.size()) ? _runs[n + 2] : _middle;
+				const size_t _count = _last - _first;
+				const size_t _pieces = (_count / parallel_sort_grain != 0) ? _count / parallel_sort_grain : 1;
+				for (size_t p = 0; p != _pieces; ++p)
+				{
+					_tasks.push_back(merge_task{ _first, _middle, _last, (_count * p) / _pieces, (_count * (p + 1)) / _pieces });
+				};
+				_merged.push_back(_last);
+			};
+
+			_pool.for_each_index(_tasks.size(), [&](size_t _index)
+			{
+				const auto& _task = _tasks[_index];
+				const auto _firstRun = _from + static_cast<from_difference_type>(_task.first);
+				const auto _secondRun = _from + static_cast<from_difference_type>(_task.middle);
+				const size_t _firstCount = _task.middle - _task.first;
+				const size_t _secondCount = _task.last - _task.middle;
+
+				const size_t _beginFirst = impl_algorithms_sort::merge_path(_firstRun, _firstCount, _secondRun, _secondCount, _task.begin_diagonal, _compare);
+				const size_t _endFirst = impl_algorithms_sort::merge_path(_firstRun, _firstCount, _secondRun, _secondCount, _task.end_diagonal, _compare);
+				const size_t _beginSecond = _task.begin_diagonal - _beginFirst;
+				const size_t _endSecond = _task.end_diagonal - _endFirst;
+
+				std::merge
+				(
+					std::make_move_iterator(_firstRun + static_cast<from_difference_type>(_beginFirst)),
+					std::make_move_iterator(_firstRun + static_cast<from_difference_type>(_endFirst)),
+					std::make_move_iterator(_secondRun + static_cast<from_difference_type>(_beginSecond)),
+					std::make_move_iterator(_secondRun + static_cast<from_difference_type>(_endSecond)),
+					_to + static_cast<to_difference_type>(_task.first + _task.begin_diagonal),
+					_compare
+				);
+			});
+
+			_runs = std::move(_merged);
+		};
+
+		/**
+		 * @brief Moves elements between two random access ranges across a thread pool
+		*/
+		template <typename FromT, typename ToT>
+		inline void parallel_move(jc::thread_pool* _pool, FromT _from, ToT _to, size_t _count)
+		{
+			using from_difference_type = decltype(_from - _from);
+			using to_difference_type = decltype(_to - _to);
+
+			const size_t _chunks = impl::execution_chunk_count(_pool, _count, parallel_sort_grain);
+			if (_chunks <= 1)
+			{
+				std::move(_from, _from + static_cast<from_difference_type>(_count), _to);
+				return;
+			};
+			impl::execution_for_each_chunk(*_pool, _count, _chunks, [&](size_t, size_t _first, size_t _last)
+			{
+				std::move(_from + static_cast<from_difference_type>(_first), _from + static_cast<from_difference_type>(_last),
+					_to + static_cast<to_difference_type>(_first));
+			});
+		};
+
+		/**
+		 * @brief Sort for elements which can't be buffered, always sequential
+		*/
+		template <typename IterT, typename CompareT>
+		inline void parallel_sort(jc::thread_pool*, IterT _begin, IterT _end, CompareT& _compare, jc::false_type)
+		{
+			std::sort(_begin, _end, _compare);
+		};
+
+		/**
+		 * @brief Parallel merge sort, chunks of the range are sorted across the thread pool then merged in rounds
+		 * alternating between the range and a scratch buffer
+		*/
+		template <typename IterT, typename CompareT>
+		inline void parallel_sort(jc::thread_pool* _pool, IterT _begin, IterT _end, CompareT& _compare, jc::true_type)
+		{
+			using difference_type = decltype(_end - _begin);
+			using value_type = jc::remove_cvref_t<decltype(*_begin)>;
+
+			const size_t _count = static_cast<size_t>(_end - _begin);
+			const size_t _chunks = impl::execution_chunk_count(_pool, _count, parallel_sort_grain);
+			if (_chunks <= 1)
+			{
+				std::sort(_begin, _end, _compare);
+				return;
+			};
+
+			std::vector<size_t> _runs(_chunks + 1, 0);
+			impl::execution_for_each_chunk(*_pool, _count, _chunks, [&](size_t _chunk, size_t _first, size_t _last)
+			{
+				std::sort(_begin + static_cast<difference_type>(_first), _begin + static_cast<difference_type>(_last), _compare);
+				_runs[_chunk + 1] = _last;
+			});
+
+			const auto _buffer = impl_algorithms_sort::make_buffer<value_type>(_count);
+			bool _inBuffer = false;
+			while (_runs.size() > 2)
+			{
+				if (_inBuffer)
+				{
+					impl_algorithms_sort::merge_round(*_pool, _buffer.get(), _begin, _runs, _compare);
+				}
+				else
+				{
+					impl_algorithms_sort::merge_round(*_pool, _begin, _buffer.get(), _runs, _compare);
+				};
+				_inBuffer = !_inBuffer;
+			};
+
+			if (_inBuffer)
+			{
+				impl_algorithms_sort::parallel_move(_pool, _buffer.get(), _begin, _count);
+			};
+		};
+
+
+
+		/**
+		 * @brief Number of buckets per radix sort pass, one per value of a byte
+		*/
+		constexpr size_t radix_bucket_count = 256;
+
+		/**
+		 * @brief Ranges this short are insertion sorted by their keys instead
+		*/
+		constexpr size_t radix_insertion_threshold = 64;
+
+		/**
+		 * @brief Minimum number of elements per chunk before radix sorting in parallel
+		*/
+		constexpr size_t radix_parallel_grain = 1 << 16;
+
+		/**
+		 * @brief Type trait checking if a key type can be radix sorted, floating point keys must be IEEE-754
+		*/
+		template <typename K>
+		struct is_radix_key : jc::bool_constant<
+			(std::is_integral<K>::value && !jc::is_same<K, bool>::value) ||
+			(std::is_floating_point<K>::value && (sizeof(K) == 4 || sizeof(K) == 8) && std::numeric_limits<K>::is_iec559)
+		> {};
+
+		/**
+		 * @brief Unsigned integer type with the same size as a key
+		*/
+		template <typename K>
+		using radix_bits_t = std::conditional_t<sizeof(K) == 1, uint8_t,
+			std::conditional_t<sizeof(K) == 2, uint16_t,
+			std::conditional_t<sizeof(K) == 4, uint32_t, uint64_t>>>;
+
+		/**
+		 * @brief Maps an integer key to an unsigned integer with the same ordering by flipping the sign bit
+		*/
+		template <typename K>
+		inline auto radix_bits(K _key) noexcept -> jc::enable_if_t<std::is_integral<K>::value, radix_bits_t<K>>
+		{
+			using bits_type = radix_bits_t<K>;
+			const auto _sign = static_cast<bits_type>(std::is_signed<K>::value ? (bits_type(1) << (sizeof(K) * 8 - 1)) : 0);
+			return static_cast<bits_type>(static_cast<bits_type>(_key) ^ _sign);
+		};
+
+		/**
+		 * @brief Maps a floating point key to an unsigned integer with the same ordering, negative values have all
+		 * of their bits flipped and positive values their sign bit. -0 orders before +0 and NaNs order by their sign.
+		*/
+		template <typename K>
+		inline auto radix_bits(K _key) noexcept -> jc::enable_if_t<std::is_floating_point<K>::value, radix_bits_t<K>>
+		{
+			using bits_type = radix_bits_t<K>;
+			constexpr auto _sign = static_cast<bits_type>(bits_type(1) << (sizeof(K) * 8 - 1));
+
+			bits_type _bits = 0;
+			std::memcpy(&_bits, &_key, sizeof(K));
+			return static_cast<bits_type>((_bits & _sign) ? ~_bits : (_bits | _sign));
+		};
+
+		/**
+		 * @brief Gets the sortable key bits of an element using a projection
+		*/
+		template <typename ProjT>
+		struct radix_key
+		{
+			template <typename T>
+			auto operator()(T& _value) const -> decltype(impl_algorithms_sort::radix_bits(jc::invoke(std::declval<ProjT&>(), _value)))
+			{
+				return impl_algorithms_sort::radix_bits(jc::invoke(this->proj_, _value));
+			};
+
+			ProjT& proj_;
+		};
+
+		/**
+		 * @brief Type trait checking if a range can be radix sorted using a projection
+		*/
+		template <typename RangeT, typename ProjT, typename Enable = void>
+		struct is_radix_sortable : jc::false_type {};
+
+		template <typename RangeT, typename ProjT>
+		struct is_radix_sortable<RangeT, ProjT, jc::enable_if_t<
+			jc::ranges::is_range<RangeT>::value &&
+			jc::ranges::is_contiguous_range<RangeT>::value
+		>> : jc::bool_constant<
+			is_bufferable<jc::ranges::value_t<RangeT>>::value &&
+			is_radix_key<jc::remove_cvref_t<jc::invoke_result_t<ProjT&, jc::ranges::reference_t<RangeT>>>>::value
+		> {};
+
+		/**
+		 * @brief Counts the bucket of each element for every digit of their keys
+		*/
+		template <typename IterT, typename KeyT, size_t Passes>
+		inline void radix_histogram(IterT _at, const IterT _end, KeyT& _key, std::array<std::array<size_t, radix_bucket_count>, Passes>& _histogram)
+		{
+			for (; _at != _end; ++_at)
+			{
+				const auto _bits = _key(*_at);
+				for (size_t _pass = 0; _pass != Passes; ++_pass)
+				{
+					++_histogram[_pass][(_bits >> (_pass * 8)) & 0xFF];
+				};
+			};
+		};
+
+		/**
+		 * @brief Moves elements to their bucket for one digit
+		 * @param _offsets Next destination index for each bucket
+		*/
+		template <typename FromT, typename ToT, typename KeyT>
+		inline void radix_scatter(FromT _at, const FromT _end, ToT _to, KeyT& _key, size_t _shift, std::array<size_t, radix_bucket_count>& _offsets)
+		{
+			using difference_type = decltype(_to - _to);
+			for (; _at != _end; ++_at)
+			{
+				const auto _bucket = static_cast<size_t>((_key(*_at) >> _shift) & 0xFF);
+				*(_to + static_cast<difference_type>(_offsets[_bucket]++)) = std::move(*_at);
+			};
+		};
+
+		/**
+		 * @brief Runs one radix sort pass, chunks of the source are counted then scattered in parallel with each
+		 * chunk's elements placed after those of earlier chunks in the same bucket, keeping the sort stable
+		 * @param _total Counts of each bucket across the whole range
+		*/
+		template <typename FromT, typename ToT, typename KeyT>
+		inline void radix_pass(jc::thread_pool* _pool, size_t _chunks, FromT _from, ToT _to, size_t _count, KeyT& _key, size_t _shift,
+			const std::array<size_t, radix_bucket_count>& _total)
+		{
+			using difference_type = decltype(_from - _from);
+
+			std::array<size_t, radix_bucket_count> _starts{};
+			for (size_t b = 1; b != radix_bucket_count; ++b)
+			{
+				_starts[b] = _starts[b - 1] + _total[b - 1];
+			};
+
+			if (_chunks <= 1)
+			{
+				impl_algorithms_sort::radix_scatter(_from, _from + static_cast<difference_type>(_count), _to, _key, _shift, _starts);
+				return;
+			};
+
+			std::vector<std::array<size_t, radix_bucket_count>> _offsets(_chunks);
+			impl::execution_for_each_chunk(*_pool, _count, _chunks, [&](size_t _chunk, size_t _first, size_t _last)
+			{
+				auto& _counts = _offsets[_chunk];
+				_counts.fill(0);
+				const auto _end = _from + static_cast<difference_type>(_last);
+				for (auto _at = _from + static_cast<difference_type>(_first); _at != _end; ++_at)
+				{
+					++_counts[static_cast<size_t>((_key(*_at) >> _shift) & 0xFF)];
+				};
+			});
+
+			// Turn the counts into each chunk's starting index within each bucket
+			for (size_t b = 0; b != radix_bucket_count; ++b)
+			{
+				size_t _next = _starts[b];
+				for (auto& _chunkOffsets : _offsets)
+				{
+					const size_t _chunkCount = _chunkOffsets[b];
+					_chunkOffsets[b] = _next;
+					_next += _chunkCount;
+				};
+			};
+
+			impl::execution_for_each_chunk(*_pool, _count, _chunks, [&](size_t _chunk, size_t _first, size_t _last)
+			{
+				impl_algorithms_sort::radix_scatter(_from + static_cast<difference_type>(_first), _from + static_cast<difference_type>(_last),
+					_to, _key, _shift, _offsets[_chunk]);
+			});
+		};
+
+		/**
+		 * @brief LSD radix sort one byte of the key at a time, passes where every element shares the same digit are
+		 * skipped
+		*/
+		template <typename IterT, typename ProjT>
+		inline void radix_sort(jc::thread_pool* _pool, const IterT _begin, const IterT _end, ProjT& _proj)
+		{
+			using difference_type = decltype(_end - _begin);
+			using value_type = jc::remove_cvref_t<decltype(*_begin)>;
+			using bits_type = decltype(impl_algorithms_sort::radix_key<ProjT>{ _proj }(*_begin));
+			constexpr size_t passes = sizeof(bits_type);
+
+			auto _key = radix_key<ProjT>{ _proj };
+			const size_t _count = static_cast<size_t>(_end - _begin);
+			if (_count < radix_insertion_threshold)
+			{
+				auto _compare = [&_key](value_type& _lhs, value_type& _rhs) { return _key(_lhs) < _key(_rhs); };
+				impl_algorithms_sort::insertion_sort(_begin, _end, _compare);
+				return;
+			};
+
+			// Count every digit up front so passes which wouldn't move anything can be skipped
+			using histogram_type = std::array<std::array<size_t, radix_bucket_count>, passes>;
+			const size_t _chunks = impl::execution_chunk_count(_pool, _count, radix_parallel_grain);
+			std::vector<histogram_type> _histograms(_chunks, histogram_type{});
+			if (_chunks <= 1)
+			{
+				impl_algorithms_sort::radix_histogram(_begin, _end, _key, _histograms.front());
+			}
+			else
+			{
+				impl::execution_for_each_chunk(*_pool, _count, _chunks, [&](size_t _chunk, size_t _first, size_t _last)
+				{
+					impl_algorithms_sort::radix_histogram(_begin + static_cast<difference_type>(_first), _begin + static_cast<difference_type>(_last),
+						_key, _histograms[_chunk]);
+				});
+				for (size_t c = 1; c != _chunks; ++c)
+				{
+					for (size_t _pass = 0; _pass != passes; ++_pass)
+					{
+						for (size_t b = 0; b != radix_bucket_count; ++b)
+						{
+							_histograms.front()[_pass][b] += _histograms[c][_pass][b];
+						};
+					};
+				};
+			};
+			const auto& _total = _histograms.front();
+
+			std::unique_ptr<value_type[]> _buffer{};
+			bool _inBuffer = false;
+			for (size_t _pass = 0; _pass != passes; ++_pass)
+			{
+				const auto& _counts = _total[_pass];
+				if (std::find(_counts.begin(), _counts.end(), _count) != _counts.end())
+				{
+					continue;
+				};
+				if (!_buffer)
+				{
+					_buffer = impl_algorithms_sort::make_buffer<value_type>(_count);
+				};
+
+				if (_inBuffer)
+				{
+					impl_algorithms_sort::radix_pass(_pool, _chunks, _buffer.get(), _begin, _count, _key, _pass * 8, _counts);
+				}
+				else
+				{
+					impl_algorithms_sort::radix_pass(_pool, _chunks, _begin, _buffer.get(), _count, _key, _pass * 8, _counts);
+				};
+				_inBuffer = !_inBuffer;
+			};
+
+			if (_inBuffer)
+			{
+				impl_algorithms_sort::parallel_move(_pool, _buffer.get(), _begin, _count);
+			};
+		};
+	};
+
+	/**
+	 * @brief Sorts a range using a comparison function, the sort is not stable.
+	 * 
+	 * Uses std::sort at runtime and an introsort implementation during constant evaluation.
+	 * 
+	 * @param _range Range to sort, must have random access iterators
+	 * @param _compare Function object returning true if its first argument orders before its second
+	*/
+	template <typename RangeT, typename CompareT = jc::less_t>
+	JCLIB_REQUIRES((jc::ranges::is_contiguous_range<jc::remove_reference_t<RangeT>>::value))
+	JCLIB_ALGORITHM_H_CONSTEXPR inline auto sort(RangeT&& _range, CompareT _compare = jc::less) ->
+		JCLIB_RET_SFINAE_CXSWITCH(void, jc::ranges::is_contiguous_range<jc::remove_reference_t<RangeT>>::value)
+	{
+		const auto _begin = jc::begin(_range);
+		const auto _end = jc::end(_range);
+		if (JCLIB_ALGORITHM_H_USE_RUNTIME_IMPL())
+		{
+			std::sort(_begin, _end, _compare);
+			return;
+		};
+		impl_algorithms_sort::introsort(_begin, _end, _compare,
+			impl_algorithms_sort::introsort_depth(static_cast<size_t>(_end - _begin)));
+	};
+
+	/**
+	 * @brief Sorts a range using a comparison function, the sort may be run in parallel depending on the execution
+	 * policy. The sort is not stable.
+	 * 
+	 * Chunks of the range are sorted with std::sort across the thread pool then merged in parallel using a scratch
+	 * buffer the size of the range. Elements which aren't default constructible are sorted sequentially.
+	 * 
+	 * @param _policy Execution policy, see jclib/execution.h
+	 * @param _range Range to sort, must have random access iterators
+	 * @param _compare Function object returning true if its first argument orders before its second
+	*/
+	template <typename PolicyT, typename RangeT, typename CompareT = jc::less_t>
+	JCLIB_REQUIRES((jc::execution::is_execution_policy<PolicyT>::value && jc::ranges::is_contiguous_range<jc::remove_reference_t<RangeT>>::value))
+	inline auto sort(PolicyT&& _policy, RangeT&& _range, CompareT _compare = jc::less) ->
+		JCLIB_RET_SFINAE_CXSWITCH
+		(
+			void,
+			jc::execution::is_execution_policy<PolicyT>::value && jc::ranges::is_contiguous_range<jc::remove_reference_t<RangeT>>::value
+		)
+	{
+		using value_type = jc::remove_cvref_t<decltype(*jc::begin(_range))>;
+		impl_algorithms_sort::parallel_sort(impl::execution_pool(_policy), jc::begin(_range), jc::end(_range), _compare,
+			jc::bool_constant<impl_algorithms_sort::is_bufferable<value_type>::value>{});
+	};
+
+	/**
+	 * @brief Stable LSD radix sort of a range by an integer or floating point key.
+	 * 
+	 * Elements are sorted by the key a projection returns for them, one byte of the key per pass. Passes where every
+	 * key has the same byte are skipped, so keys spanning a small range sort in fewer passes. Floating point keys
+	 * order -0 before +0 and NaNs before or after every other value depending on their sign. A scratch buffer the size
+	 * of the range is allocated, so elements must be default constructible.
+	 * 
+	 * @param _range Range to sort, must have random access iterators
+	 * @param _proj Function object returning the key to sort an element by, defaults to the element itself
+	*/
+	template <typename RangeT, typename ProjT = impl_algorithms_execution::identity_transform>
+	JCLIB_REQUIRES((impl_algorithms_sort::is_radix_sortable<jc::remove_reference_t<RangeT>, ProjT>::value))
+	inline auto radix_sort(RangeT&& _range, ProjT _proj = ProjT{}) ->
+		JCLIB_RET_SFINAE_CXSWITCH(void, impl_algorithms_sort::is_radix_sortable<jc::remove_reference_t<RangeT>, ProjT>::value)
+	{
+		impl_algorithms_sort::radix_sort(nullptr, jc::begin(_range), jc::end(_range), _proj);
+	};
+
+	/**
+	 * @brief Stable LSD radix sort of a range by an integer or floating point key, each pass may be run in parallel
+	 * depending on the execution policy.
+	 * 
+	 * Each pass counts and scatters chunks of the range across the thread pool, see the sequential overload for the
+	 * key requirements.
+	 * 
+	 * @param _policy Execution policy, see jclib/execution.h
+	 * @param _range Range to sort, must have random access iterators
+	 * @param _proj Function object returning the key to sort an element by, defaults to the element itself
+	*/
+	template <typename PolicyT, typename RangeT, typename ProjT = impl_algorithms_execution::identity_transform>
+	JCLIB_REQUIRES((jc::execution::is_execution_policy<PolicyT>::value && impl_algorithms_sort::is_radix_sortable<jc::remove_reference_t<RangeT>, ProjT>::value))
+	inline auto radix_sort(PolicyT&& _policy, RangeT&& _range, ProjT _proj = ProjT{}) ->
+		JCLIB_RET_SFINAE_CXSWITCH
+		(
+			void,
+			jc::execution::is_execution_policy<PolicyT>::value && impl_algorithms_sort::is_radix_sortable<jc::remove_reference_t<RangeT>, ProjT>::value
+		)
+	{
+		impl_algorithms_sort::radix_sort(impl::execution_pool(_policy), jc::begin(_range), jc::end(_range), _proj);
+	};
+
+
+
+	// Implementation of the binary searches. Searches over random access ranges are branchless, each step halves the
+	// remaining length the same way regardless of the comparison so every search over a range takes the same steps.
+	namespace impl_algorithms_search
+	{
+		/**
+		 * @brief Number of searches lower_bound_batch runs in lockstep
+		*/
+		constexpr size_t batch_size = 16;
+
+		/**
+		 * @brief Branchless lower bound, finds the offset of the first element which doesn't compare less than a value
+		 * @param _begin Iterator to the first element
+		 * @param _count Number of elements
+		*/
+		template <typename IterT, typename T, typename CompareT>
+		constexpr inline size_t lower_bound_offset(const IterT _begin, size_t _count, const T& _value, CompareT& _compare)
+		{
+			using difference_type = decltype(_begin - _begin);
+			size_t _base = 0;
+			while (_count > 1)
+			{
+				const size_t _half = _count / 2;
+				_base = jc::invoke(_compare, *(_begin + static_cast<difference_type>(_base + _half)), _value) ? _base + _half : _base;
+				_count -= _half;
+			};
+			if (_count == 1 && jc::invoke(_compare, *(_begin + static_cast<difference_type>(_base)), _value))
+			{
+				++_base;
+			};
+			return _base;
+		};
+
+		/**
+		 * @brief Lower bound for random access ranges
+		*/
+		template <typename RangeT, typename T, typename CompareT>
+		constexpr inline auto lower_bound(RangeT& _range, const T& _value, CompareT& _compare, jc::true_type) -> decltype(jc::begin(_range))
+		{
+			const auto _begin = jc::begin(_range);
+			const auto _count = static_cast<size_t>(jc::end(_range) - _begin);
+			return _begin + static_cast<decltype(_begin - _begin)>(impl_algorithms_search::lower_bound_offset(_begin, _count, _value, _compare));
+		};
+
+		/**
+		 * @brief Lower bound for ranges without random access
+		*/
+		template <typename RangeT, typename T, typename CompareT>
+		JCLIB_ALGORITHM_H_CONSTEXPR inline auto lower_bound(RangeT& _range, const T& _value, CompareT& _compare, jc::false_type) -> decltype(jc::begin(_range))
+		{
+			if (JCLIB_ALGORITHM_H_USE_RUNTIME_IMPL())
+			{
+				return std::lower_bound(jc::begin(_range), jc::end(_range), _value, _compare);
+			};
+			auto _at = jc::begin(_range);
+			for (; _at != jc::end(_range) && jc::invoke(_compare, *_at, _value); ++_at) {};
+			return _at;
+		};
+
+		/**
+		 * @brief Prefetches an element of a range, only ranges accessed through a pointer can be prefetched
+		*/
+		template <typename T>
+		inline void prefetch(T* _at, jc::true_type) noexcept
+		{
+			JCLIB_ALGORITHM_H_PREFETCH(_at);
+		};
+
+		template <typename IterT>
+		inline void prefetch(const IterT&, jc::false_type) noexcept {};
+
+		/**
+		 * @brief Runs a batch of branchless searches in lockstep, prefetching the element each search compares against
+		 * next so the cache misses of the whole batch overlap
+		 * @param _offsets Output lower bound offsets for each query
+		*/
+		template <typename IterT, typename QueryIterT, typename CompareT>
+		inline void lower_bound_batch(const IterT _begin, const size_t _count, QueryIterT _queries, const size_t _queryCount,
+			size_t* const _offsets, CompareT& _compare)
+		{
+			using difference_type = decltype(_begin - _begin);
+
+			std::fill(_offsets, _offsets + _queryCount, size_t(0));
+			size_t _remaining = _count;
+			while (_remaining > 1)
+			{
+				const size_t _half = _remaining / 2;
+				auto _query = _queries;
+				for (size_t n = 0; n != _queryCount; ++n, ++_query)
+				{
+					const size_t _base = _offsets[n];
+					const size_t _next = jc::invoke(_compare, *(_begin + static_cast<difference_type>(_base + _half)), *_query) ? _base + _half : _base;
+					impl_algorithms_search::prefetch(_begin + static_cast<difference_type>(_next + (_remaining - _half) / 2),
+						jc::bool_constant<std::is_pointer<IterT>::value>{});
+					_offsets[n] = _next;
+				};
+				_remaining -= _half;
+			};
+			if (_remaining == 1)
+			{
+				auto _query = _queries;
+				for (size_t n = 0; n != _queryCount; ++n, ++_query)
+				{
+					if (jc::invoke(_compare, *(_begin + static_cast<difference_type>(_offsets[n])), *_query))
+					{
+						++_offsets[n];
+					};
+				};
+			};
+		};
+
+		/**
+		 * @brief Gets an iterator to the first element of a range which can be prefetched, a pointer if possible
+		*/
+		template <typename RangeT>
+		inline auto search_begin(RangeT& _range, jc::true_type) -> decltype(impl_algorithms_contiguous::data(_range))
+		{
+			return impl_algorithms_contiguous::data(_range);
+		};
+
+		template <typename RangeT>
+		inline auto search_begin(RangeT& _range, jc::false_type) -> decltype(jc::begin(_range))
+		{
+			return jc::begin(_range);
+		};
+	};
+
+	/**
+	 * @brief Finds the first element of a sorted range which doesn't compare less than a value.
+	 * 
+	 * Random access ranges use a branchless binary search.
+	 * 
+	 * @param _range Range sorted by the comparison
+	 * @param _value Value to search for
+	 * @param _compare Function object returning true if its first argument orders before its second
+	 * @return Iterator to the first element not less than the value, or jc::end(_range) if there is none
+	*/
+	template <typename RangeT, typename T, typename CompareT = jc::less_t>
+	JCLIB_REQUIRES((jc::cx_range<RangeT>))
+	JCLIB_ALGORITHM_H_CONSTEXPR inline auto lower_bound(RangeT&& _range, const T& _value, CompareT _compare = jc::less) ->
+		JCLIB_RET_SFINAE_CXSWITCH
+		(
+			jc::ranges::iterator_t<jc::remove_reference_t<RangeT>>,
+			jc::ranges::is_range<jc::remove_reference_t<RangeT>>::value
+		)
+	{
+		return impl_algorithms_search::lower_bound(_range, _value, _compare,
+			jc::bool_constant<jc::ranges::is_contiguous_range<jc::remove_reference_t<RangeT>>::value>{});
+	};
+
+	/**
+	 * @brief Checks if a sorted range contains an element equivalent to a value
+	 * @param _range Range sorted by the comparison
+	 * @param _value Value to search for
+	 * @param _compare Function object returning true if its first argument orders before its second
+	 * @return True if an element neither orders before nor after the value, false otherwise
+	*/
+	template <typename RangeT, typename T, typename CompareT = jc::less_t>
+	JCLIB_REQUIRES((jc::cx_range<RangeT>))
+	JCLIB_ALGORITHM_H_CONSTEXPR inline auto binary_search(RangeT&& _range, const T& _value, CompareT _compare = jc::less) ->
+		JCLIB_RET_SFINAE_CXSWITCH(bool, jc::ranges::is_range<jc::remove_reference_t<RangeT>>::value)
+	{
+		const auto _at = jc::lower_bound(_range, _value, _compare);
+		return _at != jc::end(_range) && !jc::invoke(_compare, _value, *_at);
+	};
+
+	/**
+	 * @brief Finds the lower bound of many values in one sorted range.
+	 * 
+	 * A batch of searches is run in lockstep, with the element each search looks at next prefetched while the rest of
+	 * the batch compares, so the cache misses of independent searches overlap instead of each search waiting on its own.
+	 * This is much faster than repeated jc::lower_bound calls once the range no longer fits in cache.
+	 * 
+	 * @param _range Random access range sorted by the comparison
+	 * @param _queries Range of values to search for
+	 * @param _out Output iterator, receives the lower bound iterator of each query in order
+	 * @param _compare Function object returning true if its first argument orders before its second
+	 * @return Output iterator one past the last result written
+	*/
+	template <typename RangeT, typename QueryRangeT, typename OutIterT, typename CompareT = jc::less_t>
+	JCLIB_REQUIRES((jc::ranges::is_contiguous_range<jc::remove_reference_t<RangeT>>::value && jc::cx_range<QueryRangeT>))
+	inline auto lower_bound_batch(RangeT&& _range, const QueryRangeT& _queries, OutIterT _out, CompareT _compare = jc::less) ->
+		JCLIB_RET_SFINAE_CXSWITCH
+		(
+			OutIterT,
+			jc::ranges::is_contiguous_range<jc::remove_reference_t<RangeT>>::value && jc::ranges::is_range<QueryRangeT>::value
+		)
+	{
+		using difference_type = decltype(jc::end(_range) - jc::begin(_range));
+
+		const auto _begin = jc::begin(_range);
+		const auto _count = static_cast<size_t>(jc::end(_range) - _begin);
+		const auto _searchBegin = impl_algorithms_search::search_begin(_range,
+			jc::bool_constant<impl_algorithms_contiguous::is_pointer_range<jc::remove_reference_t<RangeT>>::value>{});
+
+		size_t _offsets[impl_algorithms_search::batch_size];
+		auto _query = jc::begin(_queries);
+		const auto _queryEnd = jc::end(_queries);
+		while (_query != _queryEnd)
+		{
+			// Count how many queries make up this batch
+			size_t _batch = 0;
+			auto _batchEnd = _query;
+			for (; _batch != impl_algorithms_search::batch_size && _batchEnd != _queryEnd; ++_batch, ++_batchEnd) {};
+
+			impl_algorithms_search::lower_bound_batch(_searchBegin, _count, _query, _batch, _offsets, _compare);
+			for (size_t n = 0; n != _batch; ++n, ++_out)
+			{
+				*_out = _begin + static_cast<difference_type>(_offsets[n]);
+			};
+			_query = _batchEnd;
+		};
+		return _out;
+	};
+
 
 };
 
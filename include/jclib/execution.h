@@ -0,0 +1,235 @@
+#pragma once
+#ifndef JCLIB_EXECUTION_H
+#define JCLIB_EXECUTION_H
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	Provides execution policies for selecting how jclib algorithms run.
+
+	- jc::execution::seq runs on the calling thread
+	- jc::execution::unseq runs on the calling thread, allowing the work to be reordered so it can be vectorized
+	- jc::execution::par splits the work across jc::default_thread_pool() and the calling thread
+	- jc::execution::par_unseq is the same as par, additionally allowing the work within each chunk to be vectorized
+	- jc::execution::on(pool) splits the work across the given jc::thread_pool and the calling thread
+
+	Parallel policies only split ranges with random access iterators, other ranges are run sequentially.
+
+	The unsequenced policies also allow floating point sums and products to be reordered, which changes how the result
+	is rounded. Integer results are always exact.
+*/
+
+#include "jclib/config.h"
+#include "jclib/type_traits.h"
+#include "jclib/thread_pool.h"
+
+#define _JCLIB_EXECUTION_
+
+#include <cstddef>
+
+namespace jc
+{
+	namespace execution
+	{
+		/**
+		 * @brief Execution policy for running an algorithm on the calling thread
+		*/
+		struct sequenced_policy
+		{
+			// Explicit to prevent accidental construction
+			constexpr explicit sequenced_policy() noexcept = default;
+		};
+
+		/**
+		 * @brief Execution policy for running an algorithm on the calling thread, allowing vectorization
+		*/
+		struct unsequenced_policy
+		{
+			// Explicit to prevent accidental construction
+			constexpr explicit unsequenced_policy() noexcept = default;
+		};
+
+		/**
+		 * @brief Execution policy for running an algorithm across the default thread pool
+		*/
+		struct parallel_policy
+		{
+			// Explicit to prevent accidental construction
+			constexpr explicit parallel_policy() noexcept = default;
+		};
+
+		/**
+		 * @brief Execution policy for running an algorithm across the default thread pool, allowing vectorization
+		*/
+		struct parallel_unsequenced_policy
+		{
+			// Explicit to prevent accidental construction
+			constexpr explicit parallel_unsequenced_policy() noexcept = default;
+		};
+
+		/**
+		 * @brief Execution policy for running an algorithm across a specific thread pool, use jc::execution::on() to create one
+		*/
+		struct thread_pool_policy
+		{
+		public:
+			/**
+			 * @brief Gets the thread pool the algorithm will run on
+			*/
+			jc::thread_pool& pool() const noexcept
+			{
+				return *this->pool_;
+			};
+
+			constexpr explicit thread_pool_policy(jc::thread_pool& _pool) noexcept :
+				pool_{ &_pool }
+			{};
+
+		private:
+			jc::thread_pool* pool_;
+		};
+
+		/**
+		 * @brief Policy value for running an algorithm on the calling thread
+		*/
+		constexpr sequenced_policy seq{};
+
+		/**
+		 * @brief Policy value for running an algorithm on the calling thread, allowing vectorization
+		*/
+		constexpr unsequenced_policy unseq{};
+
+		/**
+		 * @brief Policy value for running an algorithm across the default thread pool
+		*/
+		constexpr parallel_policy par{};
+
+		/**
+		 * @brief Policy value for running an algorithm across the default thread pool, allowing vectorization
+		*/
+		constexpr parallel_unsequenced_policy par_unseq{};
+
+		/**
+		 * @brief Creates a policy for running an algorithm across a thread pool
+		 * @param _pool Thread pool to use, must outlive the algorithm call
+		 * @return Thread pool execution policy
+		*/
+		inline thread_pool_policy on(jc::thread_pool& _pool) noexcept
+		{
+			return thread_pool_policy{ _pool };
+		};
+
+		/**
+		 * @brief Type trait checking if a type is an execution policy, cv and reference qualifiers are ignored
+		*/
+		template <typename T>
+		struct is_execution_policy : jc::bool_constant
+			<
+				jc::is_same<jc::remove_cvref_t<T>, sequenced_policy>::value ||
+				jc::is_same<jc::remove_cvref_t<T>, unsequenced_policy>::value ||
+				jc::is_same<jc::remove_cvref_t<T>, parallel_policy>::value ||
+				jc::is_same<jc::remove_cvref_t<T>, parallel_unsequenced_policy>::value ||
+				jc::is_same<jc::remove_cvref_t<T>, thread_pool_policy>::value
+			>
+		{};
+
+#if JCLIB_FEATURE_INLINE_VARIABLES_V
+		/**
+		 * @brief Type trait checking if a type is an execution policy, cv and reference qualifiers are ignored
+		*/
+		template <typename T>
+		constexpr inline bool is_execution_policy_v = is_execution_policy<T>::value;
+#endif
+	};
+
+	namespace impl
+	{
+		/**
+		 * @brief Gets the thread pool an execution policy runs on
+		 * @return Thread pool, or nullptr if the policy is sequential
+		*/
+		inline jc::thread_pool* execution_pool(const execution::sequenced_policy&) noexcept
+		{
+			return nullptr;
+		};
+		inline jc::thread_pool* execution_pool(const execution::unsequenced_policy&) noexcept
+		{
+			return nullptr;
+		};
+		inline jc::thread_pool* execution_pool(const execution::parallel_policy&)
+		{
+			return &jc::default_thread_pool();
+		};
+		inline jc::thread_pool* execution_pool(const execution::parallel_unsequenced_policy&)
+		{
+			return &jc::default_thread_pool();
+		};
+		inline jc::thread_pool* execution_pool(const execution::thread_pool_policy& _policy) noexcept
+		{
+			return &_policy.pool();
+		};
+
+		/**
+		 * @brief Type trait checking if an execution policy allows the work to be reordered for vectorization
+		*/
+		template <typename T>
+		struct is_unsequenced_policy : jc::bool_constant
+			<
+				jc::is_same<jc::remove_cvref_t<T>, execution::unsequenced_policy>::value ||
+				jc::is_same<jc::remove_cvref_t<T>, execution::parallel_unsequenced_policy>::value
+			>
+		{};
+
+		/**
+		 * @brief Determines how many chunks to split a range into for a parallel algorithm
+		 * @param _pool Thread pool to run on, may be null
+		 * @param _count Number of elements in the range
+		 * @param _grain Minimum number of elements per chunk
+		 * @return Number of chunks, 1 if the range should be processed sequentially
+		*/
+		inline size_t execution_chunk_count(const jc::thread_pool* _pool, size_t _count, size_t _grain) noexcept
+		{
+			if (!_pool || _pool->size() == 0)
+			{
+				return 1;
+			};
+
+			// A few chunks per thread helps balance uneven work
+			const size_t _maxChunks = (_pool->size() + 1) * 4;
+			const size_t _grainChunks = _count / ((_grain != 0) ? _grain : 1);
+			const size_t _chunks = (_grainChunks < _maxChunks) ? _grainChunks : _maxChunks;
+			return (_chunks > 1) ? _chunks : 1;
+		};
+
+		/**
+		 * @brief Splits [0, _count) into contiguous chunks of near equal size and runs them across a thread pool
+		 * @param _pool Thread pool to run on
+		 * @param _count Number of elements
+		 * @param _chunks Number of chunks, as returned by execution_chunk_count()
+		 * @param _op Function object invoked as _op(chunk index, first element index, last element index)
+		*/
+		template <typename OpT>
+		inline void execution_for_each_chunk(jc::thread_pool& _pool, size_t _count, size_t _chunks, OpT&& _op)
+		{
+			_pool.for_each_index(_chunks, [&_op, _count, _chunks](size_t _chunk)
+			{
+				const size_t _first = (_count / _chunks) * _chunk + ((_chunk < _count % _chunks) ? _chunk : _count % _chunks);
+				const size_t _size = (_count / _chunks) + ((_chunk < _count % _chunks) ? 1 : 0);
+				_op(_chunk, _first, _first + _size);
+			});
+		};
+	};
+};
+
+#endif
@@ -0,0 +1,517 @@
+#pragma once
+#ifndef JCLIB_EYTZINGER_SET_H
+#define JCLIB_EYTZINGER_SET_H
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	jc::eytzinger_set is an immutable ordered set for large static lookup tables, stored in Eytzinger (breadth first)
+	order instead of sorted order.
+
+	The element at layout index k has its children at 2k and 2k + 1, so every step of a search reads from a
+	predictable position. Searches are branchless and prefetch the cache line holding the descendants a few levels
+	below the current node, so the misses of a search overlap instead of happening one after the other. For tables
+	which don't fit in cache this is several times faster than binary searching a sorted array, for small tables
+	prefer jc::flat_set.
+
+	Iterating the set still visits the elements in sorted order, the iterators walk the implicit tree in order.
+	The layout itself can be read with layout().
+
+	Example Code:
+
+	#include "jclib/eytzinger_set.h"
+
+	std::vector<uint64_t> _sorted{ ... };
+	const jc::eytzinger_set<uint64_t> _table{ jc::sorted_unique, std::move(_sorted) };
+	const auto _it = _table.lower_bound(42);
+*/
+
+#include "jclib/config.h"
+#include "jclib/type_traits.h"
+#include "jclib/functional.h"
+#include "jclib/span.h"
+#include "jclib/flat_set.h"
+#include "jclib/algorithm.h"
+
+#define _JCLIB_EYTZINGER_SET_
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <initializer_list>
+#include <cstddef>
+#include <cstdint>
+
+namespace jc
+{
+	namespace impl
+	{
+		/**
+		 * @brief Counts the trailing set bits of an integer
+		*/
+		inline size_t eytzinger_countr_one(size_t _value) noexcept
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return (~_value == 0) ? sizeof(size_t) * 8 : static_cast<size_t>(__builtin_ctzll(static_cast<unsigned long long>(~_value)));
+#else
+			size_t _out = 0;
+			while (_value & 1)
+			{
+				_value >>= 1;
+				++_out;
+			};
+			return _out;
+#endif
+		};
+
+		/**
+		 * @brief Rounds a non-zero integer down to a power of two
+		*/
+		constexpr inline size_t eytzinger_floor_pow2(size_t _value) noexcept
+		{
+			return (_value <= 1) ? 1 : eytzinger_floor_pow2(_value / 2) * 2;
+		};
+
+		/**
+		 * @brief Gets the layout index of the first element in order, 0 if there are no elements
+		*/
+		inline size_t eytzinger_first(size_t _size) noexcept
+		{
+			size_t k = (_size == 0) ? 0 : 1;
+			while (k != 0 && k * 2 <= _size)
+			{
+				k *= 2;
+			};
+			return k;
+		};
+
+		/**
+		 * @brief Gets the layout index of the last element in order, 0 if there are no elements
+		*/
+		inline size_t eytzinger_last(size_t _size) noexcept
+		{
+			size_t k = (_size == 0) ? 0 : 1;
+			while (k != 0 && k * 2 + 1 <= _size)
+			{
+				k = k * 2 + 1;
+			};
+			return k;
+		};
+
+		/**
+		 * @brief Gets the layout index of the element after k in order, 0 if k is the last element
+		*/
+		inline size_t eytzinger_next(size_t k, size_t _size) noexcept
+		{
+			if (k * 2 + 1 <= _size)
+			{
+				// Leftmost element of the right subtree
+				k = k * 2 + 1;
+				while (k * 2 <= _size)
+				{
+					k *= 2;
+				};
+				return k;
+			}
+			else
+			{
+				// Climb while k is a right child, then once more
+				return k >> (impl::eytzinger_countr_one(k) + 1);
+			};
+		};
+
+		/**
+		 * @brief Gets the layout index of the element before k in order, the last element if k is 0
+		*/
+		inline size_t eytzinger_prev(size_t k, size_t _size) noexcept
+		{
+			if (k == 0)
+			{
+				return impl::eytzinger_last(_size);
+			}
+			else if (k * 2 <= _size)
+			{
+				// Rightmost element of the left subtree
+				k *= 2;
+				while (k * 2 + 1 <= _size)
+				{
+					k = k * 2 + 1;
+				};
+				return k;
+			}
+			else
+			{
+				// Climb while k is a left child, then once more
+				return k >> (impl::eytzinger_countr_one(~k) + 1);
+			};
+		};
+
+		/**
+		 * @brief Bidirectional iterator visiting the elements of an Eytzinger layout in order
+		*/
+		template <typename T>
+		struct eytzinger_iterator
+		{
+		public:
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const T*;
+			using reference = const T&;
+			using iterator_category = std::bidirectional_iterator_tag;
+
+			reference operator*() const
+			{
+				JCLIB_ASSERT(this->index_ != 0);
+				return this->data_[this->index_ - 1];
+			};
+			pointer operator->() const
+			{
+				JCLIB_ASSERT(this->index_ != 0);
+				return this->data_ + (this->index_ - 1);
+			};
+
+			eytzinger_iterator& operator++()
+			{
+				JCLIB_ASSERT(this->index_ != 0);
+				this->index_ = impl::eytzinger_next(this->index_, this->size_);
+				return *this;
+			};
+			eytzinger_iterator operator++(int)
+			{
+				auto _out = *this;
+				++(*this);
+				return _out;
+			};
+
+			eytzinger_iterator& operator--()
+			{
+				this->index_ = impl::eytzinger_prev(this->index_, this->size_);
+				JCLIB_ASSERT(this->index_ != 0);
+				return *this;
+			};
+			eytzinger_iterator operator--(int)
+			{
+				auto _out = *this;
+				--(*this);
+				return _out;
+			};
+
+			/**
+			 * @brief Gets the position of the element within the layout, or the layout size for the end iterator
+			*/
+			size_t layout_index() const noexcept
+			{
+				return (this->index_ == 0) ? this->size_ : this->index_ - 1;
+			};
+
+			friend inline bool operator==(const eytzinger_iterator& lhs, const eytzinger_iterator& rhs) noexcept
+			{
+				return lhs.index_ == rhs.index_ && lhs.data_ == rhs.data_;
+			};
+			friend inline bool operator!=(const eytzinger_iterator& lhs, const eytzinger_iterator& rhs) noexcept
+			{
+				return !(lhs == rhs);
+			};
+
+			constexpr eytzinger_iterator() noexcept = default;
+
+			/**
+			 * @param _data Layout data
+			 * @param _index One based layout index, 0 for the end iterator
+			 * @param _size Number of elements in the layout
+			*/
+			constexpr eytzinger_iterator(const T* _data, size_t _index, size_t _size) noexcept :
+				data_{ _data }, index_{ _index }, size_{ _size }
+			{};
+
+		private:
+			const T* data_ = nullptr;
+			size_t index_ = 0;
+			size_t size_ = 0;
+		};
+	};
+
+	/**
+	 * @brief Immutable ordered set stored in Eytzinger (breadth first) order for cache friendly searching.
+	 * @tparam K Element (key) type.
+	 * @tparam CompareT Comparison function object type, defaults to jc::less_t.
+	*/
+	template <typename K, typename CompareT = jc::less_t>
+	struct eytzinger_set
+	{
+	public:
+		using key_type = K;
+		using value_type = K;
+		using key_compare = CompareT;
+		using value_compare = CompareT;
+		using container_type = std::vector<K>;
+		using size_type = size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = const value_type&;
+		using const_reference = const value_type&;
+		using iterator = impl::eytzinger_iterator<K>;
+		using const_iterator = impl::eytzinger_iterator<K>;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	private:
+
+		/**
+		 * @brief Lookup argument type, allows heterogeneous lookup with a transparent comparison type
+		*/
+		template <typename KeyT>
+		using key_arg = typename impl::transparent_key_arg<jc::is_transparent<CompareT>::value>::template type<KeyT, key_type>;
+
+		/**
+		 * @brief Number of elements in a cache line rounded down to a power of two, searches prefetch this many
+		 * levels' worth of descendants ahead. Descendants of a node n levels down start at k * 2^n, so the stride
+		 * must be a power of two to land on the start of their block.
+		*/
+		constexpr static size_t prefetch_stride = impl::eytzinger_floor_pow2((sizeof(K) < 64) ? (64 / sizeof(K)) : 1);
+
+		const_iterator make_iterator(size_t _index) const noexcept
+		{
+			return const_iterator{ this->keys_.data(), _index, this->keys_.size() };
+		};
+
+		/**
+		 * @brief Hints that the descendants of a node a few levels down will be searched soon
+		*/
+		void prefetch_descendants(size_t k) const noexcept
+		{
+			// Computed as an integer, the descendants may be past the end of the layout
+			const auto _at = reinterpret_cast<uintptr_t>(this->keys_.data()) + (k * prefetch_stride - 1) * sizeof(K);
+			JCLIB_ALGORITHM_H_PREFETCH(reinterpret_cast<const void*>(_at));
+		};
+
+		/**
+		 * @brief Branchless descent, goes right whenever the predicate holds for the node
+		 * @return One based layout index of the first element the predicate doesn't hold for, 0 if there is none
+		*/
+		template <typename PredT>
+		size_t descend(PredT&& _pred) const
+		{
+			const auto _data = this->keys_.data();
+			const auto _size = this->keys_.size();
+			size_t k = 1;
+			while (k <= _size)
+			{
+				this->prefetch_descendants(k);
+				k = k * 2 + static_cast<size_t>(_pred(_data[k - 1]));
+			};
+
+			// Undo the trailing right turns and the final left turn
+			return k >> (impl::eytzinger_countr_one(k) + 1);
+		};
+
+		/**
+		 * @brief Rebuilds the sorted elements in Eytzinger order
+		*/
+		void build_layout()
+		{
+			const auto _size = this->keys_.size();
+			std::vector<size_t> _rank(_size);
+			size_t _next = 0;
+			for (size_t k = impl::eytzinger_first(_size); k != 0; k = impl::eytzinger_next(k, _size))
+			{
+				_rank[k - 1] = _next++;
+			};
+
+			container_type _layout{};
+			_layout.reserve(_size);
+			for (auto& r : _rank)
+			{
+				_layout.push_back(std::move(this->keys_[r]));
+			};
+			this->keys_ = std::move(_layout);
+		};
+
+	public:
+
+		const_iterator begin() const noexcept { return this->make_iterator(impl::eytzinger_first(this->keys_.size())); };
+		const_iterator cbegin() const noexcept { return this->begin(); };
+		const_iterator end() const noexcept { return this->make_iterator(0); };
+		const_iterator cend() const noexcept { return this->end(); };
+
+		const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{ this->end() }; };
+		const_reverse_iterator rend() const noexcept { return const_reverse_iterator{ this->begin() }; };
+
+		/**
+		 * @brief Gets the number of elements held
+		*/
+		size_type size() const noexcept { return this->keys_.size(); };
+
+		/**
+		 * @brief Checks if the set holds no elements
+		*/
+		bool empty() const noexcept { return this->keys_.empty(); };
+
+		/**
+		 * @brief Gets a span over the elements in Eytzinger order
+		*/
+		jc::span<const key_type> layout() const noexcept
+		{
+			return jc::span<const key_type>{ this->keys_.data(), this->keys_.size() };
+		};
+
+		key_compare key_comp() const { return this->compare_; };
+		value_compare value_comp() const { return this->compare_; };
+
+		/**
+		 * @brief Finds the first element not ordered before the given key
+		*/
+		template <typename KeyT = key_type>
+		const_iterator lower_bound(const key_arg<KeyT>& _key) const
+		{
+			const auto& _compare = this->compare_;
+			return this->make_iterator(this->descend([&_compare, &_key](const key_type& v)
+			{
+				return _compare(v, _key);
+			}));
+		};
+
+		/**
+		 * @brief Finds the first element ordered after the given key
+		*/
+		template <typename KeyT = key_type>
+		const_iterator upper_bound(const key_arg<KeyT>& _key) const
+		{
+			const auto& _compare = this->compare_;
+			return this->make_iterator(this->descend([&_compare, &_key](const key_type& v)
+			{
+				return !_compare(_key, v);
+			}));
+		};
+
+		/**
+		 * @brief Finds the range of elements equivalent to the given key, this has at most one element
+		*/
+		template <typename KeyT = key_type>
+		std::pair<const_iterator, const_iterator> equal_range(const key_arg<KeyT>& _key) const
+		{
+			const auto _it = this->find(_key);
+			return { _it, (_it == this->end()) ? _it : std::next(_it) };
+		};
+
+		/**
+		 * @brief Finds the element equivalent to the given key
+		 * @return Iterator to the element, or end() if not found
+		*/
+		template <typename KeyT = key_type>
+		const_iterator find(const key_arg<KeyT>& _key) const
+		{
+			const auto _it = this->lower_bound(_key);
+			return (_it != this->end() && !this->compare_(_key, *_it)) ? _it : this->end();
+		};
+
+		/**
+		 * @brief Checks if the set holds an element equivalent to the given key
+		*/
+		template <typename KeyT = key_type>
+		bool contains(const key_arg<KeyT>& _key) const
+		{
+			return this->find(_key) != this->end();
+		};
+
+		/**
+		 * @brief Counts the elements equivalent to the given key, either 0 or 1
+		*/
+		template <typename KeyT = key_type>
+		size_type count(const key_arg<KeyT>& _key) const
+		{
+			return this->contains(_key) ? 1 : 0;
+		};
+
+		void swap(eytzinger_set& _other) noexcept
+		{
+			using std::swap;
+			swap(this->keys_, _other.keys_);
+			swap(this->compare_, _other.compare_);
+		};
+		friend void swap(eytzinger_set& lhs, eytzinger_set& rhs) noexcept
+		{
+			lhs.swap(rhs);
+		};
+
+		friend bool operator==(const eytzinger_set& lhs, const eytzinger_set& rhs)
+		{
+			return lhs.keys_ == rhs.keys_;
+		};
+		friend bool operator!=(const eytzinger_set& lhs, const eytzinger_set& rhs)
+		{
+			return !(lhs == rhs);
+		};
+
+		eytzinger_set() = default;
+
+		explicit eytzinger_set(const key_compare& _compare) :
+			keys_{}, compare_{ _compare }
+		{};
+
+		/**
+		 * @brief Constructs the set from a container of elements, sorting them and removing duplicates
+		*/
+		explicit eytzinger_set(container_type _keys, const key_compare& _compare = key_compare{}) :
+			keys_{ std::move(_keys) }, compare_{ _compare }
+		{
+			std::sort(this->keys_.begin(), this->keys_.end(), this->compare_);
+			impl::flat_erase_duplicates(this->keys_, this->compare_);
+			this->build_layout();
+		};
+
+		/**
+		 * @brief Constructs the set from a container of elements that are already sorted and unique
+		*/
+		eytzinger_set(sorted_unique_t, container_type _keys, const key_compare& _compare = key_compare{}) :
+			keys_{ std::move(_keys) }, compare_{ _compare }
+		{
+			JCLIB_ASSERT(this->is_sorted_unique());
+			this->build_layout();
+		};
+
+		template <typename IterT>
+		eytzinger_set(IterT _begin, IterT _end, const key_compare& _compare = key_compare{}) :
+			eytzinger_set(container_type(_begin, _end), _compare)
+		{};
+
+		template <typename IterT>
+		eytzinger_set(sorted_unique_t, IterT _begin, IterT _end, const key_compare& _compare = key_compare{}) :
+			eytzinger_set(jc::sorted_unique, container_type(_begin, _end), _compare)
+		{};
+
+		eytzinger_set(std::initializer_list<value_type> _values, const key_compare& _compare = key_compare{}) :
+			eytzinger_set(_values.begin(), _values.end(), _compare)
+		{};
+
+		eytzinger_set(sorted_unique_t, std::initializer_list<value_type> _values, const key_compare& _compare = key_compare{}) :
+			eytzinger_set(jc::sorted_unique, _values.begin(), _values.end(), _compare)
+		{};
+
+	private:
+
+		bool is_sorted_unique() const
+		{
+			return std::adjacent_find(this->keys_.begin(), this->keys_.end(), [this](const key_type& lhs, const key_type& rhs)
+			{
+				return !this->compare_(lhs, rhs);
+			}) == this->keys_.end();
+		};
+
+		container_type keys_;
+		key_compare compare_;
+	};
+};
+
+#endif
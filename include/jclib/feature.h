@@ -407,5 +407,44 @@
     #define JCLIB_FEATURE_STRING_VIEW_V false
 #endif
 
+/*
+    Test for __cpp_lib_has_unique_object_representations
+*/
+
+#define JCLIB_FEATURE_VALUE_HAS_UNIQUE_OBJECT_REPRESENTATIONS 201606L
+#if JCLIB_CPP >= JCLIB_FEATURE_VALUE_HAS_UNIQUE_OBJECT_REPRESENTATIONS || __cpp_lib_has_unique_object_representations >= JCLIB_FEATURE_VALUE_HAS_UNIQUE_OBJECT_REPRESENTATIONS
+    #define JCLIB_FEATURE_HAS_UNIQUE_OBJECT_REPRESENTATIONS
+#else
+    #ifdef JCLIB_FEATURE_HAS_UNIQUE_OBJECT_REPRESENTATIONS 
+        #error "Feature testing macro was defined when it shouldn't be"
+    #endif
+#endif
+
+#ifdef JCLIB_FEATURE_HAS_UNIQUE_OBJECT_REPRESENTATIONS
+    #define JCLIB_FEATURE_HAS_UNIQUE_OBJECT_REPRESENTATIONS_V true
+#else
+    #define JCLIB_FEATURE_HAS_UNIQUE_OBJECT_REPRESENTATIONS_V false
+#endif
+
+/*
+    Test for __cpp_lib_is_constant_evaluated
+*/
+
+#define JCLIB_FEATURE_VALUE_IS_CONSTANT_EVALUATED 201811L
+#if JCLIB_CPP >= JCLIB_FEATURE_VALUE_IS_CONSTANT_EVALUATED || __cpp_lib_is_constant_evaluated >= JCLIB_FEATURE_VALUE_IS_CONSTANT_EVALUATED
+    #define JCLIB_FEATURE_IS_CONSTANT_EVALUATED
+#else
+    #ifdef JCLIB_FEATURE_IS_CONSTANT_EVALUATED 
+        #error "Feature testing macro was defined when it shouldn't be"
+    #endif
+#endif
+
+#ifdef JCLIB_FEATURE_IS_CONSTANT_EVALUATED
+    #define JCLIB_FEATURE_IS_CONSTANT_EVALUATED_V true
+#else
+    #define JCLIB_FEATURE_IS_CONSTANT_EVALUATED_V false
+#endif
+
+
     
 #endif
@@ -0,0 +1,292 @@
+#pragma once
+#ifndef JCLIB_FLAT_HASH_MAP_H
+#define JCLIB_FLAT_HASH_MAP_H
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	jc::flat_hash_map is an unordered map storing its key/value pairs inline in an open addressing hash table, see
+	jclib/hash_table.h for details on the layout.
+
+	Unlike std::unordered_map, pointers and iterators to elements are invalidated whenever the map rehashes, which may
+	happen on any insertion.
+
+	Heterogeneous lookup is enabled when both the hash and equality function objects are transparent, this allows
+	finding std::string keys by std::string_view or string literal without creating a std::string:
+
+	#include "jclib/flat_hash_map.h"
+
+	jc::flat_hash_map<std::string, int, jc::transparent<jc::hash_t>, jc::transparent<jc::equals_t>> _ids{};
+	_ids["foo"] = 1;
+	const auto _it = _ids.find("foo");
+*/
+
+#include "jclib/config.h"
+#include "jclib/functional.h"
+#include "jclib/hash_table.h"
+
+#define _JCLIB_FLAT_HASH_MAP_
+
+#include <memory>
+#include <utility>
+#include <tuple>
+#include <stdexcept>
+
+namespace jc
+{
+	namespace impl
+	{
+		/**
+		 * @brief Storage for a flat_hash_map element.
+		 *
+		 * Holds the element as std::pair<const K, V>, the std::pair<K, V> member allows moving the key when the
+		 * table rehashes if both pair types have the same layout.
+		*/
+		template <typename K, typename V>
+		union flat_hash_map_slot
+		{
+			flat_hash_map_slot() {};
+			~flat_hash_map_slot() {};
+
+			std::pair<const K, V> value;
+			std::pair<K, V> mutable_value;
+		};
+
+		/**
+		 * @brief Hash table policy for maps, elements are stored as key/value pairs
+		 * @tparam K Key type.
+		 * @tparam V Mapped value type.
+		*/
+		template <typename K, typename V>
+		struct flat_hash_map_policy
+		{
+			using key_type = K;
+			using value_type = std::pair<const K, V>;
+			using slot_type = flat_hash_map_slot<K, V>;
+			using reference = value_type&;
+			using const_reference = const value_type&;
+
+			/**
+			 * @brief True if keys can be moved out of the slots when rehashing
+			*/
+			using is_key_movable = jc::bool_constant<
+				std::is_standard_layout<std::pair<const K, V>>::value &&
+				std::is_standard_layout<std::pair<K, V>>::value &&
+				sizeof(std::pair<const K, V>) == sizeof(std::pair<K, V>) &&
+				alignof(std::pair<const K, V>) == alignof(std::pair<K, V>)
+			>;
+
+			static const key_type& key(const slot_type& _slot) noexcept { return _slot.value.first; };
+			template <typename PairT>
+			static const key_type& key_of(const PairT& _value) noexcept { return _value.first; };
+			static reference element(slot_type& _slot) noexcept { return _slot.value; };
+
+			template <typename AllocT, typename... Ts>
+			static void construct(AllocT& _alloc, slot_type* _slot, Ts&&... _args)
+			{
+				std::allocator_traits<AllocT>::construct(_alloc, std::addressof(_slot->value), std::forward<Ts>(_args)...);
+			};
+
+			template <typename AllocT>
+			static void destroy(AllocT& _alloc, slot_type* _slot) noexcept
+			{
+				std::allocator_traits<AllocT>::destroy(_alloc, std::addressof(_slot->value));
+			};
+
+			template <typename AllocT>
+			static void transfer(AllocT& _alloc, slot_type* _to, slot_type* _from)
+			{
+				transfer_impl(_alloc, _to, _from, is_key_movable{});
+			};
+
+		private:
+			template <typename AllocT>
+			static void transfer_impl(AllocT& _alloc, slot_type* _to, slot_type* _from, jc::true_type)
+			{
+				std::allocator_traits<AllocT>::construct(_alloc, std::addressof(_to->mutable_value), std::move(_from->mutable_value));
+				std::allocator_traits<AllocT>::destroy(_alloc, std::addressof(_from->mutable_value));
+			};
+
+			template <typename AllocT>
+			static void transfer_impl(AllocT& _alloc, slot_type* _to, slot_type* _from, jc::false_type)
+			{
+				construct(_alloc, _to, std::move(_from->value));
+				destroy(_alloc, _from);
+			};
+		};
+	};
+
+	/**
+	 * @brief Unordered map storing its key/value pairs inline in an open addressing hash table.
+	 * @tparam K Key type.
+	 * @tparam V Mapped value type.
+	 * @tparam HashT Hash function object type, defaults to jc::hash_t.
+	 * @tparam EqualT Key equality function object type, defaults to jc::equals_t.
+	 * @tparam AllocT Allocator type.
+	*/
+	template <typename K, typename V, typename HashT = jc::hash_t, typename EqualT = jc::equals_t,
+		typename AllocT = std::allocator<std::pair<const K, V>>>
+	struct flat_hash_map : public impl::raw_hash_table<impl::flat_hash_map_policy<K, V>, HashT, EqualT, AllocT>
+	{
+	private:
+		using parent_type = impl::raw_hash_table<impl::flat_hash_map_policy<K, V>, HashT, EqualT, AllocT>;
+
+		template <typename KeyT>
+		using key_arg = typename parent_type::template key_arg<KeyT>;
+
+		// Checks if a type is the key type, these can be looked up without constructing a pair first
+		template <typename KeyT>
+		using is_key = std::is_same<jc::remove_cvref_t<KeyT>, typename parent_type::key_type>;
+
+		template <typename PairT>
+		std::pair<typename parent_type::iterator, bool> emplace_pair(PairT&& _value, jc::true_type)
+		{
+			return this->emplace_key(_value.first, std::forward<PairT>(_value));
+		};
+		template <typename PairT>
+		std::pair<typename parent_type::iterator, bool> emplace_pair(PairT&& _value, jc::false_type)
+		{
+			return parent_type::emplace(std::forward<PairT>(_value));
+		};
+
+		template <typename KeyT, typename ValT>
+		std::pair<typename parent_type::iterator, bool> emplace_key_value(KeyT&& _key, ValT&& _value, jc::true_type)
+		{
+			return this->emplace_key(_key, std::forward<KeyT>(_key), std::forward<ValT>(_value));
+		};
+		template <typename KeyT, typename ValT>
+		std::pair<typename parent_type::iterator, bool> emplace_key_value(KeyT&& _key, ValT&& _value, jc::false_type)
+		{
+			return parent_type::emplace(std::forward<KeyT>(_key), std::forward<ValT>(_value));
+		};
+
+	public:
+		using mapped_type = V;
+		using typename parent_type::key_type;
+		using typename parent_type::value_type;
+		using typename parent_type::iterator;
+		using typename parent_type::const_iterator;
+
+		using parent_type::insert;
+
+		/**
+		 * @brief Inserts a key/value pair if there is no element with an equal key
+		 * @return Iterator to the element with the key, and true if the pair was inserted
+		*/
+		template <typename PairT, typename = jc::enable_if_t<std::is_constructible<value_type, PairT&&>::value>>
+		std::pair<iterator, bool> insert(PairT&& _value)
+		{
+			return this->emplace_pair(std::forward<PairT>(_value), jc::bool_constant<is_key<decltype(_value.first)>::value>{});
+		};
+
+		/**
+		 * @brief Constructs a key/value pair and inserts it if there is no element with an equal key.
+		 * 
+		 * If the key argument is already a key_type, the key is looked up before anything is constructed.
+		 * 
+		 * @return Iterator to the element with the key, and true if the pair was inserted
+		*/
+		template <typename KeyT, typename ValT>
+		std::pair<iterator, bool> emplace(KeyT&& _key, ValT&& _value)
+		{
+			return this->emplace_key_value(std::forward<KeyT>(_key), std::forward<ValT>(_value), jc::bool_constant<is_key<KeyT>::value>{});
+		};
+		template <typename PairT, typename = jc::enable_if_t<std::is_constructible<value_type, PairT&&>::value>>
+		std::pair<iterator, bool> emplace(PairT&& _value)
+		{
+			return this->emplace_pair(std::forward<PairT>(_value), jc::bool_constant<is_key<decltype(_value.first)>::value>{});
+		};
+		template <typename... Ts>
+		std::pair<iterator, bool> emplace(std::piecewise_construct_t, Ts&&... _args)
+		{
+			return parent_type::emplace(std::piecewise_construct, std::forward<Ts>(_args)...);
+		};
+
+		/**
+		 * @brief Inserts a value constructed from the given arguments if the key is not present, nothing is
+		 * constructed if the key is already present.
+		 * @return Iterator to the element with the key, and true if the value was inserted
+		*/
+		template <typename... Ts>
+		std::pair<iterator, bool> try_emplace(const key_type& _key, Ts&&... _args)
+		{
+			return this->emplace_key(_key, std::piecewise_construct,
+				std::forward_as_tuple(_key), std::forward_as_tuple(std::forward<Ts>(_args)...));
+		};
+		template <typename... Ts>
+		std::pair<iterator, bool> try_emplace(key_type&& _key, Ts&&... _args)
+		{
+			return this->emplace_key(_key, std::piecewise_construct,
+				std::forward_as_tuple(std::move(_key)), std::forward_as_tuple(std::forward<Ts>(_args)...));
+		};
+
+		/**
+		 * @brief Inserts a value if the key is not present, otherwise assigns the value to the existing element
+		 * @return Iterator to the element with the key, and true if the value was inserted
+		*/
+		template <typename KeyT, typename ValT>
+		std::pair<iterator, bool> insert_or_assign(KeyT&& _key, ValT&& _value)
+		{
+			auto _result = this->try_emplace(std::forward<KeyT>(_key), std::forward<ValT>(_value));
+			if (!_result.second)
+			{
+				_result.first->second = std::forward<ValT>(_value);
+			};
+			return _result;
+		};
+
+		/**
+		 * @brief Gets the value for a key, inserting a default constructed value if the key is not present
+		*/
+		mapped_type& operator[](const key_type& _key)
+		{
+			return this->try_emplace(_key).first->second;
+		};
+		mapped_type& operator[](key_type&& _key)
+		{
+			return this->try_emplace(std::move(_key)).first->second;
+		};
+
+		/**
+		 * @brief Gets the value for a key
+		 * @exception std::out_of_range Thrown if the key is not present and jclib's exception usage is enabled.
+		*/
+		template <typename KeyT = key_type>
+		mapped_type& at(const key_arg<KeyT>& _key)
+		{
+			const auto _it = this->find(_key);
+			if (_it == this->end())
+			{
+				JCLIB_THROW(std::out_of_range("flat_hash_map::at key not found"));
+			};
+			return _it->second;
+		};
+		template <typename KeyT = key_type>
+		const mapped_type& at(const key_arg<KeyT>& _key) const
+		{
+			const auto _it = this->find(_key);
+			if (_it == this->end())
+			{
+				JCLIB_THROW(std::out_of_range("flat_hash_map::at key not found"));
+			};
+			return _it->second;
+		};
+
+		using parent_type::parent_type;
+
+		flat_hash_map() = default;
+	};
+};
+
+#endif
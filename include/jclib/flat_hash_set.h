@@ -0,0 +1,105 @@
+#pragma once
+#ifndef JCLIB_FLAT_HASH_SET_H
+#define JCLIB_FLAT_HASH_SET_H
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	jc::flat_hash_set is an unordered set storing its elements inline in an open addressing hash table, see
+	jclib/hash_table.h for details on the layout.
+
+	Unlike std::unordered_set, pointers and iterators to elements are invalidated whenever the set rehashes, which may
+	happen on any insertion.
+
+	Heterogeneous lookup is enabled when both the hash and equality function objects are transparent, this allows
+	finding std::string keys by std::string_view or string literal without creating a std::string:
+
+	#include "jclib/flat_hash_set.h"
+	
+	jc::flat_hash_set<std::string, jc::transparent<jc::hash_t>, jc::transparent<jc::equals_t>> _names{ "foo", "bar" };
+	const bool _hasFoo = _names.contains("foo");
+*/
+
+#include "jclib/config.h"
+#include "jclib/functional.h"
+#include "jclib/hash_table.h"
+
+#define _JCLIB_FLAT_HASH_SET_
+ 
+#include <memory>
+#include <utility>
+
+namespace jc
+{
+	namespace impl
+	{
+		/**
+		 * @brief Hash table policy for sets, elements are stored directly in the slots and are never mutable
+		 * @tparam T Element type.
+		*/
+		template <typename T>
+		struct flat_hash_set_policy
+		{
+			using key_type = T;
+			using value_type = T;
+			using slot_type = T;
+			using reference = const T&;
+			using const_reference = const T&;
+
+			static const key_type& key(const slot_type& _slot) noexcept { return _slot; };
+			static const key_type& key_of(const value_type& _value) noexcept { return _value; };
+			static reference element(slot_type& _slot) noexcept { return _slot; };
+
+			template <typename AllocT, typename... Ts>
+			static void construct(AllocT& _alloc, slot_type* _slot, Ts&&... _args)
+			{
+				std::allocator_traits<AllocT>::construct(_alloc, _slot, std::forward<Ts>(_args)...);
+			};
+
+			template <typename AllocT>
+			static void destroy(AllocT& _alloc, slot_type* _slot) noexcept
+			{
+				std::allocator_traits<AllocT>::destroy(_alloc, _slot);
+			};
+
+			template <typename AllocT>
+			static void transfer(AllocT& _alloc, slot_type* _to, slot_type* _from)
+			{
+				construct(_alloc, _to, std::move(*_from));
+				destroy(_alloc, _from);
+			};
+		};
+	};
+
+	/**
+	 * @brief Unordered set storing its elements inline in an open addressing hash table.
+	 * @tparam T Element type.
+	 * @tparam HashT Hash function object type, defaults to jc::hash_t.
+	 * @tparam EqualT Equality function object type, defaults to jc::equals_t.
+	 * @tparam AllocT Allocator type.
+	*/
+	template <typename T, typename HashT = jc::hash_t, typename EqualT = jc::equals_t, typename AllocT = std::allocator<T>>
+	struct flat_hash_set : public impl::raw_hash_table<impl::flat_hash_set_policy<T>, HashT, EqualT, AllocT>
+	{
+	private:
+		using parent_type = impl::raw_hash_table<impl::flat_hash_set_policy<T>, HashT, EqualT, AllocT>;
+
+	public:
+		using parent_type::parent_type;
+
+		flat_hash_set() = default;
+	};
+};
+
+#endif
@@ -0,0 +1,715 @@
+#pragma once
+#ifndef JCLIB_FLAT_MAP_H
+#define JCLIB_FLAT_MAP_H
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	jc::flat_map is an ordered map stored as two parallel sorted contiguous arrays, one of keys and one of mapped values,
+	intended for lookup tables that are built once and then mostly searched.
+
+	Lookups binary search the contiguous keys without touching the values, which is much friendlier to the cache than
+	the node based std::map. Inserting or erasing a single element is linear, so prefer building the map in bulk.
+	Constructing from, or inserting, a range of elements sorts them all at once and then removes duplicate keys, keeping
+	the first value given for each key.
+
+	Iterators dereference to std::pair<const K&, V&> rather than a reference to a stored pair, the keys and values can
+	also be accessed directly as spans with keys() and values().
+
+	Heterogeneous lookup is enabled when the comparison function object is transparent, see jc::transparent.
+
+	Example Code:
+
+	#include "jclib/flat_map.h"
+
+	const jc::flat_map<std::string, int, jc::transparent<jc::less_t>> _ids
+	{
+		{ "foo", 1 }, { "bar", 2 }
+	};
+	const auto _id = _ids.at("foo");
+*/
+
+#include "jclib/config.h"
+#include "jclib/type_traits.h"
+#include "jclib/functional.h"
+#include "jclib/span.h"
+#include "jclib/flat_set.h"
+
+#define _JCLIB_FLAT_MAP_
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <iterator>
+#include <utility>
+#include <tuple>
+#include <stdexcept>
+#include <initializer_list>
+
+namespace jc
+{
+	/**
+	 * @brief Ordered map stored as parallel sorted contiguous arrays of keys and mapped values.
+	 * @tparam K Key type.
+	 * @tparam V Mapped value type.
+	 * @tparam CompareT Key comparison function object type, defaults to jc::less_t.
+	 * @tparam KeyContainerT Contiguous container type used to store the keys.
+	 * @tparam MappedContainerT Contiguous container type used to store the mapped values.
+	*/
+	template <typename K, typename V, typename CompareT = jc::less_t,
+		typename KeyContainerT = std::vector<K>, typename MappedContainerT = std::vector<V>>
+	struct flat_map
+	{
+	public:
+		using key_type = K;
+		using mapped_type = V;
+		using value_type = std::pair<K, V>;
+		using key_compare = CompareT;
+		using reference = std::pair<const K&, V&>;
+		using const_reference = std::pair<const K&, const V&>;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using key_container_type = KeyContainerT;
+		using mapped_container_type = MappedContainerT;
+
+		/**
+		 * @brief Holds the underlying key and mapped value containers, see extract()
+		*/
+		struct containers
+		{
+			key_container_type keys;
+			mapped_container_type values;
+		};
+
+	private:
+
+		/**
+		 * @brief Lookup argument type, allows heterogeneous lookup with a transparent comparison type
+		*/
+		template <typename KeyT>
+		using key_arg = typename impl::transparent_key_arg<jc::is_transparent<CompareT>::value>::template type<KeyT, key_type>;
+
+		template <bool IsConst>
+		struct iterator_impl
+		{
+		private:
+			using key_iterator = typename KeyContainerT::const_iterator;
+			using value_iterator = std::conditional_t<IsConst,
+				typename MappedContainerT::const_iterator, typename MappedContainerT::iterator>;
+
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = std::pair<K, V>;
+			using reference = std::pair<const K&, std::conditional_t<IsConst, const V&, V&>>;
+			using difference_type = ptrdiff_t;
+
+			/**
+			 * @brief Returned by operator->, holds the reference pair so its members can be accessed
+			*/
+			struct pointer
+			{
+				const reference* operator->() const noexcept { return &this->ref; };
+				reference ref;
+			};
+
+			reference operator*() const { return reference{ *this->key_, *this->value_ }; };
+			pointer operator->() const { return pointer{ **this }; };
+			reference operator[](difference_type _n) const { return *(*this + _n); };
+
+			iterator_impl& operator++() { ++this->key_; ++this->value_; return *this; };
+			iterator_impl operator++(int) { auto _out = *this; ++(*this); return _out; };
+			iterator_impl& operator--() { --this->key_; --this->value_; return *this; };
+			iterator_impl operator--(int) { auto _out = *this; --(*this); return _out; };
+
+			iterator_impl& operator+=(difference_type _n) { this->key_ += _n; this->value_ += _n; return *this; };
+			iterator_impl& operator-=(difference_type _n) { this->key_ -= _n; this->value_ -= _n; return *this; };
+
+			friend iterator_impl operator+(iterator_impl _it, difference_type _n) { return _it += _n; };
+			friend iterator_impl operator+(difference_type _n, iterator_impl _it) { return _it += _n; };
+			friend iterator_impl operator-(iterator_impl _it, difference_type _n) { return _it -= _n; };
+			friend difference_type operator-(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.key_ - rhs.key_; };
+
+			friend bool operator==(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.key_ == rhs.key_; };
+			friend bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.key_ != rhs.key_; };
+			friend bool operator<(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.key_ < rhs.key_; };
+			friend bool operator>(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.key_ > rhs.key_; };
+			friend bool operator<=(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.key_ <= rhs.key_; };
+			friend bool operator>=(const iterator_impl& lhs, const iterator_impl& rhs) { return lhs.key_ >= rhs.key_; };
+
+			// Allow iterator -> const_iterator conversion
+			template <bool OtherConst, typename = jc::enable_if_t<IsConst && !OtherConst>>
+			iterator_impl(const iterator_impl<OtherConst>& _other) :
+				key_{ _other.key_ }, value_{ _other.value_ }
+			{};
+
+			iterator_impl() = default;
+
+		private:
+			friend flat_map;
+			template <bool>
+			friend struct iterator_impl;
+
+			iterator_impl(key_iterator _key, value_iterator _value) :
+				key_{ _key }, value_{ _value }
+			{};
+
+			key_iterator key_;
+			value_iterator value_;
+		};
+
+	public:
+		using iterator = iterator_impl<false>;
+		using const_iterator = iterator_impl<true>;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		iterator begin() noexcept { return iterator{ this->keys_.cbegin(), this->values_.begin() }; };
+		const_iterator begin() const noexcept { return const_iterator{ this->keys_.cbegin(), this->values_.cbegin() }; };
+		const_iterator cbegin() const noexcept { return this->begin(); };
+		iterator end() noexcept { return iterator{ this->keys_.cend(), this->values_.end() }; };
+		const_iterator end() const noexcept { return const_iterator{ this->keys_.cend(), this->values_.cend() }; };
+		const_iterator cend() const noexcept { return this->end(); };
+
+		reverse_iterator rbegin() noexcept { return reverse_iterator{ this->end() }; };
+		const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{ this->end() }; };
+		reverse_iterator rend() noexcept { return reverse_iterator{ this->begin() }; };
+		const_reverse_iterator rend() const noexcept { return const_reverse_iterator{ this->begin() }; };
+
+		/**
+		 * @brief Gets the number of elements held
+		*/
+		size_type size() const noexcept { return this->keys_.size(); };
+
+		/**
+		 * @brief Checks if the map holds no elements
+		*/
+		bool empty() const noexcept { return this->keys_.empty(); };
+
+		size_type max_size() const noexcept { return (std::min)(this->keys_.max_size(), this->values_.max_size()); };
+
+		/**
+		 * @brief Gets a span over the sorted keys
+		*/
+		jc::span<const key_type> keys() const noexcept
+		{
+			return jc::span<const key_type>{ this->keys_.data(), this->keys_.size() };
+		};
+
+		/**
+		 * @brief Gets a span over the mapped values, in the same order as the keys
+		*/
+		jc::span<mapped_type> values() noexcept
+		{
+			return jc::span<mapped_type>{ this->values_.data(), this->values_.size() };
+		};
+
+		/**
+		 * @brief Gets a span over the mapped values, in the same order as the keys
+		*/
+		jc::span<const mapped_type> values() const noexcept
+		{
+			return jc::span<const mapped_type>{ this->values_.data(), this->values_.size() };
+		};
+
+		key_compare key_comp() const { return this->compare_; };
+
+		/**
+		 * @brief Finds the first element whose key is not ordered before the given key
+		*/
+		template <typename KeyT = key_type>
+		iterator lower_bound(const key_arg<KeyT>& _key)
+		{
+			return this->make_iterator(this->key_lower_bound(_key));
+		};
+		template <typename KeyT = key_type>
+		const_iterator lower_bound(const key_arg<KeyT>& _key) const
+		{
+			return const_cast<flat_map*>(this)->lower_bound(_key);
+		};
+
+		/**
+		 * @brief Finds the first element whose key is ordered after the given key
+		*/
+		template <typename KeyT = key_type>
+		iterator upper_bound(const key_arg<KeyT>& _key)
+		{
+			return this->make_iterator(std::upper_bound(this->keys_.cbegin(), this->keys_.cend(), _key, this->compare_));
+		};
+		template <typename KeyT = key_type>
+		const_iterator upper_bound(const key_arg<KeyT>& _key) const
+		{
+			return const_cast<flat_map*>(this)->upper_bound(_key);
+		};
+
+		/**
+		 * @brief Finds the element with a key equivalent to the given key
+		 * @return Iterator to the element, or end() if not found
+		*/
+		template <typename KeyT = key_type>
+		iterator find(const key_arg<KeyT>& _key)
+		{
+			const auto _it = this->key_lower_bound(_key);
+			return (_it != this->keys_.cend() && !this->compare_(_key, *_it)) ? this->make_iterator(_it) : this->end();
+		};
+		template <typename KeyT = key_type>
+		const_iterator find(const key_arg<KeyT>& _key) const
+		{
+			return const_cast<flat_map*>(this)->find(_key);
+		};
+
+		/**
+		 * @brief Finds the range of elements with keys equivalent to the given key, this has at most one element
+		*/
+		template <typename KeyT = key_type>
+		std::pair<iterator, iterator> equal_range(const key_arg<KeyT>& _key)
+		{
+			const auto _it = this->find(_key);
+			return { _it, (_it == this->end()) ? _it : std::next(_it) };
+		};
+		template <typename KeyT = key_type>
+		std::pair<const_iterator, const_iterator> equal_range(const key_arg<KeyT>& _key) const
+		{
+			return const_cast<flat_map*>(this)->equal_range(_key);
+		};
+
+		/**
+		 * @brief Checks if the map holds an element with a key equivalent to the given key
+		*/
+		template <typename KeyT = key_type>
+		bool contains(const key_arg<KeyT>& _key) const
+		{
+			return this->find(_key) != this->end();
+		};
+
+		/**
+		 * @brief Counts the elements with a key equivalent to the given key, either 0 or 1
+		*/
+		template <typename KeyT = key_type>
+		size_type count(const key_arg<KeyT>& _key) const
+		{
+			return this->contains(_key) ? 1 : 0;
+		};
+
+		/**
+		 * @brief Gets the value for a key
+		 * @exception std::out_of_range Thrown if the key is not present and jclib's exception usage is enabled.
+		*/
+		template <typename KeyT = key_type>
+		mapped_type& at(const key_arg<KeyT>& _key)
+		{
+			const auto _it = this->find(_key);
+			if (_it == this->end())
+			{
+				JCLIB_THROW(std::out_of_range("flat_map::at key not found"));
+			};
+			return _it->second;
+		};
+		template <typename KeyT = key_type>
+		const mapped_type& at(const key_arg<KeyT>& _key) const
+		{
+			return const_cast<flat_map*>(this)->at(_key);
+		};
+
+		/**
+		 * @brief Gets the value for a key, inserting a default constructed value if the key is not present
+		*/
+		mapped_type& operator[](const key_type& _key)
+		{
+			return this->try_emplace(_key).first->second;
+		};
+		mapped_type& operator[](key_type&& _key)
+		{
+			return this->try_emplace(std::move(_key)).first->second;
+		};
+
+		/**
+		 * @brief Inserts a value constructed from the given arguments if the key is not present, nothing is
+		 * constructed if the key is already present. This is linear in the size of the map.
+		 * @return Iterator to the element with the key, and true if the value was inserted
+		*/
+		template <typename... Ts>
+		std::pair<iterator, bool> try_emplace(const key_type& _key, Ts&&... _args)
+		{
+			return this->try_emplace_impl(_key, std::forward<Ts>(_args)...);
+		};
+		template <typename... Ts>
+		std::pair<iterator, bool> try_emplace(key_type&& _key, Ts&&... _args)
+		{
+			return this->try_emplace_impl(std::move(_key), std::forward<Ts>(_args)...);
+		};
+
+		/**
+		 * @brief Inserts a value if the key is not present, otherwise assigns the value to the existing element
+		 * @return Iterator to the element with the key, and true if the value was inserted
+		*/
+		template <typename KeyT, typename ValT>
+		std::pair<iterator, bool> insert_or_assign(KeyT&& _key, ValT&& _value)
+		{
+			auto _result = this->try_emplace(std::forward<KeyT>(_key), std::forward<ValT>(_value));
+			if (!_result.second)
+			{
+				_result.first->second = std::forward<ValT>(_value);
+			};
+			return _result;
+		};
+
+		/**
+		 * @brief Inserts a key/value pair if there is no element with an equivalent key
+		 * @return Iterator to the element with the key, and true if the pair was inserted
+		*/
+		std::pair<iterator, bool> insert(const value_type& _value)
+		{
+			return this->try_emplace(_value.first, _value.second);
+		};
+		std::pair<iterator, bool> insert(value_type&& _value)
+		{
+			return this->try_emplace(std::move(_value.first), std::move(_value.second));
+		};
+
+		/**
+		 * @brief Inserts a key/value pair, the hint is ignored
+		*/
+		iterator insert(const_iterator, const value_type& _value)
+		{
+			return this->insert(_value).first;
+		};
+		iterator insert(const_iterator, value_type&& _value)
+		{
+			return this->insert(std::move(_value)).first;
+		};
+
+		/**
+		 * @brief Constructs a key/value pair and inserts it if there is no element with an equivalent key
+		 * @return Iterator to the element with the key, and true if the pair was inserted
+		*/
+		template <typename... Ts>
+		std::pair<iterator, bool> emplace(Ts&&... _args)
+		{
+			return this->insert(value_type(std::forward<Ts>(_args)...));
+		};
+
+		/**
+		 * @brief Inserts a range of key/value pairs, sorting them all at once. Existing elements are kept over
+		 * new elements with equivalent keys, and earlier new elements are kept over later ones.
+		*/
+		template <typename IterT>
+		void insert(IterT _begin, IterT _end)
+		{
+			const auto _sortedCount = this->keys_.size();
+			this->append(_begin, _end);
+			this->sort_unique(_sortedCount, false);
+		};
+
+		/**
+		 * @brief Inserts a range of key/value pairs that are already sorted by key and have unique keys
+		*/
+		template <typename IterT>
+		void insert(sorted_unique_t, IterT _begin, IterT _end)
+		{
+			const auto _sortedCount = this->keys_.size();
+			this->append(_begin, _end);
+			this->sort_unique(_sortedCount, true);
+		};
+
+		void insert(std::initializer_list<value_type> _values)
+		{
+			this->insert(_values.begin(), _values.end());
+		};
+		void insert(sorted_unique_t, std::initializer_list<value_type> _values)
+		{
+			this->insert(jc::sorted_unique, _values.begin(), _values.end());
+		};
+
+		/**
+		 * @brief Erases an element
+		 * @return Iterator to the element after the erased element
+		*/
+		iterator erase(const_iterator _pos)
+		{
+			return this->erase(_pos, std::next(_pos));
+		};
+		iterator erase(iterator _pos)
+		{
+			return this->erase(const_iterator{ _pos });
+		};
+
+		/**
+		 * @brief Erases a range of elements
+		 * @return Iterator to the element after the erased elements
+		*/
+		iterator erase(const_iterator _begin, const_iterator _end)
+		{
+			const auto _first = _begin - this->cbegin();
+			const auto _last = _end - this->cbegin();
+			this->keys_.erase(this->keys_.cbegin() + _first, this->keys_.cbegin() + _last);
+			this->values_.erase(this->values_.cbegin() + _first, this->values_.cbegin() + _last);
+			return this->begin() + _first;
+		};
+
+		/**
+		 * @brief Erases the element with a key equivalent to the given key
+		 * @return Number of elements erased, either 0 or 1
+		*/
+		template <typename KeyT = key_type>
+		size_type erase(const key_arg<KeyT>& _key)
+		{
+			const auto _it = this->find(_key);
+			if (_it == this->end())
+			{
+				return 0;
+			};
+			this->erase(_it);
+			return 1;
+		};
+
+		void clear() noexcept
+		{
+			this->keys_.clear();
+			this->values_.clear();
+		};
+
+		void reserve(size_type _count)
+		{
+			this->keys_.reserve(_count);
+			this->values_.reserve(_count);
+		};
+
+		void shrink_to_fit()
+		{
+			this->keys_.shrink_to_fit();
+			this->values_.shrink_to_fit();
+		};
+
+		/**
+		 * @brief Moves the underlying containers out of the map, leaving the map empty
+		*/
+		containers extract() &&
+		{
+			containers _out{ std::move(this->keys_), std::move(this->values_) };
+			this->clear();
+			return _out;
+		};
+
+		/**
+		 * @brief Replaces the underlying containers, the keys must already be sorted and unique
+		*/
+		void replace(key_container_type&& _keys, mapped_container_type&& _values)
+		{
+			JCLIB_ASSERT(_keys.size() == _values.size());
+			this->keys_ = std::move(_keys);
+			this->values_ = std::move(_values);
+			JCLIB_ASSERT(this->is_sorted_unique(0));
+		};
+
+		void swap(flat_map& _other) noexcept
+		{
+			using std::swap;
+			swap(this->keys_, _other.keys_);
+			swap(this->values_, _other.values_);
+			swap(this->compare_, _other.compare_);
+		};
+		friend void swap(flat_map& lhs, flat_map& rhs) noexcept
+		{
+			lhs.swap(rhs);
+		};
+
+		friend bool operator==(const flat_map& lhs, const flat_map& rhs)
+		{
+			return lhs.keys_ == rhs.keys_ && lhs.values_ == rhs.values_;
+		};
+		friend bool operator!=(const flat_map& lhs, const flat_map& rhs)
+		{
+			return !(lhs == rhs);
+		};
+
+
+
+		flat_map() = default;
+
+		explicit flat_map(const key_compare& _compare) :
+			keys_{}, values_{}, compare_{ _compare }
+		{};
+
+		/**
+		 * @brief Constructs the map from parallel containers of keys and values, sorting them by key and
+		 * removing duplicate keys.
+		*/
+		flat_map(key_container_type _keys, mapped_container_type _values, const key_compare& _compare = key_compare{}) :
+			keys_{ std::move(_keys) }, values_{ std::move(_values) }, compare_{ _compare }
+		{
+			JCLIB_ASSERT(this->keys_.size() == this->values_.size());
+			this->sort_unique(0, false);
+		};
+
+		/**
+		 * @brief Constructs the map from parallel containers of keys and values that are already sorted by key
+		 * and have unique keys.
+		*/
+		flat_map(sorted_unique_t, key_container_type _keys, mapped_container_type _values, const key_compare& _compare = key_compare{}) :
+			keys_{ std::move(_keys) }, values_{ std::move(_values) }, compare_{ _compare }
+		{
+			JCLIB_ASSERT(this->keys_.size() == this->values_.size());
+			JCLIB_ASSERT(this->is_sorted_unique(0));
+		};
+
+		/**
+		 * @brief Constructs the map from a range of key/value pairs, sorting them by key and removing duplicate
+		 * keys.
+		*/
+		template <typename IterT>
+		flat_map(IterT _begin, IterT _end, const key_compare& _compare = key_compare{}) :
+			flat_map(_compare)
+		{
+			this->insert(_begin, _end);
+		};
+
+		template <typename IterT>
+		flat_map(sorted_unique_t, IterT _begin, IterT _end, const key_compare& _compare = key_compare{}) :
+			flat_map(_compare)
+		{
+			this->insert(jc::sorted_unique, _begin, _end);
+		};
+
+		flat_map(std::initializer_list<value_type> _values, const key_compare& _compare = key_compare{}) :
+			flat_map(_values.begin(), _values.end(), _compare)
+		{};
+
+		flat_map(sorted_unique_t, std::initializer_list<value_type> _values, const key_compare& _compare = key_compare{}) :
+			flat_map(jc::sorted_unique, _values.begin(), _values.end(), _compare)
+		{};
+
+	private:
+
+		template <typename KeyT>
+		typename key_container_type::const_iterator key_lower_bound(const KeyT& _key) const
+		{
+			return std::lower_bound(this->keys_.cbegin(), this->keys_.cend(), _key, this->compare_);
+		};
+
+		iterator make_iterator(typename key_container_type::const_iterator _key)
+		{
+			const auto _offset = _key - this->keys_.cbegin();
+			return iterator{ _key, this->values_.begin() + _offset };
+		};
+
+		template <typename KeyT, typename... Ts>
+		std::pair<iterator, bool> try_emplace_impl(KeyT&& _key, Ts&&... _args)
+		{
+			const auto _it = this->key_lower_bound(_key);
+			if (_it != this->keys_.cend() && !this->compare_(_key, *_it))
+			{
+				return { this->make_iterator(_it), false };
+			};
+
+			// The value is built first so a throwing constructor leaves the keys and values in step
+			const auto _offset = _it - this->keys_.cbegin();
+			const auto _value = this->values_.emplace(this->values_.cbegin() + _offset, std::forward<Ts>(_args)...);
+#if JCLIB_EXCEPTIONS_V
+			try
+			{
+				this->keys_.insert(_it, std::forward<KeyT>(_key));
+			}
+			catch (...)
+			{
+				this->values_.erase(_value);
+				throw;
+			};
+#else
+			static_cast<void>(_value);
+			this->keys_.insert(_it, std::forward<KeyT>(_key));
+#endif
+			return { this->begin() + _offset, true };
+		};
+
+		template <typename IterT>
+		void append(IterT _begin, IterT _end)
+		{
+			for (; _begin != _end; ++_begin)
+			{
+				const auto& _value = *_begin;
+				this->keys_.push_back(_value.first);
+				this->values_.push_back(_value.second);
+			};
+		};
+
+		/**
+		 * @brief Checks if the keys after the given index are sorted and unique
+		*/
+		bool is_sorted_unique(size_t _from) const
+		{
+			return std::adjacent_find(this->keys_.cbegin() + _from, this->keys_.cend(), [this](const key_type& lhs, const key_type& rhs)
+			{
+				return !this->compare_(lhs, rhs);
+			}) == this->keys_.cend();
+		};
+
+		/**
+		 * @brief Sorts the elements after the given count and merges them with the sorted elements before it,
+		 * then removes elements with duplicate keys keeping the first of each.
+		 * @param _sortedCount Number of elements at the start that are already sorted and unique.
+		 * @param _isRestSorted True if the remaining elements are also already sorted.
+		*/
+		void sort_unique(size_t _sortedCount, bool _isRestSorted)
+		{
+			const size_t _count = this->keys_.size();
+			if (_sortedCount == _count)
+			{
+				return;
+			};
+
+			// Skip reordering entirely if everything is already in order
+			if (this->is_sorted_unique((_sortedCount == 0) ? 0 : _sortedCount - 1))
+			{
+				return;
+			};
+
+			// Sort an index array so the keys and values can be moved into place together
+			std::vector<size_t> _order(_count);
+			std::iota(_order.begin(), _order.end(), size_t(0));
+
+			const auto _compare = [this](size_t lhs, size_t rhs)
+			{
+				return this->compare_(this->keys_[lhs], this->keys_[rhs]);
+			};
+			const auto _middle = _order.begin() + static_cast<difference_type>(_sortedCount);
+			if (!_isRestSorted)
+			{
+				std::stable_sort(_middle, _order.end(), _compare);
+			};
+			std::inplace_merge(_order.begin(), _middle, _order.end(), _compare);
+
+			key_container_type _keys{};
+			mapped_container_type _values{};
+			_keys.reserve(_count);
+			_values.reserve(_count);
+			for (auto& i : _order)
+			{
+				if (!_keys.empty() && !this->compare_(_keys.back(), this->keys_[i]))
+				{
+					continue;
+				};
+				_keys.push_back(std::move(this->keys_[i]));
+				_values.push_back(std::move(this->values_[i]));
+			};
+			this->keys_ = std::move(_keys);
+			this->values_ = std::move(_values);
+		};
+
+		key_container_type keys_;
+		mapped_container_type values_;
+		key_compare compare_;
+	};
+};
+
+#endif
@@ -0,0 +1,420 @@
+#pragma once
+#ifndef JCLIB_FLAT_SET_H
+#define JCLIB_FLAT_SET_H
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	jc::flat_set is an ordered set stored as a sorted contiguous array, intended for lookup tables that are built once
+	and then mostly searched.
+
+	Lookups binary search the contiguous keys, which is much friendlier to the cache than the node based std::set.
+	Inserting or erasing a single element is linear, so prefer building the set in bulk. Constructing from, or
+	inserting, a range of elements sorts them all at once and then removes duplicates.
+
+	Heterogeneous lookup is enabled when the comparison function object is transparent, see jc::transparent.
+
+	Example Code:
+
+	#include "jclib/flat_set.h"
+
+	const jc::flat_set<int> _primes{ 7, 2, 5, 3, 2 };
+	const bool _isPrime = _primes.contains(5);
+	const jc::span<const int> _keys = _primes.keys(); // { 2, 3, 5, 7 }
+*/
+
+#include "jclib/config.h"
+#include "jclib/type_traits.h"
+#include "jclib/functional.h"
+#include "jclib/span.h"
+
+#define _JCLIB_FLAT_SET_
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <initializer_list>
+
+namespace jc
+{
+	/**
+	 * @brief Tag type for constructing flat containers from elements that are already sorted and unique
+	*/
+	struct sorted_unique_t { constexpr explicit sorted_unique_t() noexcept = default; };
+
+	/**
+	 * @brief Tag value for constructing flat containers from elements that are already sorted and unique
+	*/
+	constexpr static sorted_unique_t sorted_unique{};
+
+	namespace impl
+	{
+		/**
+		 * @brief Removes all but the first of each run of equivalent elements in a sorted container
+		*/
+		template <typename ContainerT, typename CompareT>
+		inline void flat_erase_duplicates(ContainerT& _container, const CompareT& _compare)
+		{
+			using value_type = typename ContainerT::value_type;
+			const auto _last = std::unique(_container.begin(), _container.end(),
+				[&_compare](const value_type& lhs, const value_type& rhs)
+				{
+					return !_compare(lhs, rhs);
+				});
+			_container.erase(_last, _container.end());
+		};
+	};
+
+	/**
+	 * @brief Ordered set stored as a sorted contiguous array.
+	 * @tparam K Element (key) type.
+	 * @tparam CompareT Comparison function object type, defaults to jc::less_t.
+	 * @tparam ContainerT Contiguous container type used to store the elements.
+	*/
+	template <typename K, typename CompareT = jc::less_t, typename ContainerT = std::vector<K>>
+	struct flat_set
+	{
+	public:
+		using key_type = K;
+		using value_type = K;
+		using key_compare = CompareT;
+		using value_compare = CompareT;
+		using container_type = ContainerT;
+		using size_type = typename container_type::size_type;
+		using difference_type = typename container_type::difference_type;
+		using reference = const value_type&;
+		using const_reference = const value_type&;
+		using iterator = typename container_type::const_iterator;
+		using const_iterator = typename container_type::const_iterator;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	private:
+
+		/**
+		 * @brief Lookup argument type, allows heterogeneous lookup with a transparent comparison type
+		*/
+		template <typename KeyT>
+		using key_arg = typename impl::transparent_key_arg<jc::is_transparent<CompareT>::value>::template type<KeyT, key_type>;
+
+	public:
+
+		const_iterator begin() const noexcept { return this->keys_.begin(); };
+		const_iterator cbegin() const noexcept { return this->keys_.begin(); };
+		const_iterator end() const noexcept { return this->keys_.end(); };
+		const_iterator cend() const noexcept { return this->keys_.end(); };
+
+		const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{ this->end() }; };
+		const_reverse_iterator rend() const noexcept { return const_reverse_iterator{ this->begin() }; };
+
+		/**
+		 * @brief Gets the number of elements held
+		*/
+		size_type size() const noexcept { return this->keys_.size(); };
+
+		/**
+		 * @brief Checks if the set holds no elements
+		*/
+		bool empty() const noexcept { return this->keys_.empty(); };
+
+		size_type max_size() const noexcept { return this->keys_.max_size(); };
+
+		/**
+		 * @brief Gets a span over the sorted elements
+		*/
+		jc::span<const key_type> keys() const noexcept
+		{
+			return jc::span<const key_type>{ this->keys_.data(), this->keys_.size() };
+		};
+
+		key_compare key_comp() const { return this->compare_; };
+		value_compare value_comp() const { return this->compare_; };
+
+		/**
+		 * @brief Finds the first element not ordered before the given key
+		*/
+		template <typename KeyT = key_type>
+		const_iterator lower_bound(const key_arg<KeyT>& _key) const
+		{
+			return std::lower_bound(this->keys_.begin(), this->keys_.end(), _key, this->compare_);
+		};
+
+		/**
+		 * @brief Finds the first element ordered after the given key
+		*/
+		template <typename KeyT = key_type>
+		const_iterator upper_bound(const key_arg<KeyT>& _key) const
+		{
+			return std::upper_bound(this->keys_.begin(), this->keys_.end(), _key, this->compare_);
+		};
+
+		/**
+		 * @brief Finds the range of elements equivalent to the given key, this has at most one element
+		*/
+		template <typename KeyT = key_type>
+		std::pair<const_iterator, const_iterator> equal_range(const key_arg<KeyT>& _key) const
+		{
+			const auto _it = this->find(_key);
+			return { _it, (_it == this->end()) ? _it : std::next(_it) };
+		};
+
+		/**
+		 * @brief Finds the element equivalent to the given key
+		 * @return Iterator to the element, or end() if not found
+		*/
+		template <typename KeyT = key_type>
+		const_iterator find(const key_arg<KeyT>& _key) const
+		{
+			const auto _it = this->lower_bound(_key);
+			return (_it != this->end() && !this->compare_(_key, *_it)) ? _it : this->end();
+		};
+
+		/**
+		 * @brief Checks if the set holds an element equivalent to the given key
+		*/
+		template <typename KeyT = key_type>
+		bool contains(const key_arg<KeyT>& _key) const
+		{
+			return this->find(_key) != this->end();
+		};
+
+		/**
+		 * @brief Counts the elements equivalent to the given key, either 0 or 1
+		*/
+		template <typename KeyT = key_type>
+		size_type count(const key_arg<KeyT>& _key) const
+		{
+			return this->contains(_key) ? 1 : 0;
+		};
+
+		/**
+		 * @brief Inserts a value if there is no equivalent element, this is linear in the size of the set
+		 * @return Iterator to the equivalent element, and true if the value was inserted
+		*/
+		std::pair<iterator, bool> insert(const value_type& _value)
+		{
+			return this->emplace(_value);
+		};
+		std::pair<iterator, bool> insert(value_type&& _value)
+		{
+			return this->emplace(std::move(_value));
+		};
+
+		/**
+		 * @brief Inserts a value, the hint is ignored
+		*/
+		iterator insert(const_iterator, const value_type& _value)
+		{
+			return this->insert(_value).first;
+		};
+		iterator insert(const_iterator, value_type&& _value)
+		{
+			return this->insert(std::move(_value)).first;
+		};
+
+		/**
+		 * @brief Constructs a value and inserts it if there is no equivalent element
+		 * @return Iterator to the equivalent element, and true if the value was inserted
+		*/
+		template <typename... Ts>
+		std::pair<iterator, bool> emplace(Ts&&... _args)
+		{
+			value_type _value(std::forward<Ts>(_args)...);
+			const auto _it = this->lower_bound(_value);
+			if (_it != this->end() && !this->compare_(_value, *_it))
+			{
+				return { _it, false };
+			};
+			return { this->keys_.insert(_it, std::move(_value)), true };
+		};
+
+		/**
+		 * @brief Inserts a range of values, sorting them all at once and keeping existing elements over
+		 * equivalent new ones.
+		*/
+		template <typename IterT>
+		void insert(IterT _begin, IterT _end)
+		{
+			const auto _oldSize = static_cast<difference_type>(this->keys_.size());
+			this->keys_.insert(this->keys_.end(), _begin, _end);
+
+			const auto _first = this->keys_.begin();
+			const auto _middle = _first + _oldSize;
+			std::stable_sort(_middle, this->keys_.end(), this->compare_);
+			std::inplace_merge(_first, _middle, this->keys_.end(), this->compare_);
+			impl::flat_erase_duplicates(this->keys_, this->compare_);
+		};
+
+		/**
+		 * @brief Inserts a range of values that are already sorted and unique
+		*/
+		template <typename IterT>
+		void insert(sorted_unique_t, IterT _begin, IterT _end)
+		{
+			const auto _oldSize = static_cast<difference_type>(this->keys_.size());
+			this->keys_.insert(this->keys_.end(), _begin, _end);
+
+			const auto _first = this->keys_.begin();
+			std::inplace_merge(_first, _first + _oldSize, this->keys_.end(), this->compare_);
+			impl::flat_erase_duplicates(this->keys_, this->compare_);
+		};
+
+		void insert(std::initializer_list<value_type> _values)
+		{
+			this->insert(_values.begin(), _values.end());
+		};
+		void insert(sorted_unique_t, std::initializer_list<value_type> _values)
+		{
+			this->insert(jc::sorted_unique, _values.begin(), _values.end());
+		};
+
+		/**
+		 * @brief Erases an element
+		 * @return Iterator to the element after the erased element
+		*/
+		iterator erase(const_iterator _pos)
+		{
+			return this->keys_.erase(_pos);
+		};
+
+		/**
+		 * @brief Erases a range of elements
+		 * @return Iterator to the element after the erased elements
+		*/
+		iterator erase(const_iterator _begin, const_iterator _end)
+		{
+			return this->keys_.erase(_begin, _end);
+		};
+
+		/**
+		 * @brief Erases the element equivalent to the given key
+		 * @return Number of elements erased, either 0 or 1
+		*/
+		template <typename KeyT = key_type>
+		size_type erase(const key_arg<KeyT>& _key)
+		{
+			const auto _it = this->find(_key);
+			if (_it == this->end())
+			{
+				return 0;
+			};
+			this->keys_.erase(_it);
+			return 1;
+		};
+
+		void clear() noexcept { this->keys_.clear(); };
+		void reserve(size_type _count) { this->keys_.reserve(_count); };
+		void shrink_to_fit() { this->keys_.shrink_to_fit(); };
+
+		/**
+		 * @brief Moves the underlying container out of the set, leaving the set empty
+		*/
+		container_type extract() &&
+		{
+			auto _out = std::move(this->keys_);
+			this->keys_.clear();
+			return _out;
+		};
+
+		/**
+		 * @brief Replaces the underlying container, the new elements must already be sorted and unique
+		*/
+		void replace(container_type&& _keys)
+		{
+			this->keys_ = std::move(_keys);
+			JCLIB_ASSERT(this->is_sorted_unique());
+		};
+
+		void swap(flat_set& _other) noexcept
+		{
+			using std::swap;
+			swap(this->keys_, _other.keys_);
+			swap(this->compare_, _other.compare_);
+		};
+		friend void swap(flat_set& lhs, flat_set& rhs) noexcept
+		{
+			lhs.swap(rhs);
+		};
+
+		friend bool operator==(const flat_set& lhs, const flat_set& rhs)
+		{
+			return lhs.keys_ == rhs.keys_;
+		};
+		friend bool operator!=(const flat_set& lhs, const flat_set& rhs)
+		{
+			return !(lhs == rhs);
+		};
+
+
+
+		flat_set() = default;
+
+		explicit flat_set(const key_compare& _compare) :
+			keys_{}, compare_{ _compare }
+		{};
+
+		/**
+		 * @brief Constructs the set from a container of elements, sorting them and removing duplicates
+		*/
+		explicit flat_set(container_type _keys, const key_compare& _compare = key_compare{}) :
+			keys_{ std::move(_keys) }, compare_{ _compare }
+		{
+			std::sort(this->keys_.begin(), this->keys_.end(), this->compare_);
+			impl::flat_erase_duplicates(this->keys_, this->compare_);
+		};
+
+		/**
+		 * @brief Constructs the set from a container of elements that are already sorted and unique
+		*/
+		flat_set(sorted_unique_t, container_type _keys, const key_compare& _compare = key_compare{}) :
+			keys_{ std::move(_keys) }, compare_{ _compare }
+		{
+			JCLIB_ASSERT(this->is_sorted_unique());
+		};
+
+		template <typename IterT>
+		flat_set(IterT _begin, IterT _end, const key_compare& _compare = key_compare{}) :
+			flat_set(container_type(_begin, _end), _compare)
+		{};
+
+		template <typename IterT>
+		flat_set(sorted_unique_t, IterT _begin, IterT _end, const key_compare& _compare = key_compare{}) :
+			flat_set(jc::sorted_unique, container_type(_begin, _end), _compare)
+		{};
+
+		flat_set(std::initializer_list<value_type> _values, const key_compare& _compare = key_compare{}) :
+			flat_set(_values.begin(), _values.end(), _compare)
+		{};
+
+		flat_set(sorted_unique_t, std::initializer_list<value_type> _values, const key_compare& _compare = key_compare{}) :
+			flat_set(jc::sorted_unique, _values.begin(), _values.end(), _compare)
+		{};
+
+	private:
+
+		bool is_sorted_unique() const
+		{
+			return std::adjacent_find(this->keys_.begin(), this->keys_.end(), [this](const key_type& lhs, const key_type& rhs)
+			{
+				return !this->compare_(lhs, rhs);
+			}) == this->keys_.end();
+		};
+
+		container_type keys_;
+		key_compare compare_;
+	};
+};
+
+#endif
@@ -18,13 +18,15 @@
 #include "jclib/config.h"
 #include "jclib/type_traits.h"
 
+#include "jclib/hash.h"
+
 #include <tuple>
 #include <functional>
+#include <string>
+#include <cstdint>
 
 #if JCLIB_FEATURE_STRING_VIEW_V
 	#include <string_view>
-#else
-	#include <string>
 #endif
 
 #define _JCLIB_FUNCTIONAL_
@@ -1315,76 +1317,357 @@ namespace jc
 	};
 
 	/**
-	 * @brief Hash operator type using std::hash for the actual implementation.
+	 * @brief Checks if an operator type has the "is_transparent" tag, see jc::transparent.
+	 * @tparam T Operator type to check.
 	*/
-	struct hash_t : jc::operator_tag
+	template <typename T, typename Enable = void>
+	struct is_transparent : jc::false_type {};
+
+	template <typename T>
+	struct is_transparent<T, std::conditional_t<true, void, typename T::is_transparent>> : jc::true_type {};
+
+#if JCLIB_FEATURE_INLINE_VARIABLES_V
+	/**
+	 * @brief Checks if an operator type has the "is_transparent" tag, see jc::transparent.
+	 * @tparam T Operator type to check.
+	*/
+	template <typename T>
+	constexpr inline bool is_transparent_v = is_transparent<T>::value;
+#endif
+
+	namespace impl
 	{
-		template <typename T>
-		constexpr auto operator()(const T& _value) const
-			noexcept(noexcept(std::hash<T>{}(std::declval<const T&>()))) ->
-			decltype(std::hash<T>{}(std::declval<const T&>()))
+		/**
+		 * @brief Selects the argument type of container lookup functions, this is the key type unless the
+		 * container's operators are transparent. Use as "typename transparent_key_arg<B>::template type<K, KeyT>"
+		 * so that K can still be deduced.
+		*/
+		template <bool IsTransparent>
+		struct transparent_key_arg
 		{
-			return std::hash<T>{}(_value);
+			template <typename K, typename KeyT>
+			using type = K;
 		};
+		template <>
+		struct transparent_key_arg<false>
+		{
+			template <typename K, typename KeyT>
+			using type = KeyT;
+		};
+	};
+
+	/**
+	 * @brief Customization point for hashing a type with jc::hash, specializations provide a static member
+	 * function template hashing a value with the given engine and seed:
+	 *
+	 *		template <typename EngineT>
+	 *		static size_t hash(const T& _value, uint64_t _seed);
+	 *
+	 * @tparam T Type to hash
+	 * @tparam Enable SFINAE specialization point
+	*/
+	template <typename T, typename Enable = void>
+	struct hash_traits {};
 
+	namespace impl
+	{
+		/**
+		 * @brief Overload priority tag for hash_value(), higher values are preferred
+		*/
 		template <size_t N>
-		constexpr size_t operator()(const char(&_value)[N]) const noexcept
+		struct hash_priority : hash_priority<N - 1> {};
+		template <>
+		struct hash_priority<0> {};
+
+		/**
+		 * @brief Hashes types without a specialized overload by mixing their std::hash value
+		*/
+		template <typename EngineT, typename T>
+		inline auto hash_value(const T& _value, uint64_t _seed, hash_priority<0>)
+			noexcept(noexcept(std::hash<T>{}(std::declval<const T&>()))) ->
+			decltype(std::hash<T>{}(std::declval<const T&>()), size_t())
 		{
-#if JCLIB_FEATURE_STRING_VIEW_V
-			return std::hash<std::string_view>{}(std::string_view{ _value, N });
-#else
-			return std::hash<std::string>{}(std::string{ _value, N });
-#endif
+			return static_cast<size_t>(EngineT::hash_integer(static_cast<uint64_t>(std::hash<T>{}(_value)), _seed));
 		};
 
-		template <size_t N>
-		constexpr size_t operator()(const wchar_t(&_value)[N]) const noexcept
+		/**
+		 * @brief Hashes integers and enums
+		*/
+		template <typename EngineT, typename T, typename = jc::enable_if_t<std::is_integral<T>::value || std::is_enum<T>::value>>
+		inline size_t hash_value(const T& _value, uint64_t _seed, hash_priority<1>) noexcept
 		{
-#if JCLIB_FEATURE_STRING_VIEW_V
-			return std::hash<std::wstring_view>{}(std::wstring_view{ _value, N });
-#else
-			return std::hash<std::wstring>{}(std::wstring{ _value, N });
-#endif
+			return static_cast<size_t>(EngineT::hash_integer(static_cast<uint64_t>(_value), _seed));
 		};
-		
-		template <size_t N>
-		constexpr size_t operator()(const char16_t(&_value)[N]) const noexcept
+
+		/**
+		 * @brief Hashes pointers by address
+		*/
+		template <typename EngineT, typename T>
+		inline size_t hash_value(T* const& _value, uint64_t _seed, hash_priority<1>) noexcept
 		{
-#if JCLIB_FEATURE_STRING_VIEW_V
-			return std::hash<std::u16string_view>{}(std::u16string_view{ _value, N });
-#else
-			return std::hash<std::u16string>{}(std::u16string{ _value, N });
-#endif
+			return static_cast<size_t>(EngineT::hash_integer(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(_value)), _seed));
 		};
-		
-		template <size_t N>
-		constexpr size_t operator()(const char32_t(&_value)[N]) const noexcept
+
+		/**
+		 * @brief Hashes a contiguous sequence of characters
+		*/
+		template <typename EngineT, typename CharT>
+		inline size_t hash_characters(const CharT* _data, size_t _count, uint64_t _seed) noexcept
 		{
-#if JCLIB_FEATURE_STRING_VIEW_V
-			return std::hash<std::u32string_view>{}(std::u32string_view{ _value, N });
-#else
-			return std::hash<std::u32string>{}(std::u32string{ _value, N });
-#endif
+			return static_cast<size_t>(EngineT::hash_bytes(_data, _count * sizeof(CharT), _seed));
 		};
 
-#if JCLIB_FEATURE_CHAR8_V
-		template <size_t N>
-		constexpr size_t operator()(const char8_t(&_value)[N]) const noexcept
+		/**
+		 * @brief Hashes strings by their characters
+		*/
+		template <typename EngineT, typename CharT, typename TraitsT, typename AllocT>
+		inline size_t hash_value(const std::basic_string<CharT, TraitsT, AllocT>& _value, uint64_t _seed, hash_priority<2>) noexcept
 		{
+			return impl::hash_characters<EngineT>(_value.data(), _value.size(), _seed);
+		};
+
 #if JCLIB_FEATURE_STRING_VIEW_V
-			return std::hash<std::u8string_view>{}(std::u8string_view{ _value, N });
-#else
-			return std::hash<std::u8string>{}(std::u8string{ _value, N });
-#endif
+		/**
+		 * @brief Hashes string views by their characters
+		*/
+		template <typename EngineT, typename CharT, typename TraitsT>
+		inline size_t hash_value(const std::basic_string_view<CharT, TraitsT>& _value, uint64_t _seed, hash_priority<2>) noexcept
+		{
+			return impl::hash_characters<EngineT>(_value.data(), _value.size(), _seed);
 		};
 #endif
+
+		/**
+		 * @brief Hashes string literals by their characters, excluding the null terminator.
+		 * Usable in constant expressions, giving the same value as hashing the characters at runtime.
+		*/
+		template <typename EngineT, typename CharT, size_t N, typename = jc::enable_if_t<jc::is_character<CharT>::value>>
+		constexpr size_t hash_value(const CharT(&_value)[N], uint64_t _seed, hash_priority<2>) noexcept
+		{
+			static_assert(N != 0, "string literal must include a null terminator");
+			return static_cast<size_t>(EngineT::hash_characters(_value, N - 1, _seed));
+		};
+
+		/**
+		 * @brief Hashes types with a jc::hash_traits specialization
+		*/
+		template <typename EngineT, typename T>
+		inline auto hash_value(const T& _value, uint64_t _seed, hash_priority<3>) ->
+			decltype(jc::hash_traits<T>::template hash<EngineT>(_value, _seed))
+		{
+			return jc::hash_traits<T>::template hash<EngineT>(_value, _seed);
+		};
+
+		/**
+		 * @brief Hashes a value with the given engine and seed
+		*/
+		template <typename EngineT, typename T>
+		constexpr auto hash_value(const T& _value, uint64_t _seed)
+			noexcept(noexcept(impl::hash_value<EngineT>(_value, _seed, hash_priority<3>{}))) ->
+			decltype(impl::hash_value<EngineT>(_value, _seed, hash_priority<3>{}))
+		{
+			return impl::hash_value<EngineT>(_value, _seed, hash_priority<3>{});
+		};
 	};
 
 	/**
-	 * @brief Hash operator using std::hash for the actual implementation.
+	 * @brief Hash operator type using a fast hash engine for integers and strings, other types are hashed by
+	 * mixing their std::hash value.
+	 * 
+	 * String literals are hashed without their null terminator and can be hashed in constant expressions:
+	 * 
+	 *		switch (jc::hash(_name))
+	 *		{
+	 *		case jc::hash("foo"):
+	 *			break;
+	 *		};
+	 * @tparam EngineT Hash engine type, see jc::wyhash_engine
+	*/
+	template <typename EngineT = default_hash_engine>
+	struct basic_hash_t : jc::operator_tag
+	{
+		/**
+		 * @brief Hash engine type used
+		*/
+		using engine_type = EngineT;
+
+		template <typename T>
+		constexpr auto operator()(const T& _value) const
+			noexcept(noexcept(impl::hash_value<EngineT>(_value, 0))) ->
+			decltype(impl::hash_value<EngineT>(_value, 0))
+		{
+			return impl::hash_value<EngineT>(_value, 0);
+		};
+	};
+
+	/**
+	 * @brief Seeded hash operator type, hashes the same types as basic_hash_t.
+	 * @tparam EngineT Hash engine type, see jc::wyhash_engine
+	*/
+	template <typename EngineT = default_hash_engine>
+	struct basic_seeded_hash_t : jc::operator_tag
+	{
+		/**
+		 * @brief Hash engine type used
+		*/
+		using engine_type = EngineT;
+
+		template <typename T>
+		constexpr auto operator()(const T& _value) const
+			noexcept(noexcept(impl::hash_value<EngineT>(_value, 0))) ->
+			decltype(impl::hash_value<EngineT>(_value, 0))
+		{
+			return impl::hash_value<EngineT>(_value, this->seed_);
+		};
+
+		/**
+		 * @brief Gets the seed value used
+		*/
+		JCLIB_CONSTEXPR uint64_t seed() const noexcept
+		{
+			return this->seed_;
+		};
+
+		JCLIB_CONSTEXPR basic_seeded_hash_t() noexcept = default;
+		JCLIB_CONSTEXPR explicit basic_seeded_hash_t(uint64_t _seed) noexcept :
+			seed_{ _seed }
+		{};
+
+	private:
+		uint64_t seed_ = 0;
+	};
+
+	/**
+	 * @brief Hash operator type using the default hash engine.
+	*/
+	using hash_t = basic_hash_t<>;
+
+	/**
+	 * @brief Seeded hash operator type using the default hash engine.
+	*/
+	using seeded_hash_t = basic_seeded_hash_t<>;
+
+	/**
+	 * @brief Hash operator using the default hash engine.
 	*/
 	constexpr static hash_t hash{};
 
+	namespace impl
+	{
+		/**
+		 * @brief Checks if a type can be hashed with the given hash engine
+		*/
+		template <typename EngineT, typename T, typename Enable = void>
+		struct is_hashable : jc::false_type {};
+
+		template <typename EngineT, typename T>
+		struct is_hashable<EngineT, T, decltype(void(impl::hash_value<EngineT>(std::declval<const T&>(), 0)))> :
+			jc::true_type
+		{};
+
+		/**
+		 * @brief Folds a hash value into the running state of a structural hash
+		*/
+		template <typename EngineT>
+		inline uint64_t hash_fold(uint64_t _state, size_t _hash) noexcept
+		{
+			return EngineT::hash_integer(static_cast<uint64_t>(_hash), _state);
+		};
+
+		/**
+		 * @brief Hashes each value with the given seed and folds the results, in order, into the given state
+		*/
+		template <typename EngineT, typename... Ts>
+		inline auto hash_sequence(uint64_t _state, uint64_t _seed, const Ts&... _values) ->
+			jc::enable_if_t<jc::conjunction<impl::is_hashable<EngineT, Ts>...>::value, size_t>
+		{
+			// Seed is unused when there are no values
+			(void)_seed;
+
+			using expand = int[];
+			(void)expand{ 0, (_state = impl::hash_fold<EngineT>(_state, impl::hash_value<EngineT>(_values, _seed)), 0)... };
+			return static_cast<size_t>(_state);
+		};
+
+		/**
+		 * @brief Hashes the elements of a tuple-like value in order
+		*/
+		template <typename EngineT, typename T, size_t... Idxs>
+		inline auto hash_tuple(const T& _value, uint64_t _seed, std::index_sequence<Idxs...>) ->
+			decltype(impl::hash_sequence<EngineT>(_seed, _seed, std::get<Idxs>(_value)...))
+		{
+			return impl::hash_sequence<EngineT>(_seed, _seed, std::get<Idxs>(_value)...);
+		};
+	};
+
+	/**
+	 * @brief Combines a hash value with the hashes of one or more values, the result depends on the order
+	 * the values are given in.
+	 *
+	 *		size_t _hash = jc::hash(_name);
+	 *		_hash = jc::hash_combine(_hash, _x, _y);
+	 *
+	 * @param _hash Hash value to combine into
+	 * @param _values Values to hash and combine
+	 * @return Combined hash value
+	*/
+	template <typename... Ts>
+	inline auto hash_combine(size_t _hash, const Ts&... _values) ->
+		decltype(impl::hash_sequence<default_hash_engine>(_hash, 0, _values...))
+	{
+		return impl::hash_sequence<default_hash_engine>(_hash, 0, _values...);
+	};
+
+	/**
+	 * @brief Hashes a pair by combining the hashes of its members
+	*/
+	template <typename FirstT, typename SecondT>
+	struct hash_traits<std::pair<FirstT, SecondT>>
+	{
+		template <typename EngineT>
+		static auto hash(const std::pair<FirstT, SecondT>& _value, uint64_t _seed) ->
+			decltype(impl::hash_sequence<EngineT>(_seed, _seed, _value.first, _value.second))
+		{
+			return impl::hash_sequence<EngineT>(_seed, _seed, _value.first, _value.second);
+		};
+	};
+
+	/**
+	 * @brief Hashes a tuple by combining the hashes of its elements
+	*/
+	template <typename... Ts>
+	struct hash_traits<std::tuple<Ts...>>
+	{
+		template <typename EngineT>
+		static auto hash(const std::tuple<Ts...>& _value, uint64_t _seed) ->
+			decltype(impl::hash_tuple<EngineT>(_value, _seed, std::index_sequence_for<Ts...>{}))
+		{
+			return impl::hash_tuple<EngineT>(_value, _seed, std::index_sequence_for<Ts...>{});
+		};
+	};
+
+	/**
+	 * @brief Hashes the values in an arguement pack, the same as hashing a tuple of the values
+	*/
+	template <typename... Ts>
+	struct hash_traits<impl::argpack<Ts...>>
+	{
+	private:
+		template <typename EngineT, size_t... Idxs>
+		static auto hash_impl(const impl::argpack<Ts...>& _value, uint64_t _seed, std::index_sequence<Idxs...>) ->
+			decltype(impl::hash_sequence<EngineT>(_seed, _seed, std::get<Idxs>(_value.args).unpack()...))
+		{
+			return impl::hash_sequence<EngineT>(_seed, _seed, std::get<Idxs>(_value.args).unpack()...);
+		};
+	public:
+		template <typename EngineT>
+		static auto hash(const impl::argpack<Ts...>& _value, uint64_t _seed) ->
+			decltype(hash_impl<EngineT>(_value, _seed, std::index_sequence_for<Ts...>{}))
+		{
+			return hash_impl<EngineT>(_value, _seed, std::index_sequence_for<Ts...>{});
+		};
+	};
+
 };
 
 // Required to prevent issues with jc::wildcard operator argument probing.
@@ -23,6 +23,9 @@
 
 	This has substantially less compile-time code generation when compiling in Debug mode.
 
+	jc::unique_functor<> is the move-only counterpart, it can hold move-only function objects and take
+	the function object held by a jc::functor<>.
+
 	Example Code:
 
 	#include "jclib/functor.h"
@@ -66,95 +69,46 @@
 #include <utility>
 #include <new>
 #include <tuple>
+#include <cstddef>
+#include <memory>
+#include <functional>
 
 namespace jc
 {
 	namespace impl
 	{
 		/**
-		 * @brief Base type for function pointer wrapper type erasure
+		 * @brief Free function pointer type for a function signature
+		 * @tparam isNoexcept Specifies the function pointer is noexcept
 		 * @tparam ReturnT Function return type
 		 * @tparam ...ArgTs Function arguement types
 		*/
 		template <bool isNoexcept, typename ReturnT, typename... ArgTs>
-		struct function_pointer_base
+		struct free_function_pointer
 		{
-		public:
-			// Function return type
 			using return_type = ReturnT;
-
-			// Function argument typelist (tuple)
-			using argument_typelist = std::tuple<ArgTs...>;
-
-			
-			JCLIB_NODISCARD("owning pointer") virtual function_pointer_base* clone() const = 0;
-			
-			
-			virtual return_type invoke(ArgTs... _a) const = 0;
-
-			virtual ~function_pointer_base() = default;
-		};
-
-		/**
-		 * @brief Free function pointer wrapper 
-		 * @tparam ReturnT Function return type
-		 * @tparam ...ArgTs Function arguement types
-		*/
-		template <bool isNoexcept, typename ReturnT, typename... ArgTs>
-		struct free_function_pointer : public function_pointer_base<isNoexcept, ReturnT, ArgTs...>
-		{
-		private:
-			// alias to ease the pain
-			using parent_type = function_pointer_base<isNoexcept, ReturnT, ArgTs...>;
-
-		public:
-			using return_type = typename parent_type::return_type;
 			
-			// Internal function pointer type
+			// Function pointer type
 			using function_pointer_type = std::conditional_t<isNoexcept,
 				return_type(*)(ArgTs...) noexcept,
 				return_type(*)(ArgTs...)>;
-
-			JCLIB_NODISCARD("owning pointer") parent_type* clone() const final
-			{
-				return new free_function_pointer{ *this };
-			};
-			return_type invoke(ArgTs... args) const final
-			{
-				const auto& _function = this->ptr_;
-				JCLIB_ASSERT(_function != nullptr);
-				return (*_function)(args...);
-			};
-
-			JCLIB_CONSTEXPR free_function_pointer(const function_pointer_type& _p) noexcept :
-				ptr_{ _p }
-			{};
-			JCLIB_CONSTEXPR free_function_pointer() noexcept = default;
-
-		private:
-			function_pointer_type ptr_ = nullptr;
-
 		};
 
 		/**
-		 * @brief Base type for member function pointer type erasure, this is the reason why inheritance is even being used
+		 * @brief Member function pointer type for a function signature
+		 * @tparam isNoexcept Specifies the function pointer is noexcept
+		 * @tparam isConst Specifies the member function is const
 		 * @tparam ReturnT Function return type
 		 * @tparam ClassT The member function's class type
 		 * @tparam ...ArgTs Function arguement types
 		*/
 		template <bool isNoexcept, bool isConst, typename ReturnT, class ClassT, typename... ArgTs>
-		struct member_function_pointer : public function_pointer_base<isNoexcept, ReturnT, ArgTs...>
+		struct member_function_pointer
 		{
-		private:
-			using parent_type = function_pointer_base<isNoexcept, ReturnT, ArgTs...>;
-
-			using class_pointer = std::conditional_t<isConst, const ClassT*, ClassT*>;
-
-		public:
 			using class_type = ClassT;
-			using return_type = typename parent_type::return_type;
+			using return_type = ReturnT;
 
-			// Internal function pointer type
+			// Member function pointer type
 			using function_pointer_type = std::conditional_t<isConst,
 #ifdef __cpp_noexcept_function_type
 				std::conditional_t<isNoexcept,
@@ -170,61 +124,251 @@ namespace jc
 				return_type(class_type::*)(ArgTs...)
 #endif
 			>;
+		};
+
+		/**
+		 * @brief Size in bytes of the inline storage buffer held by each functor
+		*/
+		constexpr static size_t functor_storage_size = sizeof(void*) * 4;
+
+		/**
+		 * @brief Alignment of the inline storage buffer held by each functor
+		*/
+		constexpr static size_t functor_storage_align = alignof(std::max_align_t);
+
+		/**
+		 * @brief Storage for a functor's function object, either the object itself or a pointer to it when it does not fit
+		*/
+		union functor_storage
+		{
+			alignas(functor_storage_align) unsigned char buffer[functor_storage_size];
+			void* pointer;
+		};
+	};
+
+	/**
+	 * @brief Tests if a function object type can be stored inline within a functor without allocating
+	 * @tparam T Function object type to test
+	*/
+	template <typename T>
+	struct is_functor_inline : public bool_constant
+		<
+			sizeof(T) <= impl::functor_storage_size &&
+			impl::functor_storage_align % alignof(T) == 0 &&
+			std::is_nothrow_move_constructible<T>::value
+		>
+	{};
+
+#if JCLIB_FEATURE_INLINE_VARIABLES_V
+	/**
+	 * @brief Tests if a function object type can be stored inline within a functor without allocating
+	 * @tparam T Function object type to test
+	*/
+	template <typename T>
+	constexpr inline bool is_functor_inline_v = is_functor_inline<T>::value;
+#endif
 
-			parent_type* clone() const final
+	namespace impl
+	{
+		/**
+		 * @brief Tests if a function object can be invoked with the given signature
+		 * @tparam isNoexcept Specifies the invocation must be noexcept
+		 * @tparam OpT Function object type
+		 * @tparam Enable SFINAE specialization point
+		*/
+		template <bool isNoexcept, typename OpT, typename Enable, typename ReturnT, typename... ArgTs>
+		struct is_functor_invocable_impl : jc::false_type {};
+
+		template <bool isNoexcept, typename OpT, typename ReturnT, typename... ArgTs>
+		struct is_functor_invocable_impl<isNoexcept, OpT,
+			decltype(void(std::declval<OpT&>()(std::declval<ArgTs>()...))), ReturnT, ArgTs...
+		> : jc::bool_constant
+			<
+				(std::is_void<ReturnT>::value || jc::is_convertible<decltype(std::declval<OpT&>()(std::declval<ArgTs>()...)), ReturnT>::value) &&
+				(!isNoexcept || noexcept(std::declval<OpT&>()(std::declval<ArgTs>()...)))
+			>
+		{};
+
+		template <bool isNoexcept, typename OpT, typename ReturnT, typename... ArgTs>
+		using is_functor_invocable = is_functor_invocable_impl<isNoexcept, OpT, void, ReturnT, ArgTs...>;
+
+		/**
+		 * @brief Member function pointer bound to an object pointer, invoked like a free function
+		 * @tparam FunctionT Member function pointer type
+		 * @tparam ClassPointerT Object pointer type
+		*/
+		template <typename FunctionT, typename ClassPointerT>
+		struct bound_member_function
+		{
+		public:
+			template <typename... Ts>
+			auto operator()(Ts&&... _args) const
+				noexcept(noexcept(((*std::declval<ClassPointerT>()).*std::declval<FunctionT>())(std::forward<Ts>(_args)...)))
+				-> decltype(((*std::declval<ClassPointerT>()).*std::declval<FunctionT>())(std::forward<Ts>(_args)...))
 			{
-				return new member_function_pointer{ *this };
+				return ((*this->class_).*this->function_)(std::forward<Ts>(_args)...);
 			};
-			return_type invoke(ArgTs... args) const final
+
+			bound_member_function(FunctionT _function, ClassPointerT _class) noexcept :
+				function_{ _function }, class_{ _class }
 			{
-				auto& _class = this->class_;
-				auto& _function = this->ptr_;
-				JCLIB_ASSERT(_class != nullptr && _function != nullptr);
-				return ((*_class).*_function)(args...);
+				JCLIB_ASSERT(this->function_ != nullptr && this->class_ != nullptr);
 			};
 
-			JCLIB_CONSTEXPR member_function_pointer(const function_pointer_type& _function, class_pointer _class) noexcept :
-				ptr_{ _function }, class_{ _class }
-			{};
+		private:
+			FunctionT function_;
+			ClassPointerT class_;
+		};
 
-			JCLIB_CONSTEXPR member_function_pointer() noexcept = default;
+		/**
+		 * @brief Constructs, copies, moves and destroys function objects held within functor_storage
+		 * @tparam OpT Function object type
+		 * @tparam isInline True if the function object lives in the storage buffer, false if it is heap allocated
+		*/
+		template <typename OpT, bool isInline = is_functor_inline<OpT>::value>
+		struct functor_object_storage;
 
-		private:
-			function_pointer_type ptr_ = nullptr;
-			class_pointer class_ = nullptr;
+		template <typename OpT>
+		struct functor_object_storage<OpT, true>
+		{
+			static OpT& get(functor_storage& _storage) noexcept
+			{
+				return *reinterpret_cast<OpT*>(_storage.buffer);
+			};
+			static const OpT& get(const functor_storage& _storage) noexcept
+			{
+				return *reinterpret_cast<const OpT*>(_storage.buffer);
+			};
+
+			template <typename... Ts>
+			static void construct(functor_storage& _storage, Ts&&... _args)
+			{
+				new (_storage.buffer) OpT(std::forward<Ts>(_args)...);
+			};
+			static void copy(const functor_storage& _from, functor_storage& _to)
+			{
+				construct(_to, get(_from));
+			};
+			static void move(functor_storage& _from, functor_storage& _to) noexcept
+			{
+				construct(_to, std::move(get(_from)));
+				destroy(_from);
+			};
+			static void destroy(functor_storage& _storage) noexcept
+			{
+				get(_storage).~OpT();
+			};
+		};
+
+		template <typename OpT>
+		struct functor_object_storage<OpT, false>
+		{
+			static OpT& get(functor_storage& _storage) noexcept
+			{
+				return *static_cast<OpT*>(_storage.pointer);
+			};
+			static const OpT& get(const functor_storage& _storage) noexcept
+			{
+				return *static_cast<const OpT*>(_storage.pointer);
+			};
+
+			template <typename... Ts>
+			static void construct(functor_storage& _storage, Ts&&... _args)
+			{
+				_storage.pointer = new OpT(std::forward<Ts>(_args)...);
+			};
+			static void copy(const functor_storage& _from, functor_storage& _to)
+			{
+				construct(_to, get(_from));
+			};
+			static void move(functor_storage& _from, functor_storage& _to) noexcept
+			{
+				_to.pointer = _from.pointer;
+				_from.pointer = nullptr;
+			};
+			static void destroy(functor_storage& _storage) noexcept
+			{
+				delete static_cast<OpT*>(_storage.pointer);
+			};
+		};
+
+		/**
+		 * @brief Function pointers used to manage a type erased function object held within functor_storage
+		*/
+		struct functor_vtable
+		{
+			// Copy constructs the function object into empty storage, nullptr if the function object is move-only
+			void(*copy)(const functor_storage& _from, functor_storage& _to);
+			// Move constructs the function object into empty storage, leaving the source storage empty
+			void(*move)(functor_storage& _from, functor_storage& _to);
+			// Destroys the function object, leaving the storage empty
+			void(*destroy)(functor_storage& _storage);
+		};
+
+		template <typename OpT>
+		constexpr auto get_functor_copy_function(jc::true_type) noexcept
+		{
+			return &functor_object_storage<OpT>::copy;
+		};
+		template <typename OpT>
+		constexpr auto get_functor_copy_function(jc::false_type) noexcept
+		{
+			return static_cast<void(*)(const functor_storage&, functor_storage&)>(nullptr);
+		};
+
+		/**
+		 * @brief Gets the function pointer table for a function object type, shared by every functor holding that type
+		 * @tparam OpT Function object type
+		*/
+		template <typename OpT>
+		inline const functor_vtable* get_functor_vtable() noexcept
+		{
+			static const functor_vtable _vtable
+			{
+				impl::get_functor_copy_function<OpT>(jc::bool_constant<std::is_copy_constructible<OpT>::value>{}),
+				&functor_object_storage<OpT>::move,
+				&functor_object_storage<OpT>::destroy
+			};
+			return &_vtable;
 		};
 
 		/**
-		 * @brief function_pointer_base RAII wrapper and functor interface implementation
+		 * @brief Type erased function object interface implementation used by functor and unique_functor
+		 * 
+		 * Function objects are stored directly, within the functor's inline storage if they fit and on the heap otherwise. Invoking
+		 * goes through a single function pointer (thunk) held by the functor, while copying, moving and destroying go through a
+		 * statically allocated table of function pointers shared by every functor holding the same function object type.
+		 * 
+		 * @tparam isCopyable Specifies the functor is copyable, move-only function objects can only be held if false
 		 * @tparam isNoexcept Specifies the function pointer is noexcept
 		 * @tparam ReturnT Function return type
 		 * @tparam ...ArgTs Function arguement types
 		*/
-		template <bool isNoexcept, typename ReturnT, typename... ArgTs>
+		template <bool isCopyable, bool isNoexcept, typename ReturnT, typename... ArgTs>
 		struct functor_impl
 		{
 		private:
-			using free_function_object_type = free_function_pointer<isNoexcept, ReturnT, ArgTs...>;
-			using free_function_type = typename free_function_object_type::function_pointer_type;
+			template <bool, bool, typename, typename...>
+			friend struct functor_impl;
+
+			using free_function_type = typename free_function_pointer<isNoexcept, ReturnT, ArgTs...>::function_pointer_type;
 
 			template <typename ClassT>
-			using member_function_object_type = member_function_pointer<isNoexcept, false, ReturnT, ClassT, ArgTs...>;
+			using member_function_type = typename member_function_pointer<isNoexcept, false, ReturnT, ClassT, ArgTs...>::function_pointer_type;
 
 			template <typename ClassT>
-			using member_function_type = typename member_function_object_type<ClassT>::function_pointer_type;
+			using member_function_object_type = bound_member_function<member_function_type<ClassT>, ClassT*>;
 			
 			template <typename ClassT>
-			using const_member_function_object_type = member_function_pointer<isNoexcept, true, ReturnT, ClassT, ArgTs...>;
+			using const_member_function_type = typename member_function_pointer<isNoexcept, true, ReturnT, ClassT, ArgTs...>::function_pointer_type;
 
 			template <typename ClassT>
-			using const_member_function_type = typename const_member_function_object_type<ClassT>::function_pointer_type;
+			using const_member_function_object_type = bound_member_function<const_member_function_type<ClassT>, const ClassT*>;
 
-		public:
+			// Free functions should never need to allocate
+			static_assert(is_functor_inline<free_function_type>::value, "free function pointer must fit in functor storage");
 
-			/**
-			 * @brief Underlying pointer type owned / managed
-			*/
-			using pointer = function_pointer_base<isNoexcept, ReturnT, ArgTs...>*;
+		public:
 
 			using return_type = ReturnT;
 
@@ -242,25 +386,110 @@ namespace jc
 				return isNoexcept;
 			};
 
+			/**
+			 * @brief Returns true if the functor can be copied
+			*/
+			JCLIB_CONSTEXPR static bool is_copyable() noexcept
+			{
+				return isCopyable;
+			};
+
+		protected:
+
+			/**
+			 * @brief Copies the function object held by another functor, must not hold a function object
+			 * @param _other Functor to copy from
+			*/
+			void assign_copy(const functor_impl& _other)
+			{
+				static_assert(isCopyable, "move-only functor cannot be copied");
+				JCLIB_ASSERT(!this->good());
+				if (_other.good())
+				{
+					JCLIB_ASSERT(_other.vtable_->copy != nullptr);
+					_other.vtable_->copy(_other.storage_, this->storage_);
+					this->invoke_ = _other.invoke_;
+					this->vtable_ = _other.vtable_;
+				};
+			};
+
 		private:
-			JCLIB_CONSTEXPR pointer& get() noexcept
+
+			/**
+			 * @brief Function pointer used to invoke the held function object
+			*/
+			using invoke_function_type = return_type(*)(functor_storage&, ArgTs&&...);
+
+			template <typename OpT>
+			static return_type invoke_object(functor_storage& _storage, ArgTs&&... _args)
+			{
+				return static_cast<return_type>(functor_object_storage<OpT>::get(_storage)(std::forward<ArgTs>(_args)...));
+			};
+
+			/**
+			 * @brief Constructs a function object, using the inline storage if it fits, must not hold a function object
+			 * @tparam OpT Function object type
+			 * @param _args Function object constructor arguements
+			*/
+			template <typename OpT, typename... Ts>
+			void emplace(Ts&&... _args)
 			{
-				return this->ptr_;
+				JCLIB_ASSERT(!this->good());
+				functor_object_storage<OpT>::construct(this->storage_, std::forward<Ts>(_args)...);
+				this->invoke_ = &functor_impl::invoke_object<OpT>;
+				this->vtable_ = impl::get_functor_vtable<OpT>();
 			};
-			JCLIB_CONSTEXPR const pointer& get() const noexcept
+
+			/**
+			 * @brief Takes the function object held by another functor, must not hold a function object
+			 * @param _other Functor to take from, will hold nothing afterwards
+			*/
+			template <bool isOtherCopyable>
+			void assign_move(functor_impl<isOtherCopyable, isNoexcept, ReturnT, ArgTs...>& _other) noexcept
 			{
-				return this->ptr_;
+				JCLIB_ASSERT(!this->good());
+				if (_other.good())
+				{
+					_other.vtable_->move(_other.storage_, this->storage_);
+					this->invoke_ = _other.invoke_;
+					this->vtable_ = _other.vtable_;
+					_other.invoke_ = nullptr;
+					_other.vtable_ = nullptr;
+				};
 			};
 
+			/**
+			 * @brief Tests if a type is a functor with the same signature
+			*/
+			template <typename T>
+			using is_functor_impl = jc::bool_constant
+			<
+				std::is_base_of<functor_impl<true, isNoexcept, ReturnT, ArgTs...>, T>::value ||
+				std::is_base_of<functor_impl<false, isNoexcept, ReturnT, ArgTs...>, T>::value
+			>;
+
+			/**
+			 * @brief Tests if a function object can be held by this functor
+			 * @tparam OpT Function object type, decayed
+			*/
+			template <typename OpT>
+			using is_acceptable_function_object = jc::bool_constant
+			<
+				!is_functor_impl<OpT>::value &&
+				std::is_move_constructible<OpT>::value &&
+				(!isCopyable || std::is_copy_constructible<OpT>::value) &&
+				is_functor_invocable<isNoexcept, OpT, ReturnT, ArgTs...>::value
+			>;
+
 		public:
 
 			/**
-			 * @brief Returns true if the owned function pointer can be invoked
+			 * @brief Returns true if the held function object can be invoked
 			 * @return True if possible, false otherwise
 			*/
 			JCLIB_CONSTEXPR bool good() const noexcept
 			{
-				return this->get() != nullptr;
+				return this->vtable_ != nullptr;
 			};
 
 			// deprecated in favor of good() to unify semantics
@@ -281,46 +510,27 @@ namespace jc
 			};
 
 			/**
-			 * @brief Releases ownership of the underlying function pointer and sets it to nullptr
-			*/
-			JCLIB_CONSTEXPR void release() noexcept
-			{
-				pointer& _ptr = this->get();
-				_ptr = nullptr;
-			};
-
-			/**
-			 * @brief Frees the owned function pointer memory and resets it to nullptr,
+			 * @brief Destroys the held function object, good() will return false afterwards
 			*/
-			JCLIB_CONSTEXPR void reset() noexcept
+			void reset() noexcept
 			{
-				pointer& _ptr = this->get();
-				delete _ptr;
-				this->release();
-				JCLIB_ASSERT(_ptr == nullptr);
-			};
-
-			/**
-			 * @brief Releases ownership of the owned function pointer and returns it
-			 * @return The owned function pointer as a pointer to the base (impl::function_pointer_base)
-			*/
-			JCLIB_NODISCARD("owning pointer") JCLIB_CONSTEXPR pointer extract() noexcept
-			{
-				const pointer _out = this->get();
-				this->release();
-				return _out;
+				if (this->good())
+				{
+					this->vtable_->destroy(this->storage_);
+					this->invoke_ = nullptr;
+					this->vtable_ = nullptr;
+				};
 			};
 
 			/**
-			 * @brief Invokes the owned function pointer, undefined if good() would return false
-			 * @param _args Arguements to invoke the owned function pointer with
-			 * @return Value returned by invoking the owned function pointer, or nothing if void
+			 * @brief Invokes the held function object, undefined if good() would return false
+			 * @param _args Arguements to invoke the held function object with
+			 * @return Value returned by invoking the held function object, or nothing if void
 			*/
 			return_type invoke(ArgTs... _args) const noexcept(functor_impl::is_noexcept())
 			{
 				JCLIB_ASSERT(this->good());
-				const pointer& _function = this->get();
-				return _function->invoke(_args...);
+				return this->invoke_(this->storage_, std::forward<ArgTs>(_args)...);
 			};
 
 			/**
@@ -328,19 +538,20 @@ namespace jc
 			*/
 			return_type operator()(ArgTs... _args) const noexcept(functor_impl::is_noexcept())
 			{
-				return this->invoke(std::forward<ArgTs>(_args)...);
+				JCLIB_ASSERT(this->good());
+				return this->invoke_(this->storage_, std::forward<ArgTs>(_args)...);
 			};
 
 			/**
-			 * @brief Defaults to own nothing, good() will return false.
+			 * @brief Defaults to hold nothing, good() will return false.
 			*/
-			JCLIB_CONSTEXPR functor_impl() noexcept = default;
+			functor_impl() noexcept = default;
 
 			/**
 			 * @brief Calls the default constructor
 			*/
-			JCLIB_CONSTEXPR functor_impl(std::nullptr_t) noexcept :
-				ptr_{ nullptr }
+			functor_impl(std::nullptr_t) noexcept :
+				functor_impl{}
 			{};
 
 			/**
@@ -349,85 +560,118 @@ namespace jc
 			functor_impl& operator=(std::nullptr_t) noexcept
 			{
 				this->reset();
-				JCLIB_ASSERT(this->ptr_ == nullptr);
 				return *this;
 			};
 
 			/**
-			 * @param _function Must be an owning pointer to a function object; set to nullptr by the constructor
+			 * @param _function Free function to hold, holds nothing if nullptr
 			*/
-			JCLIB_CONSTEXPR explicit functor_impl(pointer _function) noexcept :
-				ptr_{ _function }
-			{};
+			functor_impl(free_function_type _function) noexcept
+			{
+				if (_function)
+				{
+					this->emplace<free_function_type>(_function);
+				};
+			};
 
-			JCLIB_CONSTEXPR functor_impl(free_function_type _function) :
-				functor_impl{ new free_function_object_type{_function} }
-			{};
+			// calls reset()
+			functor_impl& operator=(free_function_type _function) noexcept
+			{
+				this->reset();
+				if (_function)
+				{
+					this->emplace<free_function_type>(_function);
+				};
+				return *this;
+			};
+
+			/**
+			 * @brief Holds an arbitrary function object (ie. a lambda or jc::callwrap)
+			 * @param _op Function object to copy or move from
+			*/
+			template <typename OpT, typename = jc::enable_if_t<is_acceptable_function_object<std::decay_t<OpT>>::value>>
+			functor_impl(OpT&& _op)
+			{
+				this->emplace<std::decay_t<OpT>>(std::forward<OpT>(_op));
+			};
 
 			// calls reset()
-			functor_impl& operator=(free_function_type _function)
+			template <typename OpT, typename = jc::enable_if_t<is_acceptable_function_object<std::decay_t<OpT>>::value>>
+			functor_impl& operator=(OpT&& _op)
 			{
 				this->reset();
-				this->ptr_ = new free_function_object_type{ _function };
+				this->emplace<std::decay_t<OpT>>(std::forward<OpT>(_op));
 				return *this;
 			};
 
 
 			template <typename ScopeT, typename = jc::enable_if_t<std::is_const<ScopeT>::value == false>>
-			JCLIB_CONSTEXPR functor_impl(member_function_type<ScopeT> _function, ScopeT* _class) :
-				functor_impl{ new member_function_object_type<ScopeT>{ _function, _class } }
-			{};
+			functor_impl(member_function_type<ScopeT> _function, ScopeT* _class)
+			{
+				this->emplace<member_function_object_type<ScopeT>>(_function, _class);
+			};
 
 			// calls reset()
 			template <typename ScopeT, typename = jc::enable_if_t<std::is_const<ScopeT>::value == false>>
 			functor_impl& operator=(std::pair<member_function_type<ScopeT>, ScopeT*> _memberFunction)
 			{
 				this->reset();
-				this->ptr_ = new member_function_object_type<ScopeT>
-				{
-					_memberFunction.first, _memberFunction.second
-				};
+				this->emplace<member_function_object_type<ScopeT>>(_memberFunction.first, _memberFunction.second);
 				return *this;
 			};
 
 
 			template <typename ScopeT>
-			JCLIB_CONSTEXPR functor_impl(const_member_function_type<ScopeT> _function, const ScopeT* _class) :
-				functor_impl{ new const_member_function_object_type<ScopeT>{ _function, _class } }
-			{};
+			functor_impl(const_member_function_type<ScopeT> _function, const ScopeT* _class)
+			{
+				this->emplace<const_member_function_object_type<ScopeT>>(_function, _class);
+			};
 
 			// calls reset()
 			template <typename ScopeT>
 			functor_impl& operator=(std::pair<const_member_function_type<ScopeT>, const ScopeT*> _memberFunction)
 			{
 				this->reset();
-				this->ptr_ = new const_member_function_object_type<ScopeT>
-				{
-					_memberFunction.first, _memberFunction.second
-				};
+				this->emplace<const_member_function_object_type<ScopeT>>(_memberFunction.first, _memberFunction.second);
 				return *this;
 			};
 
 
-			JCLIB_CONSTEXPR explicit functor_impl(const functor_impl& _other) :
-				ptr_{ (_other.good())? _other.get()->clone() : nullptr }
-			{};
-			functor_impl& operator=(const functor_impl& _other)
+			// Copying is provided by the copyable functor types
+			functor_impl(const functor_impl& _other) = delete;
+			functor_impl& operator=(const functor_impl& _other) = delete;
+
+			explicit functor_impl(functor_impl&& _other) noexcept
 			{
-				this->reset();
-				this->ptr_ = (_other.good())? _other.get()->clone() : nullptr ;
+				this->assign_move(_other);
+			};
+			functor_impl& operator=(functor_impl&& _other) noexcept
+			{
+				if (this != &_other)
+				{
+					this->reset();
+					this->assign_move(_other);
+				};
 				return *this;
 			};
 
-			JCLIB_CONSTEXPR explicit functor_impl(functor_impl&& _other) noexcept :
-				ptr_{ _other.extract() }
-			{};
-			functor_impl& operator=(functor_impl&& _other) noexcept
+			/**
+			 * @brief Takes the function object held by a copyable functor, only available if move-only
+			*/
+			template <bool _isCopyable = isCopyable, typename = jc::enable_if_t<!_isCopyable>>
+			functor_impl(functor_impl<true, isNoexcept, ReturnT, ArgTs...>&& _other) noexcept
+			{
+				this->assign_move(_other);
+			};
+
+			/**
+			 * @brief Takes the function object held by a copyable functor, only available if move-only
+			*/
+			template <bool _isCopyable = isCopyable, typename = jc::enable_if_t<!_isCopyable>>
+			functor_impl& operator=(functor_impl<true, isNoexcept, ReturnT, ArgTs...>&& _other) noexcept
 			{
-				// Check that these are not owning the same function object (this should never happen, ever)
-				JCLIB_ASSERT(this->get() != _other.get());
 				this->reset();
-				this->ptr_ = _other.extract();
+				this->assign_move(_other);
 				return *this;
 			};
 
@@ -438,57 +682,93 @@ namespace jc
 			};
 
 		private:
-			pointer ptr_ = nullptr;
+			mutable functor_storage storage_;
+			invoke_function_type invoke_ = nullptr;
+			const functor_vtable* vtable_ = nullptr;
 		};
 
 #ifdef __cpp_deduction_guides
 		template <typename ReturnT, typename... Args>
-		functor_impl(ReturnT(*)(Args...))->functor_impl<false, ReturnT, Args...>;
+		functor_impl(ReturnT(*)(Args...))->functor_impl<true, false, ReturnT, Args...>;
 
 		template <typename ReturnT, typename ScopeT, typename... Args>
-		functor_impl(ReturnT(ScopeT::*)(Args...), ScopeT*)->functor_impl<false, ReturnT, Args...>;
+		functor_impl(ReturnT(ScopeT::*)(Args...), ScopeT*)->functor_impl<true, false, ReturnT, Args...>;
 
 		template <typename ReturnT, typename ScopeT, typename... Args>
-		functor_impl(ReturnT(ScopeT::*)(Args...) const, ScopeT*)->functor_impl<false, ReturnT, Args...>;
+		functor_impl(ReturnT(ScopeT::*)(Args...) const, ScopeT*)->functor_impl<true, false, ReturnT, Args...>;
 
 #ifdef __cpp_noexcept_function_type
 		template <typename ReturnT, typename... Args>
-		functor_impl(ReturnT(*)(Args...) noexcept)->functor_impl<true, ReturnT, Args...>;
+		functor_impl(ReturnT(*)(Args...) noexcept)->functor_impl<true, true, ReturnT, Args...>;
 
 		template <typename ReturnT, typename ScopeT, typename... Args>
-		functor_impl(ReturnT(ScopeT::*)(Args...) noexcept, ScopeT*)->functor_impl<true, ReturnT, Args...>;
+		functor_impl(ReturnT(ScopeT::*)(Args...) noexcept, ScopeT*)->functor_impl<true, true, ReturnT, Args...>;
 
 		template <typename ReturnT, typename ScopeT, typename... Args>
-		functor_impl(ReturnT(ScopeT::*)(Args...) const noexcept, ScopeT*)->functor_impl<true, ReturnT, Args...>;
+		functor_impl(ReturnT(ScopeT::*)(Args...) const noexcept, ScopeT*)->functor_impl<true, true, ReturnT, Args...>;
 #endif
 #endif
+
+		/**
+		 * @brief Copyable functor implementation, copies clone the held function object
+		*/
+		template <bool isNoexcept, typename ReturnT, typename... ArgTs>
+		struct copyable_functor_impl : public functor_impl<true, isNoexcept, ReturnT, ArgTs...>
+		{
+		private:
+			using parent_type = functor_impl<true, isNoexcept, ReturnT, ArgTs...>;
+
+		public:
+			using parent_type::parent_type;
+			using parent_type::operator=;
+
+			copyable_functor_impl() noexcept = default;
+
+			copyable_functor_impl(const copyable_functor_impl& _other) :
+				parent_type{}
+			{
+				this->assign_copy(_other);
+			};
+			copyable_functor_impl& operator=(const copyable_functor_impl& _other)
+			{
+				if (this != &_other)
+				{
+					this->reset();
+					this->assign_copy(_other);
+				};
+				return *this;
+			};
+
+			copyable_functor_impl(copyable_functor_impl&& _other) noexcept = default;
+			copyable_functor_impl& operator=(copyable_functor_impl&& _other) noexcept = default;
+		};
 	};
 
 	/**
-	 * @brief Function object that can point to free functions or member functions that match its signature
+	 * @brief Copyable function object that can hold free functions, member functions or function objects that match its signature
 	*/
 	template <typename T>
 	struct functor;
 
 	/**
-	 * @brief Function object that can point to free functions or member functions that match its signature
+	 * @brief Copyable function object that can hold free functions, member functions or function objects that match its signature
 	*/
 	template <typename ReturnT, typename... ArgTs>
-	struct functor<ReturnT(ArgTs...)> : public impl::functor_impl<false, ReturnT, ArgTs...>
+	struct functor<ReturnT(ArgTs...)> : public impl::copyable_functor_impl<false, ReturnT, ArgTs...>
 	{
-		using impl::functor_impl<false, ReturnT, ArgTs...>::functor_impl;
-		using impl::functor_impl<false, ReturnT, ArgTs...>::operator=;
+		using impl::copyable_functor_impl<false, ReturnT, ArgTs...>::copyable_functor_impl;
+		using impl::copyable_functor_impl<false, ReturnT, ArgTs...>::operator=;
 	};
 
 #ifdef __cpp_noexcept_function_type
 	/**
-	 * @brief Function object that can point to free functions or member functions that match its signature
+	 * @brief Copyable function object that can hold free functions, member functions or function objects that match its signature
 	*/
 	template <typename ReturnT, typename... ArgTs>
-	struct functor<ReturnT(ArgTs...) noexcept> : public impl::functor_impl<true, ReturnT, ArgTs...>
+	struct functor<ReturnT(ArgTs...) noexcept> : public impl::copyable_functor_impl<true, ReturnT, ArgTs...>
 	{
-		using impl::functor_impl<true, ReturnT, ArgTs...>::functor_impl;
-		using impl::functor_impl<true, ReturnT, ArgTs...>::operator=;
+		using impl::copyable_functor_impl<true, ReturnT, ArgTs...>::copyable_functor_impl;
+		using impl::copyable_functor_impl<true, ReturnT, ArgTs...>::operator=;
 	};
 #endif
 	
@@ -507,6 +787,316 @@ namespace jc
 	template <typename ReturnT, typename ScopeT, typename... Args>
 	functor(ReturnT(ScopeT::*)(Args...) noexcept, ScopeT*)->functor<ReturnT(Args...) noexcept>;
 #endif
+#endif
+
+	/**
+	 * @brief Move-only function object that can hold free functions, member functions or function objects that match its signature.
+	 * 
+	 * Move-only function objects (ie. lambdas capturing a jc::unique_value) can be held, and a functor can be moved into it.
+	*/
+	template <typename T>
+	struct unique_functor;
+
+	/**
+	 * @brief Move-only function object that can hold free functions, member functions or function objects that match its signature.
+	 * 
+	 * Move-only function objects (ie. lambdas capturing a jc::unique_value) can be held, and a functor can be moved into it.
+	*/
+	template <typename ReturnT, typename... ArgTs>
+	struct unique_functor<ReturnT(ArgTs...)> : public impl::functor_impl<false, false, ReturnT, ArgTs...>
+	{
+		using impl::functor_impl<false, false, ReturnT, ArgTs...>::functor_impl;
+		using impl::functor_impl<false, false, ReturnT, ArgTs...>::operator=;
+	};
+
+#ifdef __cpp_noexcept_function_type
+	/**
+	 * @brief Move-only function object that can hold free functions, member functions or function objects that match its signature.
+	 * 
+	 * Move-only function objects (ie. lambdas capturing a jc::unique_value) can be held, and a functor can be moved into it.
+	*/
+	template <typename ReturnT, typename... ArgTs>
+	struct unique_functor<ReturnT(ArgTs...) noexcept> : public impl::functor_impl<false, true, ReturnT, ArgTs...>
+	{
+		using impl::functor_impl<false, true, ReturnT, ArgTs...>::functor_impl;
+		using impl::functor_impl<false, true, ReturnT, ArgTs...>::operator=;
+	};
+#endif
+
+#ifdef __cpp_deduction_guides
+	template <typename ReturnT, typename... Args>
+	unique_functor(ReturnT(*)(Args...))->unique_functor<ReturnT(Args...)>;
+
+	template <typename ReturnT, typename ScopeT, typename... Args>
+	unique_functor(ReturnT(ScopeT::*)(Args...), ScopeT*)->unique_functor<ReturnT(Args...)>;
+
+#ifdef __cpp_noexcept_function_type
+	template <typename ReturnT, typename... Args>
+	unique_functor(ReturnT(*)(Args...) noexcept)->unique_functor<ReturnT(Args...) noexcept>;
+
+	template <typename ReturnT, typename ScopeT, typename... Args>
+	unique_functor(ReturnT(ScopeT::*)(Args...) noexcept, ScopeT*)->unique_functor<ReturnT(Args...) noexcept>;
+#endif
+#endif
+
+
+
+	/**
+	 * @brief Tag type holding a member function pointer as a compile time constant
+	 * @tparam T Member function pointer type
+	 * @tparam Function Member function pointer value
+	*/
+	template <typename T, T Function>
+	struct member_function_t
+	{
+		// Explicit to prevent accidental construction
+		constexpr explicit member_function_t() noexcept = default;
+	};
+
+#if defined(__cpp_nontype_template_parameter_auto) && JCLIB_FEATURE_INLINE_VARIABLES_V
+	/**
+	 * @brief Tag value holding a member function pointer as a compile time constant (ie. jc::member_function<&foo::bar>)
+	 * @tparam Function Member function pointer value
+	*/
+	template <auto Function>
+	constexpr inline member_function_t<decltype(Function), Function> member_function{};
+#endif
+
+	namespace impl
+	{
+		/**
+		 * @brief Non-owning reference to a function or function object, implementation of function_ref
+		 * 
+		 * Holds a pointer to the referenced object alongside a pointer to a function that invokes it, so
+		 * invoking never allocates or goes through a virtual function.
+		 * 
+		 * @tparam isNoexcept Specifies the function pointer is noexcept
+		 * @tparam ReturnT Function return type
+		 * @tparam ...ArgTs Function arguement types
+		*/
+		template <bool isNoexcept, typename ReturnT, typename... ArgTs>
+		struct function_ref_impl
+		{
+		private:
+			using free_function_type = typename free_function_pointer<isNoexcept, ReturnT, ArgTs...>::function_pointer_type;
+
+			template <typename ClassT>
+			using member_function_type = typename member_function_pointer<isNoexcept, false, ReturnT, ClassT, ArgTs...>::function_pointer_type;
+
+			template <typename ClassT>
+			using const_member_function_type = typename member_function_pointer<isNoexcept, true, ReturnT, ClassT, ArgTs...>::function_pointer_type;
+
+			/**
+			 * @brief The referenced function or object
+			*/
+			union bound_type
+			{
+				void* object;
+				void(*function)();
+			};
+
+			/**
+			 * @brief Function used to invoke the bound function or object
+			*/
+			using thunk_type = ReturnT(*)(bound_type, ArgTs&&...);
+
+			template <typename OpT>
+			static ReturnT invoke_object(bound_type _bound, ArgTs&&... _args)
+			{
+				return static_cast<ReturnT>((*static_cast<OpT*>(_bound.object))(std::forward<ArgTs>(_args)...));
+			};
+
+			static ReturnT invoke_function(bound_type _bound, ArgTs&&... _args)
+			{
+				return (*reinterpret_cast<free_function_type>(_bound.function))(std::forward<ArgTs>(_args)...);
+			};
+
+			template <typename ClassT, typename FunctionT, FunctionT Function>
+			static ReturnT invoke_member(bound_type _bound, ArgTs&&... _args)
+			{
+				return (static_cast<ClassT*>(_bound.object)->*Function)(std::forward<ArgTs>(_args)...);
+			};
+
+			template <typename PairT>
+			static ReturnT invoke_member_pair(bound_type _bound, ArgTs&&... _args)
+			{
+				const PairT& _pair = *static_cast<const PairT*>(_bound.object);
+				return ((*_pair.second).*_pair.first)(std::forward<ArgTs>(_args)...);
+			};
+
+			template <typename OpT>
+			void bind(jc::true_type, OpT&& _op) noexcept
+			{
+				const free_function_type _function = std::forward<OpT>(_op);
+				this->bound_.function = reinterpret_cast<void(*)()>(_function);
+				this->thunk_ = &function_ref_impl::invoke_function;
+			};
+			template <typename OpT>
+			void bind(jc::false_type, OpT&& _op) noexcept
+			{
+				this->bound_.object = function_ref_impl::to_object(std::addressof(_op));
+				this->thunk_ = &function_ref_impl::invoke_object<jc::remove_reference_t<OpT>>;
+			};
+
+			template <typename T>
+			static void* to_object(T* _object) noexcept
+			{
+				return const_cast<void*>(static_cast<const void*>(_object));
+			};
+
+		public:
+
+			using return_type = ReturnT;
+
+			/**
+			 * @brief Returns true if the function type is noexcept
+			*/
+			JCLIB_CONSTEXPR static bool is_noexcept() noexcept
+			{
+				return isNoexcept;
+			};
+
+			/**
+			 * @brief Invokes the referenced function or function object
+			 * @param _args Arguements to invoke with
+			 * @return Value returned by the referenced function, or nothing if void
+			*/
+			return_type invoke(ArgTs... _args) const noexcept(function_ref_impl::is_noexcept())
+			{
+				return this->thunk_(this->bound_, std::forward<ArgTs>(_args)...);
+			};
+
+			/**
+			 * @brief Same as invoke()
+			*/
+			return_type operator()(ArgTs... _args) const noexcept(function_ref_impl::is_noexcept())
+			{
+				return this->thunk_(this->bound_, std::forward<ArgTs>(_args)...);
+			};
+
+			/**
+			 * @brief References a free function
+			 * @param _function Function to reference, must not be null
+			*/
+			function_ref_impl(free_function_type _function) noexcept :
+				thunk_{ &function_ref_impl::invoke_function }
+			{
+				JCLIB_ASSERT(_function != nullptr);
+				this->bound_.function = reinterpret_cast<void(*)()>(_function);
+			};
+
+			/**
+			 * @brief References a function object (ie. a lambda), the object must outlive this function_ref
+			 * 
+			 * Function objects convertible to a function pointer (ie. captureless lambdas) are converted instead, so
+			 * passing a temporary of that kind will not dangle.
+			 * 
+			 * @param _op Function object to reference
+			*/
+			template <typename OpT, typename = jc::enable_if_t
+				<
+					!std::is_base_of<function_ref_impl, jc::remove_cvref_t<OpT>>::value &&
+					is_functor_invocable<isNoexcept, jc::remove_reference_t<OpT>, ReturnT, ArgTs...>::value
+				>>
+			function_ref_impl(OpT&& _op) noexcept
+			{
+				this->bind(jc::bool_constant<jc::is_convertible<OpT&&, free_function_type>::value>{}, std::forward<OpT>(_op));
+			};
+
+			/**
+			 * @brief References a member function bound to an object
+			 * 
+			 * The member function is given by tag (ie. jc::member_function<&foo::bar>).
+			 * 
+			 * @param _class Object to invoke the member function on, must outlive this function_ref
+			*/
+			template <typename ScopeT, typename FunctionT, FunctionT Function, typename = jc::enable_if_t
+				<
+					is_functor_invocable<isNoexcept, decltype(std::mem_fn(Function)), ReturnT, ScopeT*, ArgTs...>::value
+				>>
+			function_ref_impl(member_function_t<FunctionT, Function>, ScopeT* _class) noexcept :
+				thunk_{ &function_ref_impl::invoke_member<ScopeT, FunctionT, Function> }
+			{
+				JCLIB_ASSERT(_class != nullptr);
+				this->bound_.object = function_ref_impl::to_object(_class);
+			};
+
+			/**
+			 * @brief References a member function and object pair, the pair must outlive this function_ref
+			 * @param _memberFunction Member function and object pair
+			*/
+			template <typename ScopeT, typename = jc::enable_if_t<std::is_const<ScopeT>::value == false>>
+			function_ref_impl(const std::pair<member_function_type<ScopeT>, ScopeT*>& _memberFunction) noexcept :
+				thunk_{ &function_ref_impl::invoke_member_pair<std::pair<member_function_type<ScopeT>, ScopeT*>> }
+			{
+				this->bound_.object = function_ref_impl::to_object(&_memberFunction);
+			};
+
+			// Referencing a temporary pair would dangle
+			template <typename ScopeT, typename = jc::enable_if_t<std::is_const<ScopeT>::value == false>>
+			function_ref_impl(const std::pair<member_function_type<ScopeT>, ScopeT*>&& _memberFunction) = delete;
+
+			/**
+			 * @brief References a const member function and object pair, the pair must outlive this function_ref
+			 * @param _memberFunction Member function and object pair
+			*/
+			template <typename ScopeT>
+			function_ref_impl(const std::pair<const_member_function_type<ScopeT>, const ScopeT*>& _memberFunction) noexcept :
+				thunk_{ &function_ref_impl::invoke_member_pair<std::pair<const_member_function_type<ScopeT>, const ScopeT*>> }
+			{
+				this->bound_.object = function_ref_impl::to_object(&_memberFunction);
+			};
+
+			// Referencing a temporary pair would dangle
+			template <typename ScopeT>
+			function_ref_impl(const std::pair<const_member_function_type<ScopeT>, const ScopeT*>&& _memberFunction) = delete;
+
+		private:
+			bound_type bound_;
+			thunk_type thunk_;
+		};
+	};
+
+	/**
+	 * @brief Non-owning reference to a free function, member function or function object that matches its signature.
+	 * 
+	 * Referenced function objects must outlive the function_ref, making it best suited for use as a function parameter.
+	*/
+	template <typename T>
+	struct function_ref;
+
+	/**
+	 * @brief Non-owning reference to a free function, member function or function object that matches its signature.
+	 * 
+	 * Referenced function objects must outlive the function_ref, making it best suited for use as a function parameter.
+	*/
+	template <typename ReturnT, typename... ArgTs>
+	struct function_ref<ReturnT(ArgTs...)> : public impl::function_ref_impl<false, ReturnT, ArgTs...>
+	{
+		using impl::function_ref_impl<false, ReturnT, ArgTs...>::function_ref_impl;
+	};
+
+#ifdef __cpp_noexcept_function_type
+	/**
+	 * @brief Non-owning reference to a free function, member function or function object that matches its signature.
+	 * 
+	 * Referenced function objects must outlive the function_ref, making it best suited for use as a function parameter.
+	*/
+	template <typename ReturnT, typename... ArgTs>
+	struct function_ref<ReturnT(ArgTs...) noexcept> : public impl::function_ref_impl<true, ReturnT, ArgTs...>
+	{
+		using impl::function_ref_impl<true, ReturnT, ArgTs...>::function_ref_impl;
+	};
+#endif
+
+#ifdef __cpp_deduction_guides
+	template <typename ReturnT, typename... Args>
+	function_ref(ReturnT(*)(Args...))->function_ref<ReturnT(Args...)>;
+
+#ifdef __cpp_noexcept_function_type
+	template <typename ReturnT, typename... Args>
+	function_ref(ReturnT(*)(Args...) noexcept)->function_ref<ReturnT(Args...) noexcept>;
+#endif
 #endif
 };
 
@@ -0,0 +1,319 @@
+#pragma once
+#ifndef JCLIB_HASH_H
+#define JCLIB_HASH_H
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	Fast non-cryptographic hash functions used by jc::hash.
+
+	Byte strings are hashed using a wyhash (final version 4) style function, and integers are hashed by mixing them
+	through a full 64x64 -> 128 bit multiply. Both take a seed so that the hashed values can be made unpredictable.
+
+	Byte string hash values are the same on every platform, but may change between versions of jclib so they should not
+	be stored.
+
+	String literals can be hashed in constant expressions (ie. case labels), giving the same value as hashing the
+	same characters at runtime.
+*/
+
+#include "jclib/config.h"
+#include "jclib/type_traits.h"
+
+#define _JCLIB_HASH_
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#include <type_traits>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__SIZEOF_INT128__)
+	#include <intrin.h>
+#endif
+
+namespace jc
+{
+	namespace impl
+	{
+		/**
+		 * @brief Multiplies two 64 bit integers, returning the low half of the result in _lhs and the high half in _rhs.
+		 * Usable in constant expressions.
+		*/
+		JCLIB_CONSTEXPR inline void hash_multiply_constexpr(uint64_t& _lhs, uint64_t& _rhs) noexcept
+		{
+#if defined(__SIZEOF_INT128__)
+			const __uint128_t _result = static_cast<__uint128_t>(_lhs) * _rhs;
+			_lhs = static_cast<uint64_t>(_result);
+			_rhs = static_cast<uint64_t>(_result >> 64);
+#else
+			const uint64_t _lhsHigh = _lhs >> 32;
+			const uint64_t _lhsLow = _lhs & 0xFFFFFFFF;
+			const uint64_t _rhsHigh = _rhs >> 32;
+			const uint64_t _rhsLow = _rhs & 0xFFFFFFFF;
+
+			const uint64_t _hh = _lhsHigh * _rhsHigh;
+			const uint64_t _hl = _lhsHigh * _rhsLow;
+			const uint64_t _lh = _lhsLow * _rhsHigh;
+			const uint64_t _ll = _lhsLow * _rhsLow;
+
+			const uint64_t _middle = _hl + (_ll >> 32) + (_lh & 0xFFFFFFFF);
+			_lhs = (_middle << 32) | (_ll & 0xFFFFFFFF);
+			_rhs = _hh + (_middle >> 32) + (_lh >> 32);
+#endif
+		};
+
+		/**
+		 * @brief Multiplies two 64 bit integers, returning the low half of the result in _lhs and the high half in _rhs
+		*/
+		inline void hash_multiply(uint64_t& _lhs, uint64_t& _rhs) noexcept
+		{
+#if !defined(__SIZEOF_INT128__) && defined(_MSC_VER) && defined(_M_X64)
+			_lhs = _umul128(_lhs, _rhs, &_rhs);
+#else
+			hash_multiply_constexpr(_lhs, _rhs);
+#endif
+		};
+
+		/**
+		 * @brief Reads hashed bytes from memory, bytes are always combined in little endian order
+		*/
+		struct hash_memory_source
+		{
+			static void multiply(uint64_t& _lhs, uint64_t& _rhs) noexcept
+			{
+				hash_multiply(_lhs, _rhs);
+			};
+
+			uint64_t byte(size_t _offset) const noexcept
+			{
+				return this->data[_offset];
+			};
+			uint64_t read4(size_t _offset) const noexcept
+			{
+				uint32_t _out;
+				std::memcpy(&_out, this->data + _offset, sizeof(_out));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+				_out = __builtin_bswap32(_out);
+#endif
+				return _out;
+			};
+			uint64_t read8(size_t _offset) const noexcept
+			{
+				uint64_t _out;
+				std::memcpy(&_out, this->data + _offset, sizeof(_out));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+				_out = __builtin_bswap64(_out);
+#endif
+				return _out;
+			};
+
+			const unsigned char* data;
+		};
+
+		/**
+		 * @brief Reads hashed bytes from an array of characters, usable in constant expressions.
+		 * Characters wider than a byte are split into bytes in little endian order.
+		 * @tparam CharT Character type
+		*/
+		template <typename CharT>
+		struct hash_character_source
+		{
+			JCLIB_CONSTEXPR static void multiply(uint64_t& _lhs, uint64_t& _rhs) noexcept
+			{
+				hash_multiply_constexpr(_lhs, _rhs);
+			};
+
+			JCLIB_CONSTEXPR uint64_t byte(size_t _offset) const noexcept
+			{
+				using unsigned_type = std::make_unsigned_t<CharT>;
+				const auto _character = static_cast<uint64_t>(static_cast<unsigned_type>(this->data[_offset / sizeof(CharT)]));
+				return (_character >> ((_offset % sizeof(CharT)) * 8)) & 0xFF;
+			};
+			JCLIB_CONSTEXPR uint64_t read4(size_t _offset) const noexcept
+			{
+				return this->byte(_offset) | (this->byte(_offset + 1) << 8) |
+					(this->byte(_offset + 2) << 16) | (this->byte(_offset + 3) << 24);
+			};
+			JCLIB_CONSTEXPR uint64_t read8(size_t _offset) const noexcept
+			{
+				return this->read4(_offset) | (this->read4(_offset + 4) << 32);
+			};
+
+			const CharT* data;
+		};
+
+		/**
+		 * @brief Default secret values used by the hash functions
+		*/
+		constexpr static uint64_t hash_secret[4] =
+		{
+			0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull
+		};
+
+		/**
+		 * @brief Multiplies two 64 bit integers and folds the 128 bit result into 64 bits
+		*/
+		template <typename SourceT>
+		JCLIB_CONSTEXPR inline uint64_t hash_mix(uint64_t _lhs, uint64_t _rhs) noexcept
+		{
+			SourceT::multiply(_lhs, _rhs);
+			return _lhs ^ _rhs;
+		};
+
+		/**
+		 * @brief wyhash (final version 4) implementation shared by the runtime and constant expression hash functions
+		 * @param _source Source to read bytes from
+		 * @param _len Number of bytes to hash
+		 * @param _seed Seed value
+		 * @return Hash value
+		*/
+		template <typename SourceT>
+		JCLIB_CONSTEXPR inline uint64_t wyhash(const SourceT& _source, size_t _len, uint64_t _seed) noexcept
+		{
+			_seed ^= hash_mix<SourceT>(_seed ^ hash_secret[0], hash_secret[1]);
+			uint64_t _a = 0;
+			uint64_t _b = 0;
+
+			if (_len <= 16)
+			{
+				if (_len >= 4)
+				{
+					const size_t _offset = (_len >> 3) << 2;
+					_a = (_source.read4(0) << 32) | _source.read4(_offset);
+					_b = (_source.read4(_len - 4) << 32) | _source.read4(_len - 4 - _offset);
+				}
+				else if (_len > 0)
+				{
+					_a = (_source.byte(0) << 16) | (_source.byte(_len >> 1) << 8) | _source.byte(_len - 1);
+				};
+			}
+			else
+			{
+				size_t _pos = 0;
+				size_t _remaining = _len;
+				if (_remaining > 48)
+				{
+					uint64_t _seed1 = _seed;
+					uint64_t _seed2 = _seed;
+					do
+					{
+						_seed = hash_mix<SourceT>(_source.read8(_pos) ^ hash_secret[1], _source.read8(_pos + 8) ^ _seed);
+						_seed1 = hash_mix<SourceT>(_source.read8(_pos + 16) ^ hash_secret[2], _source.read8(_pos + 24) ^ _seed1);
+						_seed2 = hash_mix<SourceT>(_source.read8(_pos + 32) ^ hash_secret[3], _source.read8(_pos + 40) ^ _seed2);
+						_pos += 48;
+						_remaining -= 48;
+					}
+					while (_remaining > 48);
+					_seed ^= _seed1 ^ _seed2;
+				};
+
+				while (_remaining > 16)
+				{
+					_seed = hash_mix<SourceT>(_source.read8(_pos) ^ hash_secret[1], _source.read8(_pos + 8) ^ _seed);
+					_pos += 16;
+					_remaining -= 16;
+				};
+
+				_a = _source.read8(_pos + _remaining - 16);
+				_b = _source.read8(_pos + _remaining - 8);
+			};
+
+			_a ^= hash_secret[1];
+			_b ^= _seed;
+			SourceT::multiply(_a, _b);
+			return hash_mix<SourceT>(_a ^ hash_secret[0] ^ static_cast<uint64_t>(_len), _b ^ hash_secret[1]);
+		};
+	};
+
+	/**
+	 * @brief wyhash style hash engine, fast for both short and long keys
+	 * 
+	 * Hash engines provide the following static functions:
+	 * 
+	 *		hash_bytes(const void* data, size_t len, uint64_t seed) -> uint64_t
+	 *		hash_characters(const CharT* data, size_t count, uint64_t seed) -> uint64_t, constexpr, must match hash_bytes
+	 *			given the same characters
+	 *		hash_integer(uint64_t value, uint64_t seed) -> uint64_t
+	*/
+	struct wyhash_engine
+	{
+		/**
+		 * @brief Hashes a sequence of bytes
+		 * @param _data Bytes to hash, may be null if _len is 0
+		 * @param _len Number of bytes to hash
+		 * @param _seed Seed value
+		 * @return Hash value
+		*/
+		static uint64_t hash_bytes(const void* _data, size_t _len, uint64_t _seed) noexcept
+		{
+			return impl::wyhash(impl::hash_memory_source{ static_cast<const unsigned char*>(_data) }, _len, _seed);
+		};
+
+		/**
+		 * @brief Hashes a sequence of characters, usable in constant expressions.
+		 * Gives the same result as hash_bytes() on little endian platforms.
+		 * @param _data Characters to hash, may be null if _count is 0
+		 * @param _count Number of characters to hash
+		 * @param _seed Seed value
+		 * @return Hash value
+		*/
+		template <typename CharT>
+		JCLIB_CONSTEXPR static uint64_t hash_characters(const CharT* _data, size_t _count, uint64_t _seed) noexcept
+		{
+			return impl::wyhash(impl::hash_character_source<CharT>{ _data }, _count * sizeof(CharT), _seed);
+		};
+
+		/**
+		 * @brief Hashes an integer, every input bit affects every output bit
+		 * @param _value Integer to hash
+		 * @param _seed Seed value
+		 * @return Hash value
+		*/
+		static uint64_t hash_integer(uint64_t _value, uint64_t _seed) noexcept
+		{
+			return impl::hash_mix<impl::hash_memory_source>(_value ^ impl::hash_secret[0], _seed ^ impl::hash_secret[1]);
+		};
+	};
+
+	/**
+	 * @brief Hash engine used by jc::hash unless another is specified
+	*/
+	using default_hash_engine = wyhash_engine;
+
+	/**
+	 * @brief Hashes a sequence of bytes using the default hash engine
+	 * @param _data Bytes to hash, may be null if _len is 0
+	 * @param _len Number of bytes to hash
+	 * @param _seed Seed value, defaults to 0
+	 * @return Hash value
+	*/
+	inline uint64_t hash_bytes(const void* _data, size_t _len, uint64_t _seed = 0) noexcept
+	{
+		return default_hash_engine::hash_bytes(_data, _len, _seed);
+	};
+
+	/**
+	 * @brief Hashes an integer using the default hash engine
+	 * @param _value Integer to hash
+	 * @param _seed Seed value, defaults to 0
+	 * @return Hash value
+	*/
+	inline uint64_t hash_integer(uint64_t _value, uint64_t _seed = 0) noexcept
+	{
+		return default_hash_engine::hash_integer(_value, _seed);
+	};
+};
+
+#endif
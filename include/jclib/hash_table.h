@@ -0,0 +1,1216 @@
+#pragma once
+#ifndef JCLIB_HASH_TABLE_H
+#define JCLIB_HASH_TABLE_H
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	Implements the open addressing ("SwissTable" style) hash table shared by jc::flat_hash_map and jc::flat_hash_set.
+
+	Elements are stored inline in a single array of slots with a parallel array of one byte control values. A control
+	byte is either empty, deleted or holds the low 7 bits of the hash of the element in its slot. Lookups probe whole
+	groups of control bytes at once (16 with SSE2, otherwise 8 using 64 bit integer operations), only comparing the
+	elements whose control byte matches, so most failed comparisons never touch the slots at all.
+
+	The first group width - 1 control bytes are cloned after the end of the control array so groups can always be loaded
+	with a single unaligned read, and the table is kept at most 7/8 full so probing always terminates.
+*/
+
+#include "jclib/config.h"
+#include "jclib/type_traits.h"
+#include "jclib/hash.h"
+#include "jclib/functional.h"
+
+#define _JCLIB_HASH_TABLE_
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <limits>
+#include <initializer_list>
+
+#ifndef JCLIB_HASH_TABLE_SSE2_V
+	#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+		// True/False depending on if hash table control bytes are probed using SSE2, may be defined as false beforehand
+		// to force the portable implementation
+		#define JCLIB_HASH_TABLE_SSE2_V true
+	#else
+		// True/False depending on if hash table control bytes are probed using SSE2
+		#define JCLIB_HASH_TABLE_SSE2_V false
+	#endif
+#endif
+
+#if JCLIB_HASH_TABLE_SSE2_V
+	#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+	#include <intrin.h>
+#endif
+
+namespace jc
+{
+	namespace impl
+	{
+		/**
+		 * @brief Hash table control byte, either one of the special values below or the 7 bit H2 hash of a full slot
+		*/
+		using hash_ctrl_t = int8_t;
+
+		/**
+		 * @brief Special hash table control byte values, full slots are always positive
+		*/
+		enum hash_ctrl : hash_ctrl_t
+		{
+			hash_ctrl_empty = -128,
+			hash_ctrl_deleted = -2,
+			hash_ctrl_sentinel = -1,
+		};
+
+		inline bool hash_ctrl_is_empty(hash_ctrl_t _ctrl) noexcept { return _ctrl == hash_ctrl_empty; };
+		inline bool hash_ctrl_is_full(hash_ctrl_t _ctrl) noexcept { return _ctrl >= 0; };
+		inline bool hash_ctrl_is_deleted(hash_ctrl_t _ctrl) noexcept { return _ctrl == hash_ctrl_deleted; };
+		inline bool hash_ctrl_is_empty_or_deleted(hash_ctrl_t _ctrl) noexcept { return _ctrl < hash_ctrl_sentinel; };
+
+		/**
+		 * @brief Counts the trailing zero bits of a non-zero integer
+		*/
+		inline uint32_t hash_countr_zero(uint64_t _value) noexcept
+		{
+			JCLIB_ASSERT(_value != 0);
+#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<uint32_t>(__builtin_ctzll(_value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+			unsigned long _out;
+			_BitScanForward64(&_out, _value);
+			return static_cast<uint32_t>(_out);
+#else
+			uint32_t _out = 0;
+			while ((_value & 1) == 0)
+			{
+				_value >>= 1;
+				++_out;
+			};
+			return _out;
+#endif
+		};
+
+		/**
+		 * @brief Gets the index of the highest set bit of a non-zero integer
+		*/
+		inline uint32_t hash_bit_width_minus_one(uint64_t _value) noexcept
+		{
+			JCLIB_ASSERT(_value != 0);
+#if defined(__GNUC__) || defined(__clang__)
+			return static_cast<uint32_t>(63 - __builtin_clzll(_value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+			unsigned long _out;
+			_BitScanReverse64(&_out, _value);
+			return static_cast<uint32_t>(_out);
+#else
+			uint32_t _out = 0;
+			while (_value >>= 1)
+			{
+				++_out;
+			};
+			return _out;
+#endif
+		};
+
+		/**
+		 * @brief Set of positions within a group of control bytes, iterable with a range based for loop.
+		 * @tparam T Integer type holding the mask.
+		 * @tparam Width Number of positions in the mask.
+		 * @tparam Shift Log2 of the number of bits used for each position.
+		*/
+		template <typename T, uint32_t Width, uint32_t Shift>
+		struct hash_bitmask
+		{
+			/**
+			 * @brief Gets the lowest set position, the mask must not be empty
+			*/
+			uint32_t lowest() const noexcept
+			{
+				return impl::hash_countr_zero(this->mask) >> Shift;
+			};
+
+			/**
+			 * @brief Counts the unset positions before the lowest set position
+			*/
+			uint32_t trailing_zeros() const noexcept
+			{
+				return (this->mask == 0) ? Width : this->lowest();
+			};
+
+			/**
+			 * @brief Counts the unset positions after the highest set position
+			*/
+			uint32_t leading_zeros() const noexcept
+			{
+				constexpr uint32_t total_bits = Width << Shift;
+				return (this->mask == 0) ? Width : (total_bits - 1 - impl::hash_bit_width_minus_one(this->mask)) >> Shift;
+			};
+
+			explicit operator bool() const noexcept { return this->mask != 0; };
+
+			// Range for loop support, iterates the set positions from lowest to highest
+
+			hash_bitmask begin() const noexcept { return *this; };
+			hash_bitmask end() const noexcept { return hash_bitmask{ 0 }; };
+			uint32_t operator*() const noexcept { return this->lowest(); };
+			hash_bitmask& operator++() noexcept
+			{
+				this->mask &= (this->mask - 1);
+				return *this;
+			};
+			friend bool operator!=(const hash_bitmask& lhs, const hash_bitmask& rhs) noexcept
+			{
+				return lhs.mask != rhs.mask;
+			};
+
+			T mask;
+		};
+
+#if JCLIB_HASH_TABLE_SSE2_V
+		/**
+		 * @brief Group of 16 control bytes probed using SSE2
+		*/
+		struct hash_group
+		{
+			constexpr static size_t width = 16;
+			using bitmask = hash_bitmask<uint32_t, 16, 0>;
+
+			/**
+			 * @brief Positions holding the given H2 hash
+			*/
+			bitmask match(hash_ctrl_t _h2) const noexcept
+			{
+				const auto _match = _mm_set1_epi8(static_cast<char>(_h2));
+				return bitmask{ static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_match, this->ctrl))) };
+			};
+
+			/**
+			 * @brief Positions that are empty
+			*/
+			bitmask match_empty() const noexcept
+			{
+				return this->match(hash_ctrl_empty);
+			};
+
+			/**
+			 * @brief Positions that are empty or deleted
+			*/
+			bitmask match_empty_or_deleted() const noexcept
+			{
+				const auto _special = _mm_set1_epi8(static_cast<char>(hash_ctrl_sentinel));
+				return bitmask{ static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_special, this->ctrl))) };
+			};
+
+			/**
+			 * @brief Counts the empty or deleted positions at the start of the group
+			*/
+			uint32_t count_leading_empty_or_deleted() const noexcept
+			{
+				const auto _special = _mm_set1_epi8(static_cast<char>(hash_ctrl_sentinel));
+				const auto _mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_special, this->ctrl)));
+				return impl::hash_countr_zero(_mask + 1);
+			};
+
+			explicit hash_group(const hash_ctrl_t* _ctrl) noexcept :
+				ctrl{ _mm_loadu_si128(reinterpret_cast<const __m128i*>(_ctrl)) }
+			{};
+
+			__m128i ctrl;
+		};
+#else
+		/**
+		 * @brief Group of 8 control bytes probed using 64 bit integer operations
+		*/
+		struct hash_group
+		{
+			constexpr static size_t width = 8;
+			using bitmask = hash_bitmask<uint64_t, 8, 3>;
+
+			constexpr static uint64_t lsbs = 0x0101010101010101;
+			constexpr static uint64_t msbs = 0x8080808080808080;
+
+			/**
+			 * @brief Positions holding the given H2 hash.
+			 *
+			 * May give false positives, but only for full positions next to a true match, which are then
+			 * rejected by comparing the keys.
+			*/
+			bitmask match(hash_ctrl_t _h2) const noexcept
+			{
+				const uint64_t _x = this->ctrl ^ (lsbs * static_cast<uint8_t>(_h2));
+				return bitmask{ (_x - lsbs) & ~_x & msbs };
+			};
+
+			/**
+			 * @brief Positions that are empty
+			*/
+			bitmask match_empty() const noexcept
+			{
+				return bitmask{ (this->ctrl & ~(this->ctrl << 6)) & msbs };
+			};
+
+			/**
+			 * @brief Positions that are empty or deleted
+			*/
+			bitmask match_empty_or_deleted() const noexcept
+			{
+				return bitmask{ (this->ctrl & ~(this->ctrl << 7)) & msbs };
+			};
+
+			/**
+			 * @brief Counts the empty or deleted positions at the start of the group
+			*/
+			uint32_t count_leading_empty_or_deleted() const noexcept
+			{
+				constexpr uint64_t _gaps = 0x00FEFEFEFEFEFEFE;
+				return (impl::hash_countr_zero(((~this->ctrl & (this->ctrl >> 7)) | _gaps) + 1) + 7) >> 3;
+			};
+
+			explicit hash_group(const hash_ctrl_t* _ctrl) noexcept :
+				ctrl{ hash_memory_source{ reinterpret_cast<const unsigned char*>(_ctrl) }.read8(0) }
+			{};
+
+			uint64_t ctrl;
+		};
+#endif
+
+		/**
+		 * @brief Gets the control bytes used by tables without any slots allocated, a single group starting
+		 * with the sentinel followed by empty bytes.
+		*/
+		inline hash_ctrl_t* hash_empty_group() noexcept
+		{
+			alignas(16) static const hash_ctrl_t _group[16] =
+			{
+				hash_ctrl_sentinel, hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty,
+				hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty,
+				hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty,
+				hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty, hash_ctrl_empty
+			};
+
+			// Never written to, tables without slots do not modify their control bytes
+			return const_cast<hash_ctrl_t*>(_group);
+		};
+
+		/**
+		 * @brief Gets the starting position of the probe sequence for a hash
+		*/
+		inline size_t hash_h1(size_t _hash) noexcept
+		{
+			return _hash >> 7;
+		};
+
+		/**
+		 * @brief Gets the control byte value for a hash
+		*/
+		inline hash_ctrl_t hash_h2(size_t _hash) noexcept
+		{
+			return static_cast<hash_ctrl_t>(_hash & 0x7F);
+		};
+
+		/**
+		 * @brief Triangular probe sequence over groups, visits every group exactly once when the capacity
+		 * is one less than a power of two.
+		*/
+		struct hash_probe_sequence
+		{
+			size_t offset() const noexcept { return this->offset_; };
+			size_t offset(size_t _i) const noexcept { return (this->offset_ + _i) & this->mask_; };
+
+			void next() noexcept
+			{
+				this->index_ += hash_group::width;
+				this->offset_ += this->index_;
+				this->offset_ &= this->mask_;
+			};
+
+			hash_probe_sequence(size_t _hash, size_t _mask) noexcept :
+				mask_{ _mask }, offset_{ _hash & _mask }, index_{ 0 }
+			{};
+
+		private:
+			size_t mask_;
+			size_t offset_;
+			size_t index_;
+		};
+
+		/**
+		 * @brief Rounds a capacity up to one less than a power of two
+		*/
+		inline size_t hash_normalize_capacity(size_t _n) noexcept
+		{
+			return (_n == 0) ? 1 : (~size_t(0) >> (sizeof(size_t) * 8 - 1 - impl::hash_bit_width_minus_one(_n)));
+		};
+
+		/**
+		 * @brief Gets the number of elements that may be held with the given capacity, keeps 1/8th of the slots empty
+		*/
+		inline size_t hash_capacity_to_growth(size_t _capacity) noexcept
+		{
+			if (hash_group::width == 8 && _capacity == 7)
+			{
+				return 6;
+			};
+			return _capacity - _capacity / 8;
+		};
+
+		/**
+		 * @brief Gets the smallest capacity (before normalizing) able to hold the given number of elements
+		*/
+		inline size_t hash_growth_to_capacity(size_t _growth) noexcept
+		{
+			if (hash_group::width == 8 && _growth == 7)
+			{
+				return 8;
+			};
+			return _growth + static_cast<size_t>((static_cast<int64_t>(_growth) - 1) / 7);
+		};
+
+		/**
+		 * @brief Open addressing hash table implementing the shared parts of jc::flat_hash_map and jc::flat_hash_set.
+		 *
+		 * The policy type describes how elements are stored:
+		 *
+		 *		using key_type, value_type, slot_type, reference, const_reference
+		 *		static const key_type& key(const slot_type&)
+		 *		static const key_type& key_of(const value_type&)
+		 *		static reference element(slot_type&)
+		 *		static void construct(AllocT&, slot_type*, Args&&...)
+		 *		static void destroy(AllocT&, slot_type*)
+		 *		static void transfer(AllocT&, slot_type* to, slot_type* from)
+		 *
+		 * @tparam PolicyT Slot policy type.
+		 * @tparam HashT Hash function object type.
+		 * @tparam EqualT Key equality function object type.
+		 * @tparam AllocT Allocator type for the value type.
+		*/
+		template <typename PolicyT, typename HashT, typename EqualT, typename AllocT>
+		struct raw_hash_table
+		{
+		private:
+			using policy_type = PolicyT;
+			using slot_type = typename PolicyT::slot_type;
+			using slot_allocator_type = typename std::allocator_traits<AllocT>::template rebind_alloc<slot_type>;
+			using slot_allocator_traits = std::allocator_traits<slot_allocator_type>;
+			using ctrl_allocator_type = typename std::allocator_traits<AllocT>::template rebind_alloc<hash_ctrl_t>;
+			using ctrl_allocator_traits = std::allocator_traits<ctrl_allocator_type>;
+
+			constexpr static bool is_transparent_v =
+				jc::is_transparent<HashT>::value && jc::is_transparent<EqualT>::value;
+
+		public:
+			using key_type = typename PolicyT::key_type;
+			using value_type = typename PolicyT::value_type;
+			using size_type = size_t;
+			using difference_type = ptrdiff_t;
+			using hasher = HashT;
+			using key_equal = EqualT;
+			using allocator_type = AllocT;
+			using reference = typename PolicyT::reference;
+			using const_reference = typename PolicyT::const_reference;
+			using pointer = jc::remove_reference_t<reference>*;
+			using const_pointer = jc::remove_reference_t<const_reference>*;
+
+		protected:
+
+			/**
+			 * @brief Lookup argument type, allows heterogeneous lookup with transparent hash and equality types
+			*/
+			template <typename K>
+			using key_arg = typename transparent_key_arg<is_transparent_v>::template type<K, key_type>;
+
+		private:
+
+			template <bool IsConst>
+			struct iterator_impl
+			{
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using value_type = typename PolicyT::value_type;
+				using reference = std::conditional_t<IsConst, typename PolicyT::const_reference, typename PolicyT::reference>;
+				using pointer = jc::remove_reference_t<reference>*;
+				using difference_type = ptrdiff_t;
+
+				reference operator*() const noexcept
+				{
+					JCLIB_ASSERT(this->ctrl_ && hash_ctrl_is_full(*this->ctrl_));
+					return PolicyT::element(*this->slot_);
+				};
+				pointer operator->() const noexcept
+				{
+					return std::addressof(**this);
+				};
+
+				iterator_impl& operator++() noexcept
+				{
+					JCLIB_ASSERT(this->ctrl_);
+					++this->ctrl_;
+					++this->slot_;
+					this->skip_empty_or_deleted();
+					return *this;
+				};
+				iterator_impl operator++(int) noexcept
+				{
+					auto _out = *this;
+					++(*this);
+					return _out;
+				};
+
+				friend bool operator==(const iterator_impl& lhs, const iterator_impl& rhs) noexcept
+				{
+					return lhs.ctrl_ == rhs.ctrl_;
+				};
+				friend bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs) noexcept
+				{
+					return !(lhs == rhs);
+				};
+
+				// Allow iterator -> const_iterator conversion
+				template <bool OtherConst, typename = jc::enable_if_t<IsConst && !OtherConst>>
+				iterator_impl(const iterator_impl<OtherConst>& _other) noexcept :
+					ctrl_{ _other.ctrl_ }, slot_{ _other.slot_ }
+				{};
+
+				iterator_impl() noexcept = default;
+
+			private:
+				friend raw_hash_table;
+				template <bool>
+				friend struct iterator_impl;
+
+				/**
+				 * @brief Advances to the next full slot, becoming the end iterator when the sentinel is reached
+				*/
+				void skip_empty_or_deleted() noexcept
+				{
+					while (hash_ctrl_is_empty_or_deleted(*this->ctrl_))
+					{
+						const auto _shift = hash_group{ this->ctrl_ }.count_leading_empty_or_deleted();
+						this->ctrl_ += _shift;
+						this->slot_ += _shift;
+					};
+					if (*this->ctrl_ == hash_ctrl_sentinel)
+					{
+						this->ctrl_ = nullptr;
+						this->slot_ = nullptr;
+					};
+				};
+
+				iterator_impl(hash_ctrl_t* _ctrl, slot_type* _slot) noexcept :
+					ctrl_{ _ctrl }, slot_{ _slot }
+				{};
+
+				hash_ctrl_t* ctrl_ = nullptr;
+				slot_type* slot_ = nullptr;
+			};
+
+		public:
+			using iterator = iterator_impl<false>;
+			using const_iterator = iterator_impl<true>;
+
+			iterator begin() noexcept
+			{
+				iterator _it{ this->ctrl_, this->slots_ };
+				_it.skip_empty_or_deleted();
+				return _it;
+			};
+			const_iterator begin() const noexcept
+			{
+				return const_cast<raw_hash_table*>(this)->begin();
+			};
+			const_iterator cbegin() const noexcept
+			{
+				return this->begin();
+			};
+
+			iterator end() noexcept { return iterator{}; };
+			const_iterator end() const noexcept { return const_iterator{}; };
+			const_iterator cend() const noexcept { return this->end(); };
+
+			/**
+			 * @brief Gets the number of elements held
+			*/
+			size_type size() const noexcept { return this->size_; };
+
+			/**
+			 * @brief Checks if the table holds no elements
+			*/
+			bool empty() const noexcept { return this->size_ == 0; };
+
+			/**
+			 * @brief Gets the number of slots allocated
+			*/
+			size_type capacity() const noexcept { return this->capacity_; };
+			size_type bucket_count() const noexcept { return this->capacity_; };
+
+			size_type max_size() const noexcept
+			{
+				return (std::numeric_limits<size_type>::max)() / sizeof(slot_type);
+			};
+
+			float load_factor() const noexcept
+			{
+				return (this->capacity_ == 0) ? 0.0f : static_cast<float>(this->size_) / static_cast<float>(this->capacity_);
+			};
+
+			/**
+			 * @brief Gets the maximum load factor, the table always grows before it is 7/8ths full
+			*/
+			float max_load_factor() const noexcept { return 0.875f; };
+
+			hasher hash_function() const { return this->hash_; };
+			key_equal key_eq() const { return this->equal_; };
+			allocator_type get_allocator() const { return allocator_type(this->alloc_); };
+
+			/**
+			 * @brief Finds the element with the given key
+			 * @param _key Key to find
+			 * @return Iterator to the element, or end() if not found
+			*/
+			template <typename K = key_type>
+			iterator find(const key_arg<K>& _key)
+			{
+				return this->find_impl(_key, this->hash_key(_key));
+			};
+			template <typename K = key_type>
+			const_iterator find(const key_arg<K>& _key) const
+			{
+				return const_cast<raw_hash_table*>(this)->find(_key);
+			};
+
+			/**
+			 * @brief Checks if the table contains an element with the given key
+			*/
+			template <typename K = key_type>
+			bool contains(const key_arg<K>& _key) const
+			{
+				return this->find(_key) != this->end();
+			};
+
+			/**
+			 * @brief Counts the elements with the given key, either 0 or 1
+			*/
+			template <typename K = key_type>
+			size_type count(const key_arg<K>& _key) const
+			{
+				return this->contains(_key) ? 1 : 0;
+			};
+
+			/**
+			 * @brief Inserts a value if there is no element with an equal key
+			 * @return Iterator to the element with the value's key, and true if the value was inserted
+			*/
+			std::pair<iterator, bool> insert(const value_type& _value)
+			{
+				return this->emplace_key(PolicyT::key_of(_value), _value);
+			};
+			std::pair<iterator, bool> insert(value_type&& _value)
+			{
+				return this->emplace_key(PolicyT::key_of(_value), std::move(_value));
+			};
+
+			/**
+			 * @brief Inserts a value, the hint is ignored
+			*/
+			iterator insert(const_iterator, const value_type& _value)
+			{
+				return this->insert(_value).first;
+			};
+			iterator insert(const_iterator, value_type&& _value)
+			{
+				return this->insert(std::move(_value)).first;
+			};
+
+			/**
+			 * @brief Inserts each value in a range if there is no element with an equal key
+			*/
+			template <typename IterT>
+			void insert(IterT _begin, IterT _end)
+			{
+				for (; _begin != _end; ++_begin)
+				{
+					this->emplace(*_begin);
+				};
+			};
+			void insert(std::initializer_list<value_type> _values)
+			{
+				this->insert(_values.begin(), _values.end());
+			};
+
+			/**
+			 * @brief Constructs a value and inserts it if there is no element with an equal key
+			 * @return Iterator to the element with the value's key, and true if the value was inserted
+			*/
+			template <typename... Ts>
+			std::pair<iterator, bool> emplace(Ts&&... _args)
+			{
+				value_type _value(std::forward<Ts>(_args)...);
+				return this->insert(std::move(_value));
+			};
+
+			/**
+			 * @brief Constructs a value and inserts it, the hint is ignored
+			*/
+			template <typename... Ts>
+			iterator emplace_hint(const_iterator, Ts&&... _args)
+			{
+				return this->emplace(std::forward<Ts>(_args)...).first;
+			};
+
+			/**
+			 * @brief Erases an element
+			 * @param _pos Iterator to the element to erase, must not be end()
+			 * @return Iterator to the element after the erased element
+			*/
+			iterator erase(const_iterator _pos)
+			{
+				iterator _it{ _pos.ctrl_, _pos.slot_ };
+				JCLIB_ASSERT(_it != this->end());
+				this->erase_at(_it);
+				++_it;
+				return _it;
+			};
+			iterator erase(iterator _pos)
+			{
+				return this->erase(const_iterator{ _pos });
+			};
+
+			/**
+			 * @brief Erases a range of elements
+			 * @return Iterator to the element after the erased elements
+			*/
+			iterator erase(const_iterator _begin, const_iterator _end)
+			{
+				iterator _it{ _begin.ctrl_, _begin.slot_ };
+				while (_it != _end)
+				{
+					_it = this->erase(_it);
+				};
+				return _it;
+			};
+
+			/**
+			 * @brief Erases the element with the given key
+			 * @return Number of elements erased, either 0 or 1
+			*/
+			template <typename K = key_type>
+			size_type erase(const key_arg<K>& _key)
+			{
+				const auto _it = this->find(_key);
+				if (_it == this->end())
+				{
+					return 0;
+				};
+				this->erase_at(_it);
+				return 1;
+			};
+
+			/**
+			 * @brief Destroys every element, keeping the allocated slots unless the table is large
+			*/
+			void clear() noexcept
+			{
+				if (this->capacity_ == 0)
+				{
+					return;
+				};
+
+				this->destroy_elements();
+				if (this->capacity_ > 127)
+				{
+					// Avoid iterating over a mostly empty table later
+					this->deallocate();
+				}
+				else
+				{
+					this->reset_ctrl();
+					this->size_ = 0;
+					this->reset_growth_left();
+				};
+			};
+
+			/**
+			 * @brief Allocates enough slots to hold at least the given number of elements without rehashing
+			*/
+			void reserve(size_type _count)
+			{
+				if (_count > this->size_ + this->growth_left_)
+				{
+					this->resize(hash_normalize_capacity(hash_growth_to_capacity(_count)));
+				};
+			};
+
+			/**
+			 * @brief Rehashes the table to have at least the given number of slots, passing 0 shrinks the table to
+			 * fit its elements.
+			*/
+			void rehash(size_type _count)
+			{
+				if (_count == 0 && this->capacity_ == 0)
+				{
+					return;
+				};
+				if (_count == 0 && this->size_ == 0)
+				{
+					this->deallocate();
+					return;
+				};
+
+				const auto _newCapacity = hash_normalize_capacity((std::max)(_count, hash_growth_to_capacity(this->size_)));
+				if (_count == 0 || _newCapacity > this->capacity_)
+				{
+					this->resize(_newCapacity);
+				};
+			};
+
+			void swap(raw_hash_table& _other) noexcept
+			{
+				using std::swap;
+				swap(this->ctrl_, _other.ctrl_);
+				swap(this->slots_, _other.slots_);
+				swap(this->size_, _other.size_);
+				swap(this->capacity_, _other.capacity_);
+				swap(this->growth_left_, _other.growth_left_);
+				swap(this->hash_, _other.hash_);
+				swap(this->equal_, _other.equal_);
+				swap(this->alloc_, _other.alloc_);
+			};
+			friend void swap(raw_hash_table& lhs, raw_hash_table& rhs) noexcept
+			{
+				lhs.swap(rhs);
+			};
+
+			/**
+			 * @brief Checks if two tables hold equal elements, ignoring the order they are held in
+			*/
+			friend bool operator==(const raw_hash_table& lhs, const raw_hash_table& rhs)
+			{
+				if (lhs.size() != rhs.size())
+				{
+					return false;
+				};
+				for (auto& v : lhs)
+				{
+					const auto _it = rhs.find_impl(PolicyT::key_of(v), rhs.hash_key(PolicyT::key_of(v)));
+					if (_it == rhs.end() || !(*_it == v))
+					{
+						return false;
+					};
+				};
+				return true;
+			};
+			friend bool operator!=(const raw_hash_table& lhs, const raw_hash_table& rhs)
+			{
+				return !(lhs == rhs);
+			};
+
+
+
+			raw_hash_table() noexcept(std::is_nothrow_default_constructible<HashT>::value &&
+				std::is_nothrow_default_constructible<EqualT>::value && std::is_nothrow_default_constructible<AllocT>::value) :
+				hash_{}, equal_{}, alloc_{}
+			{};
+
+			explicit raw_hash_table(size_type _bucketCount, const hasher& _hash = hasher{},
+				const key_equal& _equal = key_equal{}, const allocator_type& _alloc = allocator_type{}) :
+				hash_{ _hash }, equal_{ _equal }, alloc_{ _alloc }
+			{
+				if (_bucketCount != 0)
+				{
+					this->resize(hash_normalize_capacity(_bucketCount));
+				};
+			};
+
+			explicit raw_hash_table(const allocator_type& _alloc) :
+				raw_hash_table(0, hasher{}, key_equal{}, _alloc)
+			{};
+
+			template <typename IterT>
+			raw_hash_table(IterT _begin, IterT _end, size_type _bucketCount = 0, const hasher& _hash = hasher{},
+				const key_equal& _equal = key_equal{}, const allocator_type& _alloc = allocator_type{}) :
+				raw_hash_table(_bucketCount, _hash, _equal, _alloc)
+			{
+				this->insert(_begin, _end);
+			};
+
+			raw_hash_table(std::initializer_list<value_type> _values, size_type _bucketCount = 0, const hasher& _hash = hasher{},
+				const key_equal& _equal = key_equal{}, const allocator_type& _alloc = allocator_type{}) :
+				raw_hash_table(_values.begin(), _values.end(), _bucketCount, _hash, _equal, _alloc)
+			{};
+
+			raw_hash_table(const raw_hash_table& other) :
+				hash_{ other.hash_ }, equal_{ other.equal_ },
+				alloc_{ slot_allocator_traits::select_on_container_copy_construction(other.alloc_) }
+			{
+				this->reserve(other.size());
+
+				// Keys are already known to be unique so skip comparing them
+				for (auto& v : other)
+				{
+					const auto _hash = this->hash_key(PolicyT::key_of(v));
+					const auto _index = this->find_first_non_full(_hash);
+					PolicyT::construct(this->alloc_, this->slots_ + _index, v);
+					this->commit_insert(_index, _hash);
+				};
+			};
+			raw_hash_table& operator=(const raw_hash_table& other)
+			{
+				if (this != &other)
+				{
+					raw_hash_table _copy(other);
+					this->swap(_copy);
+				};
+				return *this;
+			};
+
+			raw_hash_table(raw_hash_table&& other) noexcept :
+				ctrl_{ std::exchange(other.ctrl_, hash_empty_group()) },
+				slots_{ std::exchange(other.slots_, nullptr) },
+				size_{ std::exchange(other.size_, 0) },
+				capacity_{ std::exchange(other.capacity_, 0) },
+				growth_left_{ std::exchange(other.growth_left_, 0) },
+				hash_{ other.hash_ }, equal_{ other.equal_ }, alloc_{ std::move(other.alloc_) }
+			{};
+			raw_hash_table& operator=(raw_hash_table&& other) noexcept
+			{
+				if (this != &other)
+				{
+					raw_hash_table _moved(std::move(other));
+					this->swap(_moved);
+				};
+				return *this;
+			};
+
+			~raw_hash_table()
+			{
+				this->destroy_elements();
+				this->deallocate();
+			};
+
+		protected:
+
+			/**
+			 * @brief Hashes a key, or a value comparable with a key
+			*/
+			template <typename K>
+			size_t hash_key(const K& _key) const
+			{
+				return static_cast<size_t>(this->hash_(_key));
+			};
+
+			/**
+			 * @brief Finds the element with the given key and its pre-computed hash
+			*/
+			template <typename K>
+			iterator find_impl(const K& _key, size_t _hash) const
+			{
+				const auto _h2 = hash_h2(_hash);
+				auto _seq = hash_probe_sequence{ hash_h1(_hash), this->capacity_ };
+				while (true)
+				{
+					const hash_group _group{ this->ctrl_ + _seq.offset() };
+					for (uint32_t i : _group.match(_h2))
+					{
+						const auto _index = _seq.offset(i);
+						if (this->equal_(PolicyT::key(this->slots_[_index]), _key))
+						{
+							return iterator{ this->ctrl_ + _index, this->slots_ + _index };
+						};
+					};
+					if (_group.match_empty())
+					{
+						return iterator{};
+					};
+					_seq.next();
+				};
+			};
+
+			/**
+			 * @brief Finds the element with the given key or prepares a slot to insert it into.
+			 *
+			 * A prepared slot must have an element constructed in it and then be passed to commit_insert().
+			 *
+			 * @return Index of the slot, and true if the element needs to be inserted
+			*/
+			template <typename K>
+			std::pair<size_t, bool> find_or_prepare_insert(const K& _key, size_t _hash)
+			{
+				const auto _h2 = hash_h2(_hash);
+				auto _seq = hash_probe_sequence{ hash_h1(_hash), this->capacity_ };
+				while (true)
+				{
+					const hash_group _group{ this->ctrl_ + _seq.offset() };
+					for (uint32_t i : _group.match(_h2))
+					{
+						const auto _index = _seq.offset(i);
+						if (this->equal_(PolicyT::key(this->slots_[_index]), _key))
+						{
+							return { _index, false };
+						};
+					};
+					if (_group.match_empty())
+					{
+						break;
+					};
+					_seq.next();
+				};
+				return { this->prepare_insert(_hash), true };
+			};
+
+			/**
+			 * @brief Marks a prepared slot as full once its element has been constructed
+			*/
+			void commit_insert(size_t _index, size_t _hash) noexcept
+			{
+				this->growth_left_ -= hash_ctrl_is_empty(this->ctrl_[_index]) ? 1 : 0;
+				this->set_ctrl(_index, hash_h2(_hash));
+				++this->size_;
+			};
+
+			/**
+			 * @brief Inserts an element constructed from the given arguments if the key is not already present
+			*/
+			template <typename K, typename... Ts>
+			std::pair<iterator, bool> emplace_key(const K& _key, Ts&&... _args)
+			{
+				const auto _hash = this->hash_key(_key);
+				const auto _found = this->find_or_prepare_insert(_key, _hash);
+				if (_found.second)
+				{
+					PolicyT::construct(this->alloc_, this->slots_ + _found.first, std::forward<Ts>(_args)...);
+					this->commit_insert(_found.first, _hash);
+				};
+				return { iterator{ this->ctrl_ + _found.first, this->slots_ + _found.first }, _found.second };
+			};
+
+		private:
+
+			/**
+			 * @brief Finds the first empty or deleted slot along the probe sequence for a hash
+			*/
+			size_t find_first_non_full(size_t _hash) const noexcept
+			{
+				auto _seq = hash_probe_sequence{ hash_h1(_hash), this->capacity_ };
+				while (true)
+				{
+					const auto _mask = hash_group{ this->ctrl_ + _seq.offset() }.match_empty_or_deleted();
+					if (_mask)
+					{
+						return _seq.offset(_mask.lowest());
+					};
+					_seq.next();
+				};
+			};
+
+			/**
+			 * @brief Gets a slot to insert an element with the given hash into, growing the table if needed
+			*/
+			size_t prepare_insert(size_t _hash)
+			{
+				auto _index = this->find_first_non_full(_hash);
+				if (this->growth_left_ == 0 && !hash_ctrl_is_deleted(this->ctrl_[_index]))
+				{
+					this->rehash_and_grow();
+					_index = this->find_first_non_full(_hash);
+				};
+				return _index;
+			};
+
+			/**
+			 * @brief Sets a control byte along with its clone at the end of the control bytes
+			*/
+			void set_ctrl(size_t _index, hash_ctrl_t _value) noexcept
+			{
+				constexpr size_t _cloned = hash_group::width - 1;
+				this->ctrl_[_index] = _value;
+				this->ctrl_[((_index - _cloned) & this->capacity_) + (_cloned & this->capacity_)] = _value;
+			};
+
+			void reset_ctrl() noexcept
+			{
+				std::memset(this->ctrl_, hash_ctrl_empty, this->capacity_ + hash_group::width);
+				this->ctrl_[this->capacity_] = hash_ctrl_sentinel;
+			};
+
+			void reset_growth_left() noexcept
+			{
+				this->growth_left_ = hash_capacity_to_growth(this->capacity_) - this->size_;
+			};
+
+			/**
+			 * @brief Destroys an element and marks its slot as empty or deleted.
+			 *
+			 * Slots can only be marked as empty if no probe sequence could have passed over them while full, which
+			 * is the case when there is an empty slot within a group width on both sides.
+			*/
+			void erase_at(iterator _it) noexcept
+			{
+				PolicyT::destroy(this->alloc_, _it.slot_);
+				--this->size_;
+
+				const size_t _index = static_cast<size_t>(_it.ctrl_ - this->ctrl_);
+				const size_t _indexBefore = (_index - hash_group::width) & this->capacity_;
+				const auto _emptyAfter = hash_group{ _it.ctrl_ }.match_empty();
+				const auto _emptyBefore = hash_group{ this->ctrl_ + _indexBefore }.match_empty();
+
+				const bool _wasNeverFull = _emptyBefore && _emptyAfter &&
+					(_emptyAfter.trailing_zeros() + _emptyBefore.leading_zeros()) < hash_group::width;
+
+				this->set_ctrl(_index, _wasNeverFull ? hash_ctrl_empty : hash_ctrl_deleted);
+				this->growth_left_ += _wasNeverFull ? 1 : 0;
+			};
+
+			/**
+			 * @brief Makes room for another element, rehashing in place if the table is mostly deleted slots
+			*/
+			void rehash_and_grow()
+			{
+				if (this->capacity_ == 0)
+				{
+					this->resize(1);
+				}
+				else if (this->size_ <= hash_capacity_to_growth(this->capacity_) / 2)
+				{
+					// Mostly deleted slots, reclaim them without growing
+					this->resize(this->capacity_);
+				}
+				else
+				{
+					this->resize(this->capacity_ * 2 + 1);
+				};
+			};
+
+			/**
+			 * @brief Moves every element into newly allocated slots
+			*/
+			void resize(size_t _newCapacity)
+			{
+				JCLIB_ASSERT(((_newCapacity + 1) & _newCapacity) == 0);
+
+				const auto _oldCtrl = this->ctrl_;
+				const auto _oldSlots = this->slots_;
+				const auto _oldCapacity = this->capacity_;
+
+				this->allocate(_newCapacity);
+				this->reset_growth_left();
+
+				for (size_t n = 0; n != _oldCapacity; ++n)
+				{
+					if (hash_ctrl_is_full(_oldCtrl[n]))
+					{
+						const auto _hash = this->hash_key(PolicyT::key(_oldSlots[n]));
+						const auto _index = this->find_first_non_full(_hash);
+						this->set_ctrl(_index, hash_h2(_hash));
+						PolicyT::transfer(this->alloc_, this->slots_ + _index, _oldSlots + n);
+					};
+				};
+
+				if (_oldCapacity != 0)
+				{
+					this->deallocate_storage(_oldCtrl, _oldSlots, _oldCapacity);
+				};
+			};
+
+			/**
+			 * @brief Allocates empty control bytes and slots, does not free the previous allocation
+			*/
+			void allocate(size_t _capacity)
+			{
+				const auto _slots = slot_allocator_traits::allocate(this->alloc_, _capacity);
+
+				// Frees the slots if allocating the control bytes throws
+				struct slot_guard
+				{
+					~slot_guard()
+					{
+						if (this->slots)
+						{
+							slot_allocator_traits::deallocate(this->alloc, this->slots, this->count);
+						};
+					};
+					slot_allocator_type& alloc;
+					slot_type* slots;
+					size_t count;
+				} _guard{ this->alloc_, _slots, _capacity };
+
+				auto _ctrlAlloc = ctrl_allocator_type(this->alloc_);
+				const auto _ctrl = ctrl_allocator_traits::allocate(_ctrlAlloc, _capacity + hash_group::width);
+				_guard.slots = nullptr;
+
+				this->ctrl_ = _ctrl;
+				this->slots_ = _slots;
+				this->capacity_ = _capacity;
+				this->reset_ctrl();
+			};
+
+			void deallocate_storage(hash_ctrl_t* _ctrl, slot_type* _slots, size_t _capacity) noexcept
+			{
+				auto _ctrlAlloc = ctrl_allocator_type(this->alloc_);
+				ctrl_allocator_traits::deallocate(_ctrlAlloc, _ctrl, _capacity + hash_group::width);
+				slot_allocator_traits::deallocate(this->alloc_, _slots, _capacity);
+			};
+
+			/**
+			 * @brief Frees the allocated slots, the table must not hold any elements
+			*/
+			void deallocate() noexcept
+			{
+				if (this->capacity_ != 0)
+				{
+					this->deallocate_storage(this->ctrl_, this->slots_, this->capacity_);
+				};
+				this->ctrl_ = hash_empty_group();
+				this->slots_ = nullptr;
+				this->size_ = 0;
+				this->capacity_ = 0;
+				this->growth_left_ = 0;
+			};
+
+			void destroy_elements() noexcept
+			{
+				if (!std::is_trivially_destructible<slot_type>::value)
+				{
+					for (size_t n = 0; n != this->capacity_; ++n)
+					{
+						if (hash_ctrl_is_full(this->ctrl_[n]))
+						{
+							PolicyT::destroy(this->alloc_, this->slots_ + n);
+						};
+					};
+				};
+			};
+
+			hash_ctrl_t* ctrl_ = hash_empty_group();
+			slot_type* slots_ = nullptr;
+			size_t size_ = 0;
+			size_t capacity_ = 0;
+			size_t growth_left_ = 0;
+
+			hasher hash_;
+			key_equal equal_;
+			mutable slot_allocator_type alloc_;
+		};
+	};
+};
+
+#endif
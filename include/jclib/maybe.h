@@ -20,6 +20,7 @@
 #include "jclib/type_traits.h"
 #include "jclib/memory.h"
 #include "jclib/exception.h"
+#include "jclib/functional.h"
 
 #define _JCLIB_MAYBE_
 
@@ -874,6 +875,27 @@ namespace jc
 		using impl::maybe_base<T, AltT>::operator=;
 	};
 
+	/**
+	 * @brief Hashes whichever of the value or alternate is held, along with which one is active.
+	*/
+	template <typename T, typename AltT, typename Enable>
+	struct hash_traits<maybe<T, AltT, Enable>>
+	{
+		template <typename EngineT>
+		static auto hash(const maybe<T, AltT, Enable>& _value, uint64_t _seed) ->
+			jc::enable_if_t<impl::is_hashable<EngineT, T>::value && impl::is_hashable<EngineT, AltT>::value, size_t>
+		{
+			if (_value.has_value())
+			{
+				return impl::hash_sequence<EngineT>(_seed, _seed, true, _value.value());
+			}
+			else
+			{
+				return impl::hash_sequence<EngineT>(_seed, _seed, false, _value.alternate());
+			};
+		};
+	};
+
 };
 
 #endif
\ No newline at end of file
@@ -233,6 +233,26 @@ namespace jc
 			return *this;
 		};
 
+		constexpr borrow_ptr& operator++() noexcept
+		{
+			++this->raw_get();
+			return *this;
+		};
+		constexpr borrow_ptr operator++(int) noexcept
+		{
+			return borrow_ptr{ this->raw_get()++ };
+		};
+
+		constexpr borrow_ptr& operator--() noexcept
+		{
+			--this->raw_get();
+			return *this;
+		};
+		constexpr borrow_ptr operator--(int) noexcept
+		{
+			return borrow_ptr{ this->raw_get()-- };
+		};
+
 
 		// Pointer comparisons
 
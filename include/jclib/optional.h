@@ -18,6 +18,7 @@
 #include "jclib/type.h"
 #include "jclib/config.h"
 #include "jclib/type_traits.h"
+#include "jclib/functional.h"
 #include "jclib/maybe.h"
 
 #include <memory>
@@ -219,6 +220,27 @@ namespace jc
 	
 	};
 
+	/**
+	 * @brief Hashes the held value if there is one, empty optionals all have the same hash.
+	*/
+	template <typename T>
+	struct hash_traits<optional<T>>
+	{
+		template <typename EngineT>
+		static auto hash(const optional<T>& _value, uint64_t _seed) ->
+			jc::enable_if_t<impl::is_hashable<EngineT, T>::value, size_t>
+		{
+			if (_value.has_value())
+			{
+				return impl::hash_sequence<EngineT>(_seed, _seed, true, _value.value());
+			}
+			else
+			{
+				return impl::hash_sequence<EngineT>(_seed, _seed, false);
+			};
+		};
+	};
+
 };
 
 #endif
\ No newline at end of file
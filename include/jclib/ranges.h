@@ -22,6 +22,9 @@
 
 #include <algorithm>
 #include <iterator>
+#include <memory>
+#include <tuple>
+#include <utility>
 
 #define _JCLIB_RANGES_
 
@@ -683,6 +686,72 @@ namespace jc
 		template <typename RangeT, typename Enable = void>
 		struct drop_view;
 
+		/**
+		 * @brief View into the first elements of a range
+		 * @tparam RangeT Range type to view
+		 * @tparam Enable
+		*/
+		template <typename RangeT, typename Enable = void>
+		struct take_view;
+
+		/**
+		 * @brief View into every nth element of a range
+		 * @tparam RangeT Range type to view
+		 * @tparam Enable
+		*/
+		template <typename RangeT, typename Enable = void>
+		struct stride_view;
+
+		/**
+		 * @brief View into a range as consecutive non-overlapping subranges of n elements, the last may be shorter
+		 * @tparam RangeT Range type to view
+		 * @tparam Enable
+		*/
+		template <typename RangeT, typename Enable = void>
+		struct chunk_view;
+
+		/**
+		 * @brief View into a range as every overlapping window of n consecutive elements
+		 * @tparam RangeT Range type to view
+		 * @tparam Enable
+		*/
+		template <typename RangeT, typename Enable = void>
+		struct slide_view;
+
+		/**
+		 * @brief View into a range pairing each element with its index
+		 * @tparam RangeT Range type to view
+		 * @tparam Enable
+		*/
+		template <typename RangeT, typename Enable = void>
+		struct enumerate_view;
+
+		/**
+		 * @brief View into several ranges at once as tuples of their elements, ends with the shortest range
+		 * @tparam RangeTs Range types to view
+		*/
+		template <typename... RangeTs>
+		struct zip_view;
+
+		/**
+		 * @brief View into a range of ranges as one flattened range
+		 * @tparam RangeT Range type to view
+		 * @tparam Enable
+		*/
+		template <typename RangeT, typename Enable = void>
+		struct join_view;
+
+		/**
+		 * @brief Type trait checking if iterators into a range remain valid once the range object is destroyed,
+		 * specialize for views which only refer to elements held elsewhere
+		 * @tparam T Range type, references are always borrowed
+		*/
+		template <typename T, typename Enable = void>
+		struct is_borrowed_range : jc::bool_constant<std::is_lvalue_reference<T>::value> {};
+
+		template <typename IterT>
+		struct is_borrowed_range<iter_view<IterT>> : jc::true_type {};
+
 	};
 };
 
@@ -693,6 +762,81 @@ namespace jc
 	{
 		namespace impl
 		{
+			/**
+			 * @brief Gets the iterator category of a view's iterator from the iterator it wraps, capped at random
+			 * access as the view's elements are never contiguous.
+			 * @tparam UnderlyingT Wrapped iterator type
+			 * @tparam MinimumT Category used when the wrapped iterator's category is lower or unknown
+			 * @tparam Enable SFINAE specialization point
+			*/
+			template <typename UnderlyingT, typename MinimumT = std::forward_iterator_tag, typename Enable = void>
+			struct view_iterator_category
+			{
+				using type = MinimumT;
+			};
+
+			template <typename UnderlyingT, typename MinimumT>
+			struct view_iterator_category<UnderlyingT, MinimumT, jc::void_t<typename std::iterator_traits<UnderlyingT>::iterator_category>>
+			{
+			private:
+				using category = typename std::iterator_traits<UnderlyingT>::iterator_category;
+			public:
+				using type = std::conditional_t
+				<
+					std::is_base_of<std::random_access_iterator_tag, category>::value,
+					std::random_access_iterator_tag,
+					std::conditional_t
+					<
+						std::is_base_of<std::bidirectional_iterator_tag, category>::value,
+						std::bidirectional_iterator_tag,
+						MinimumT
+					>
+				>;
+			};
+
+			template <typename UnderlyingT, typename MinimumT = std::forward_iterator_tag>
+			using view_iterator_category_t = typename view_iterator_category<UnderlyingT, MinimumT>::type;
+
+			/**
+			 * @brief Type trait checking if a view can use an iterator with random access
+			*/
+			template <typename UnderlyingT>
+			struct is_random_view_iterator :
+				jc::bool_constant<std::is_same<view_iterator_category_t<UnderlyingT>, std::random_access_iterator_tag>::value>
+			{};
+
+			/**
+			 * @brief Enables random access operators of view iterators only when their category is random access, so
+			 * range traits which test for the operators see the iterator's real category
+			*/
+			template <typename CategoryT, typename T = void>
+			using enable_if_random_category_t = enable_if_t<std::is_same<CategoryT, std::random_access_iterator_tag>::value, T>;
+
+			/**
+			 * @brief Advances an iterator up to _count elements without passing the end, in constant time for random
+			 * access iterators
+			*/
+			template <typename IterT>
+			JCLIB_CONSTEXPR inline IterT advance_clamped(IterT _at, const IterT _end, size_t _count, jc::true_type)
+			{
+				const auto _remaining = static_cast<size_t>(_end - _at);
+				return _at + static_cast<jc::difference_type_t<IterT>>((_count < _remaining) ? _count : _remaining);
+			};
+			template <typename IterT>
+			JCLIB_CONSTEXPR inline IterT advance_clamped(IterT _at, const IterT _end, size_t _count, jc::false_type)
+			{
+				for (; _count != 0 && _at != _end; --_count)
+				{
+					++_at;
+				};
+				return _at;
+			};
+			template <typename IterT>
+			JCLIB_CONSTEXPR inline IterT advance_clamped(IterT _at, const IterT _end, size_t _count)
+			{
+				return impl::advance_clamped(_at, _end, _count, jc::bool_constant<is_random_view_iterator<IterT>::value>{});
+			};
+
 			template <typename T>
 			struct empty_view_part {};
 
@@ -787,6 +931,18 @@ namespace jc
 	{
 		namespace impl
 		{
+			/**
+			 * @brief Tag type for constructing a condition_iterator without searching for the first passing element
+			*/
+			struct condition_positioned_t { constexpr explicit condition_positioned_t() noexcept = default; };
+
+			/**
+			 * @brief Splits iterators of a view pipeline by position in the random access range underneath, see
+			 * the PIPELINE_CHUNKING region
+			*/
+			template <typename IterT, typename Enable = void>
+			struct iterator_chunker;
+
 			template <typename UnderlyingT, typename OpT>
 			struct condition_iterator
 			{
@@ -874,7 +1030,17 @@ namespace jc
 					};
 				};
 
+				/**
+				 * @brief Constructs the iterator at a position already known to pass the condition, or the end
+				*/
+				constexpr condition_iterator(underlying_type _at, underlying_type _end, OpT& _op, condition_positioned_t) noexcept :
+					at_{ _at }, end_{ _end }, op_{ &_op }
+				{};
+
 			private:
+				template <typename IterT, typename Enable>
+				friend struct iterator_chunker;
+
 				underlying_type at_;
 				underlying_type end_;
 				OpT* op_;
@@ -910,25 +1076,67 @@ namespace jc
 				using iterator = impl::condition_iterator<iterator_t<RangeT>,
 					jc::remove_cvref_t<OpT>>;
 
-				constexpr iterator begin() const noexcept
+				/**
+				 * @brief Gets an iterator to the first element passing the filter.
+				 * 
+				 * The first passing element is searched for on the first call and cached, later calls (including on
+				 * copies of the view) return it without invoking the filter again. Like std::ranges::filter_view,
+				 * modifying the viewed elements after the first call so that a different element would be first is
+				 * not seen.
+				*/
+				constexpr iterator begin()
 				{
-					return this->begin_;
+					if (!this->begin_cached_)
+					{
+						this->first_ = this->find_first();
+						this->begin_cached_ = true;
+					};
+					return iterator{ this->first_, this->last_, this->filter_, impl::condition_positioned_t{} };
+				};
+
+				/**
+				 * @brief Gets an iterator to the first element passing the filter.
+				 * 
+				 * Uses the position cached by the non-const overload if there is one, otherwise searches without
+				 * caching so concurrent calls on a const view don't race.
+				*/
+				constexpr iterator begin() const
+				{
+					return iterator{ (this->begin_cached_) ? this->first_ : this->find_first(), this->last_, this->filter_,
+						impl::condition_positioned_t{} };
 				};
 				constexpr iterator end() const noexcept
 				{
-					return this->end_;
+					return iterator{ this->last_, this->last_, this->filter_, impl::condition_positioned_t{} };
 				};
 
 				constexpr filter_view_impl(RangeT& _range, jc::remove_cvref_t<OpT> _op) :
 					filter_{ std::move(_op) },
-					begin_{ ranges::begin(_range), ranges::end(_range),  this->filter_ },
-					end_{ ranges::end(_range), ranges::end(_range), this->filter_ }
+					first_{ ranges::begin(_range) },
+					last_{ ranges::end(_range) }
 				{};
 
 			private:
-				jc::remove_cvref_t<OpT> filter_;
-				iterator begin_;
-				iterator end_;
+				/**
+				 * @brief Searches for the first element passing the filter
+				*/
+				constexpr iterator_t<RangeT> find_first() const
+				{
+					auto _at = this->first_;
+					while (_at != this->last_ && !jc::invoke(this->filter_, *_at))
+					{
+						++_at;
+					};
+					return _at;
+				};
+
+				// Mutable as iterators from a const view still invoke the filter through a non-const reference
+				mutable jc::remove_cvref_t<OpT> filter_;
+
+				// Start of the viewed range, advanced to the first passing element by the first call to non-const begin()
+				iterator_t<RangeT> first_;
+				iterator_t<RangeT> last_;
+				bool begin_cached_ = false;
 			};
 
 		};
@@ -1253,10 +1461,7 @@ namespace jc
 				JCLIB_CONSTEXPR iterator end() const noexcept { return this->end_; };
 
 				JCLIB_CONSTEXPR drop_view_impl(RangeT& _range, size_t _count) :
-					begin_
-					{
-						jc::next(ranges::begin(_range), _count)
-					},
+					begin_{ impl::advance_clamped(ranges::begin(_range), ranges::end(_range), _count) },
 					end_{ ranges::end(_range) }
 				{};
 
@@ -1390,6 +1595,10 @@ namespace jc
 			template <typename UnderlyingT, typename OpT, typename Enable = void>
 			struct transform_iterator;
 
+			/**
+			 * @brief Iterator applying a transform to the elements of another iterator when dereferenced, has the same
+			 * category as the wrapped iterator up to random access.
+			*/
 			template <typename UnderlyingT, typename OpT>
 			struct transform_iterator<UnderlyingT, OpT, enable_if_t<
 				jc::is_invocable<OpT, decltype(*std::declval<UnderlyingT>())>::value
@@ -1399,9 +1608,45 @@ namespace jc
 				using underlying_type = UnderlyingT;
 				using transformed_type = jc::invoke_result_t<OpT, const decltype(*std::declval<underlying_type>())>;
 
+				/**
+				 * @brief Holds a transformed value so operator-> can be used when the transform returns by value
+				*/
+				struct transformed_ptr
+				{
+					JCLIB_CONSTEXPR transformed_type& operator*() noexcept
+					{
+						return this->value_;
+					};
+					JCLIB_CONSTEXPR const transformed_type& operator*() const noexcept
+					{
+						return this->value_;
+					};
+
+					JCLIB_CONSTEXPR transformed_type* operator->() noexcept
+					{
+						return &this->value_;
+					};
+					JCLIB_CONSTEXPR const transformed_type* operator->() const noexcept
+					{
+						return &this->value_;
+					};
+
+					transformed_type value_;
+				};
+
 			public:
-				using iterator_category = std::forward_iterator_tag;
+				using iterator_category = view_iterator_category_t<underlying_type>;
 				using difference_type = std::ptrdiff_t;
+				using value_type = jc::remove_cvref_t<transformed_type>;
+				using reference = transformed_type;
+
+				// Transforms returning a reference are pointed to directly, others are held in a temporary
+				using pointer = std::conditional_t
+				<
+					std::is_lvalue_reference<transformed_type>::value,
+					std::add_pointer_t<std::remove_reference_t<transformed_type>>,
+					transformed_ptr
+				>;
 
 				friend inline JCLIB_CONSTEXPR bool operator==(const transform_iterator& _lhs, const underlying_type& _rhs) noexcept
 				{
@@ -1435,27 +1680,13 @@ namespace jc
 					return jc::invoke(*this->op_, *this->at_);
 				};
 
-				struct transformed_ptr
+				JCLIB_CONSTEXPR pointer arrow(jc::true_type /* is reference */) const
 				{
-					JCLIB_CONSTEXPR transformed_type& operator*() noexcept
-					{
-						return this->value_;
-					};
-					JCLIB_CONSTEXPR const transformed_type& operator*() const noexcept
-					{
-						return this->value_;
-					};
-
-					JCLIB_CONSTEXPR transformed_type* operator->() noexcept
-					{
-						return &this->value_;
-					};
-					JCLIB_CONSTEXPR const transformed_type* operator->() const noexcept
-					{
-						return &this->value_;
-					};
-
-					transformed_type value_;
+					return std::addressof(this->get());
+				};
+				JCLIB_CONSTEXPR pointer arrow(jc::false_type /* is reference */) const
+				{
+					return pointer{ this->get() };
 				};
 
 			public:
@@ -1463,13 +1694,11 @@ namespace jc
 				{
 					return this->get();
 				};
-				JCLIB_CONSTEXPR auto* operator->() const
+				JCLIB_CONSTEXPR pointer operator->() const
 				{
-					return transformed_ptr{ this->get() };
+					return this->arrow(jc::bool_constant<std::is_lvalue_reference<transformed_type>::value>{});
 				};
 
-			public:
-
 				constexpr transform_iterator& operator++()
 				{
 					++this->at_;
@@ -1482,16 +1711,93 @@ namespace jc
 					return _out;
 				};
 
+				// The following are only usable if the wrapped iterator supports them
+
+				constexpr transform_iterator& operator--()
+				{
+					--this->at_;
+					return *this;
+				};
+				constexpr transform_iterator operator--(int)
+				{
+					const auto _out{ *this };
+					--(*this);
+					return _out;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				constexpr transform_iterator& operator+=(difference_type _count)
+				{
+					this->at_ += _count;
+					return *this;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				constexpr transform_iterator& operator-=(difference_type _count)
+				{
+					this->at_ -= _count;
+					return *this;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline constexpr transform_iterator operator+(transform_iterator _lhs, difference_type _count)
+				{
+					return _lhs += _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline constexpr transform_iterator operator+(difference_type _count, transform_iterator _rhs)
+				{
+					return _rhs += _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline constexpr transform_iterator operator-(transform_iterator _lhs, difference_type _count)
+				{
+					return _lhs -= _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline constexpr difference_type operator-(const transform_iterator& _lhs, const transform_iterator& _rhs)
+				{
+					return static_cast<difference_type>(_lhs.at_ - _rhs.at_);
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR transformed_type operator[](difference_type _offset) const
+				{
+					return jc::invoke(*this->op_, this->at_[_offset]);
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline constexpr bool operator<(const transform_iterator& _lhs, const transform_iterator& _rhs)
+				{
+					return _lhs.at_ < _rhs.at_;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline constexpr bool operator>(const transform_iterator& _lhs, const transform_iterator& _rhs)
+				{
+					return _rhs.at_ < _lhs.at_;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline constexpr bool operator<=(const transform_iterator& _lhs, const transform_iterator& _rhs)
+				{
+					return !(_rhs.at_ < _lhs.at_);
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline constexpr bool operator>=(const transform_iterator& _lhs, const transform_iterator& _rhs)
+				{
+					return !(_lhs.at_ < _rhs.at_);
+				};
+
 				constexpr transform_iterator() noexcept :
 					op_{ nullptr }
 				{};
-				constexpr transform_iterator(underlying_type _at, underlying_type _end, OpT& _op) noexcept :
-					at_{ _at }, end_{ _end }, op_{ &_op }
+				constexpr transform_iterator(underlying_type _at, OpT& _op) noexcept :
+					at_{ _at }, op_{ &_op }
 				{};
 
 			private:
+				template <typename IterT, typename Enable>
+				friend struct iterator_chunker;
+
 				underlying_type at_{};
-				underlying_type end_{};
 				OpT* op_;
 			};
 
@@ -1503,33 +1809,35 @@ namespace jc
 			public:
 				using iterator = impl::transform_iterator<raw_iterator, remove_cvref_t<OpT>>;
 
-				constexpr iterator begin() const noexcept { return this->begin_; };
-				constexpr iterator end() const noexcept { return this->end_; };
+				// Iterators are made on demand so they always point to this view's transform, even after copying the view
+				constexpr iterator begin() const noexcept { return iterator{ this->first_, this->op_ }; };
+				constexpr iterator end() const noexcept { return iterator{ this->last_, this->op_ }; };
 
 				constexpr transform_view_impl(RangeT& _range, jc::remove_cvref_t<OpT> _op) :
 					op_{ std::move(_op) },
-					begin_{ iterator{ jc::ranges::begin(_range), jc::ranges::end(_range), this->op_ } },
-					end_{ iterator{ jc::ranges::end(_range), jc::ranges::end(_range), this->op_} }
+					first_{ jc::ranges::begin(_range) },
+					last_{ jc::ranges::end(_range) }
 				{};
 
 			private:
-				remove_cvref_t<OpT> op_;
-				iterator begin_;
-				iterator end_;
+				// Mutable as iterators from a const view still invoke the transform through a non-const reference
+				mutable remove_cvref_t<OpT> op_;
+				raw_iterator first_;
+				raw_iterator last_;
 			};
 		};
 
 #ifdef JCLIB_FEATURE_CONCEPTS
 		template <typename RangeT, typename OpT>
 		requires jc::cx_range<RangeT> &&
-				 jc::cx_invocable<OpT, const jc::ranges::value_t<RangeT>&>
+				 jc::cx_invocable<OpT, decltype(*std::declval<jc::ranges::iterator_t<RangeT>>())>
 		struct transform_view<RangeT, OpT, void>
 #else
 		template <typename RangeT, typename OpT>
 		struct transform_view<RangeT, OpT, jc::enable_if_t
 			<
 			jc::ranges::is_range<RangeT>::value&&
-			jc::is_invocable<OpT, const jc::ranges::value_t<RangeT>&>::value
+			jc::is_invocable<OpT, decltype(*std::declval<jc::ranges::iterator_t<RangeT>>())>::value
 			>>
 #endif
 			: jc::ranges::impl::transform_view_impl<RangeT, OpT>
@@ -1579,4 +1887,1665 @@ namespace jc
 
 
 
+/*
+	Take view
+*/
+
+#pragma region TAKE_VIEW
+
+namespace jc
+{
+	namespace ranges
+	{
+		namespace impl
+		{
+			/**
+			 * @brief Uses the viewed range's iterators so the view keeps the same category, contiguity and size
+			*/
+			template <typename RangeT>
+			struct take_view_impl : public view_interface<take_view_impl<RangeT>>
+			{
+			public:
+				using iterator = iterator_t<RangeT>;
+
+				JCLIB_CONSTEXPR iterator begin() const noexcept { return this->begin_; };
+				JCLIB_CONSTEXPR iterator end() const noexcept { return this->end_; };
+
+				JCLIB_CONSTEXPR take_view_impl(RangeT& _range, size_t _count) :
+					begin_{ ranges::begin(_range) },
+					end_{ impl::advance_clamped(ranges::begin(_range), ranges::end(_range), _count) }
+				{};
+
+			private:
+				iterator begin_;
+				iterator end_;
+			};
+		};
+
+		template <typename RangeT>
+		struct take_view<RangeT, enable_if_t<jc::ranges::is_range<RangeT>::value>> :
+			public impl::take_view_impl<RangeT>
+		{
+		private:
+			using parent_type = impl::take_view_impl<RangeT>;
+		public:
+			using parent_type::parent_type;
+			using parent_type::operator=;
+		};
+	};
+
+	namespace views
+	{
+		namespace impl
+		{
+			struct take_impl_t
+			{
+				template <typename RangeT>
+				constexpr friend inline auto operator|(RangeT&& _range, take_impl_t _take) noexcept ->
+					ranges::take_view<remove_reference_t<RangeT>>
+				{
+					return ranges::take_view<remove_reference_t<RangeT>>{ _range, _take.count_ };
+				};
+				size_t count_;
+			};
+
+			struct take_t
+			{
+				constexpr take_impl_t operator()(size_t _count) const noexcept
+				{
+					return take_impl_t{ _count };
+				};
+				template <typename RangeT>
+				constexpr auto operator()(RangeT&& _range, size_t _count) const noexcept
+				{
+					return _range | take_impl_t{ _count };
+				};
+			};
+		};
+		constexpr static impl::take_t take{};
+	};
+};
+
+#pragma endregion TAKE_VIEW
+
+
+
+/*
+	Stride and chunk views
+*/
+
+#pragma region STRIDE_VIEW
+
+namespace jc
+{
+	namespace ranges
+	{
+		namespace impl
+		{
+			/**
+			 * @brief Navigation shared by iterators which step through a range n elements at a time, the last step
+			 * may be shorter. Random access is provided when the wrapped iterator has random access.
+			 * @tparam DerivedT Iterator type inheriting from this
+			 * @tparam UnderlyingT Wrapped iterator type
+			*/
+			template <typename DerivedT, typename UnderlyingT>
+			struct step_iterator_base
+			{
+			public:
+				using iterator_category = std::conditional_t
+				<
+					is_random_view_iterator<UnderlyingT>::value,
+					std::random_access_iterator_tag,
+					std::forward_iterator_tag
+				>;
+				using difference_type = std::ptrdiff_t;
+
+			private:
+				JCLIB_CONSTEXPR DerivedT& as_derived() noexcept
+				{
+					return static_cast<DerivedT&>(*this);
+				};
+
+				/**
+				 * @brief Gets the number of steps from the start of the range, random access only
+				*/
+				JCLIB_CONSTEXPR difference_type index() const
+				{
+					const auto _step = static_cast<difference_type>(this->step_);
+					return (static_cast<difference_type>(this->at_ - this->first_) + _step - 1) / _step;
+				};
+
+				/**
+				 * @brief Moves to a number of steps from the start of the range, random access only
+				*/
+				JCLIB_CONSTEXPR void seek(difference_type _index)
+				{
+					JCLIB_ASSERT(_index >= 0);
+					const auto _size = static_cast<size_t>(this->end_ - this->first_);
+					const auto _offset = static_cast<size_t>(_index) * this->step_;
+					this->at_ = this->first_ + static_cast<jc::difference_type_t<UnderlyingT>>((_offset < _size) ? _offset : _size);
+				};
+
+			public:
+				friend inline JCLIB_CONSTEXPR bool operator==(const DerivedT& _lhs, const DerivedT& _rhs)
+				{
+					return _lhs.at_ == _rhs.at_;
+				};
+				friend inline JCLIB_CONSTEXPR bool operator!=(const DerivedT& _lhs, const DerivedT& _rhs)
+				{
+					return !(_lhs == _rhs);
+				};
+
+				JCLIB_CONSTEXPR DerivedT& operator++()
+				{
+					this->at_ = impl::advance_clamped(this->at_, this->end_, this->step_);
+					return this->as_derived();
+				};
+				JCLIB_CONSTEXPR DerivedT operator++(int)
+				{
+					auto _out = this->as_derived();
+					++(*this);
+					return _out;
+				};
+
+				// The following are only usable if the wrapped iterator has random access
+
+				JCLIB_CONSTEXPR DerivedT& operator--()
+				{
+					this->seek(this->index() - 1);
+					return this->as_derived();
+				};
+				JCLIB_CONSTEXPR DerivedT operator--(int)
+				{
+					auto _out = this->as_derived();
+					--(*this);
+					return _out;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR DerivedT& operator+=(difference_type _count)
+				{
+					this->seek(this->index() + _count);
+					return this->as_derived();
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR DerivedT& operator-=(difference_type _count)
+				{
+					return *this += -_count;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR DerivedT operator+(DerivedT _lhs, difference_type _count)
+				{
+					return _lhs += _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR DerivedT operator+(difference_type _count, DerivedT _rhs)
+				{
+					return _rhs += _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR DerivedT operator-(DerivedT _lhs, difference_type _count)
+				{
+					return _lhs -= _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR difference_type operator-(const DerivedT& _lhs, const DerivedT& _rhs)
+				{
+					return _lhs.index() - _rhs.index();
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator<(const DerivedT& _lhs, const DerivedT& _rhs)
+				{
+					return _lhs.at_ < _rhs.at_;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator>(const DerivedT& _lhs, const DerivedT& _rhs)
+				{
+					return _rhs < _lhs;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator<=(const DerivedT& _lhs, const DerivedT& _rhs)
+				{
+					return !(_rhs < _lhs);
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator>=(const DerivedT& _lhs, const DerivedT& _rhs)
+				{
+					return !(_lhs < _rhs);
+				};
+
+				JCLIB_CONSTEXPR step_iterator_base() = default;
+				JCLIB_CONSTEXPR step_iterator_base(UnderlyingT _first, UnderlyingT _at, UnderlyingT _end, size_t _step) :
+					first_{ _first }, at_{ _at }, end_{ _end }, step_{ _step }
+				{
+					JCLIB_ASSERT(_step != 0);
+				};
+
+			protected:
+				UnderlyingT first_{};
+				UnderlyingT at_{};
+				UnderlyingT end_{};
+				size_t step_ = 1;
+			};
+
+			/**
+			 * @brief Iterator visiting every nth element of a range
+			*/
+			template <typename UnderlyingT>
+			struct stride_iterator : public step_iterator_base<stride_iterator<UnderlyingT>, UnderlyingT>
+			{
+			private:
+				using parent_type = step_iterator_base<stride_iterator<UnderlyingT>, UnderlyingT>;
+			public:
+				using reference = decltype(*std::declval<const UnderlyingT&>());
+				using value_type = jc::remove_cvref_t<reference>;
+				using pointer = std::add_pointer_t<std::remove_reference_t<reference>>;
+
+				JCLIB_CONSTEXPR reference operator*() const
+				{
+					return *this->at_;
+				};
+				JCLIB_CONSTEXPR pointer operator->() const
+				{
+					return std::addressof(*this->at_);
+				};
+				template <typename CategoryT = typename parent_type::iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR reference operator[](typename parent_type::difference_type _offset) const
+				{
+					return *(*this + _offset);
+				};
+
+				using parent_type::parent_type;
+			};
+
+			/**
+			 * @brief Iterator visiting consecutive subranges of n elements, the last may be shorter
+			*/
+			template <typename UnderlyingT>
+			struct chunk_iterator : public step_iterator_base<chunk_iterator<UnderlyingT>, UnderlyingT>
+			{
+			private:
+				using parent_type = step_iterator_base<chunk_iterator<UnderlyingT>, UnderlyingT>;
+			public:
+				using value_type = ranges::iter_view<UnderlyingT>;
+				using reference = value_type;
+				using pointer = void;
+
+				JCLIB_CONSTEXPR reference operator*() const
+				{
+					return value_type{ this->at_, impl::advance_clamped(this->at_, this->end_, this->step_) };
+				};
+				template <typename CategoryT = typename parent_type::iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR reference operator[](typename parent_type::difference_type _offset) const
+				{
+					return *(*this + _offset);
+				};
+
+				using parent_type::parent_type;
+			};
+
+			/**
+			 * @brief Implements views which step through a range using one of the step iterators
+			*/
+			template <typename RangeT, template <typename> class IteratorT>
+			struct step_view_impl : public view_interface<step_view_impl<RangeT, IteratorT>>
+			{
+			public:
+				using iterator = IteratorT<iterator_t<RangeT>>;
+
+				JCLIB_CONSTEXPR iterator begin() const { return iterator{ this->first_, this->first_, this->last_, this->step_ }; };
+				JCLIB_CONSTEXPR iterator end() const { return iterator{ this->first_, this->last_, this->last_, this->step_ }; };
+
+				JCLIB_CONSTEXPR step_view_impl(RangeT& _range, size_t _step) :
+					first_{ ranges::begin(_range) }, last_{ ranges::end(_range) }, step_{ _step }
+				{
+					JCLIB_ASSERT(_step != 0);
+				};
+
+			private:
+				iterator_t<RangeT> first_;
+				iterator_t<RangeT> last_;
+				size_t step_;
+			};
+		};
+
+		template <typename RangeT>
+		struct stride_view<RangeT, enable_if_t<jc::ranges::is_range<RangeT>::value>> :
+			public impl::step_view_impl<RangeT, impl::stride_iterator>
+		{
+		private:
+			using parent_type = impl::step_view_impl<RangeT, impl::stride_iterator>;
+		public:
+			using parent_type::parent_type;
+			using parent_type::operator=;
+		};
+
+		template <typename RangeT>
+		struct chunk_view<RangeT, enable_if_t<jc::ranges::is_range<RangeT>::value>> :
+			public impl::step_view_impl<RangeT, impl::chunk_iterator>
+		{
+		private:
+			using parent_type = impl::step_view_impl<RangeT, impl::chunk_iterator>;
+		public:
+			using parent_type::parent_type;
+			using parent_type::operator=;
+		};
+	};
+
+	namespace views
+	{
+		namespace impl
+		{
+			/**
+			 * @brief Pipeable adaptor for views constructed from a range and a count
+			 * @tparam ViewT View template to construct
+			*/
+			template <template <typename, typename> class ViewT>
+			struct counted_view_impl_t
+			{
+				template <typename RangeT>
+				constexpr friend inline auto operator|(RangeT&& _range, counted_view_impl_t _adaptor) ->
+					ViewT<remove_reference_t<RangeT>, void>
+				{
+					return ViewT<remove_reference_t<RangeT>, void>{ _range, _adaptor.count_ };
+				};
+				size_t count_;
+			};
+
+			template <template <typename, typename> class ViewT>
+			struct counted_view_t
+			{
+				constexpr counted_view_impl_t<ViewT> operator()(size_t _count) const noexcept
+				{
+					return counted_view_impl_t<ViewT>{ _count };
+				};
+				template <typename RangeT>
+				constexpr auto operator()(RangeT&& _range, size_t _count) const
+				{
+					return _range | counted_view_impl_t<ViewT>{ _count };
+				};
+			};
+		};
+
+		/**
+		 * @brief Views every nth element of a range, starting with the first
+		*/
+		constexpr static impl::counted_view_t<ranges::stride_view> stride{};
+
+		/**
+		 * @brief Views a range as consecutive subranges of n elements, the last may be shorter
+		*/
+		constexpr static impl::counted_view_t<ranges::chunk_view> chunk{};
+	};
+};
+
+#pragma endregion STRIDE_VIEW
+
+
+
+/*
+	Slide view
+*/
+
+#pragma region SLIDE_VIEW
+
+namespace jc
+{
+	namespace ranges
+	{
+		namespace impl
+		{
+			/**
+			 * @brief Iterator visiting every window of n consecutive elements of a range
+			*/
+			template <typename UnderlyingT>
+			struct slide_iterator
+			{
+			public:
+				using iterator_category = view_iterator_category_t<UnderlyingT>;
+				using difference_type = std::ptrdiff_t;
+				using value_type = ranges::iter_view<UnderlyingT>;
+				using reference = value_type;
+				using pointer = void;
+
+				friend inline JCLIB_CONSTEXPR bool operator==(const slide_iterator& _lhs, const slide_iterator& _rhs)
+				{
+					return _lhs.at_ == _rhs.at_;
+				};
+				friend inline JCLIB_CONSTEXPR bool operator!=(const slide_iterator& _lhs, const slide_iterator& _rhs)
+				{
+					return !(_lhs == _rhs);
+				};
+
+				JCLIB_CONSTEXPR reference operator*() const
+				{
+					return value_type{ this->at_, jc::next(this->last_) };
+				};
+
+				JCLIB_CONSTEXPR slide_iterator& operator++()
+				{
+					++this->at_;
+					++this->last_;
+					return *this;
+				};
+				JCLIB_CONSTEXPR slide_iterator operator++(int)
+				{
+					auto _out = *this;
+					++(*this);
+					return _out;
+				};
+
+				// The following are only usable if the wrapped iterator supports them
+
+				JCLIB_CONSTEXPR slide_iterator& operator--()
+				{
+					--this->at_;
+					--this->last_;
+					return *this;
+				};
+				JCLIB_CONSTEXPR slide_iterator operator--(int)
+				{
+					auto _out = *this;
+					--(*this);
+					return _out;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR slide_iterator& operator+=(difference_type _count)
+				{
+					this->at_ += _count;
+					this->last_ += _count;
+					return *this;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR slide_iterator& operator-=(difference_type _count)
+				{
+					return *this += -_count;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR slide_iterator operator+(slide_iterator _lhs, difference_type _count)
+				{
+					return _lhs += _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR slide_iterator operator+(difference_type _count, slide_iterator _rhs)
+				{
+					return _rhs += _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR slide_iterator operator-(slide_iterator _lhs, difference_type _count)
+				{
+					return _lhs -= _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR difference_type operator-(const slide_iterator& _lhs, const slide_iterator& _rhs)
+				{
+					return static_cast<difference_type>(_lhs.at_ - _rhs.at_);
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR reference operator[](difference_type _offset) const
+				{
+					return *(*this + _offset);
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator<(const slide_iterator& _lhs, const slide_iterator& _rhs)
+				{
+					return _lhs.at_ < _rhs.at_;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator>(const slide_iterator& _lhs, const slide_iterator& _rhs)
+				{
+					return _rhs < _lhs;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator<=(const slide_iterator& _lhs, const slide_iterator& _rhs)
+				{
+					return !(_rhs < _lhs);
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator>=(const slide_iterator& _lhs, const slide_iterator& _rhs)
+				{
+					return !(_lhs < _rhs);
+				};
+
+				JCLIB_CONSTEXPR slide_iterator() = default;
+
+				/**
+				 * @param _at First element of the window
+				 * @param _last Last element of the window
+				*/
+				JCLIB_CONSTEXPR slide_iterator(UnderlyingT _at, UnderlyingT _last) :
+					at_{ _at }, last_{ _last }
+				{};
+
+			private:
+				UnderlyingT at_{};
+				UnderlyingT last_{};
+			};
+
+			template <typename RangeT>
+			struct slide_view_impl : public view_interface<slide_view_impl<RangeT>>
+			{
+			public:
+				using iterator = slide_iterator<iterator_t<RangeT>>;
+
+				JCLIB_CONSTEXPR iterator begin() const noexcept { return this->begin_; };
+				JCLIB_CONSTEXPR iterator end() const noexcept { return this->end_; };
+
+				JCLIB_CONSTEXPR slide_view_impl(RangeT& _range, size_t _count) :
+					begin_{}, end_{}
+				{
+					JCLIB_ASSERT(_count != 0);
+					const auto _first = ranges::begin(_range);
+					const auto _last = ranges::end(_range);
+
+					// Last element of the first window, ranges with fewer elements than a window are empty
+					const auto _windowLast = impl::advance_clamped(_first, _last, _count - 1);
+					if (_windowLast == _last)
+					{
+						this->begin_ = iterator{ _last, _last };
+						this->end_ = this->begin_;
+						return;
+					};
+					this->begin_ = iterator{ _first, _windowLast };
+
+					// The end iterator starts one past the start of the last window, its last element is the range end
+					this->end_ = iterator{ slide_view_impl::end_start(_first, _windowLast, _last,
+						jc::bool_constant<is_random_view_iterator<iterator_t<RangeT>>::value>{}), _last };
+				};
+
+			private:
+				using underlying_iterator = iterator_t<RangeT>;
+
+				static JCLIB_CONSTEXPR underlying_iterator end_start(underlying_iterator _first, underlying_iterator _windowLast,
+					underlying_iterator _last, jc::true_type)
+				{
+					return _first + ((_last - _windowLast));
+				};
+				static JCLIB_CONSTEXPR underlying_iterator end_start(underlying_iterator _first, underlying_iterator _windowLast,
+					underlying_iterator _last, jc::false_type)
+				{
+					for (; _windowLast != _last; ++_windowLast)
+					{
+						++_first;
+					};
+					return _first;
+				};
+
+				iterator begin_;
+				iterator end_;
+			};
+		};
+
+		template <typename RangeT>
+		struct slide_view<RangeT, enable_if_t<jc::ranges::is_range<RangeT>::value>> :
+			public impl::slide_view_impl<RangeT>
+		{
+		private:
+			using parent_type = impl::slide_view_impl<RangeT>;
+		public:
+			using parent_type::parent_type;
+			using parent_type::operator=;
+		};
+	};
+
+	namespace views
+	{
+		/**
+		 * @brief Views every window of n consecutive elements of a range
+		*/
+		constexpr static impl::counted_view_t<ranges::slide_view> slide{};
+	};
+};
+
+#pragma endregion SLIDE_VIEW
+
+
+
+/*
+	Enumerate view
+*/
+
+#pragma region ENUMERATE_VIEW
+
+namespace jc
+{
+	namespace ranges
+	{
+		namespace impl
+		{
+			/**
+			 * @brief Iterator pairing each element of a range with its index
+			*/
+			template <typename UnderlyingT>
+			struct enumerate_iterator
+			{
+			private:
+				using underlying_reference = decltype(*std::declval<const UnderlyingT&>());
+			public:
+				using iterator_category = view_iterator_category_t<UnderlyingT>;
+				using difference_type = std::ptrdiff_t;
+				using value_type = std::pair<difference_type, jc::remove_cvref_t<underlying_reference>>;
+				using reference = std::pair<difference_type, underlying_reference>;
+				using pointer = void;
+
+				friend inline JCLIB_CONSTEXPR bool operator==(const enumerate_iterator& _lhs, const enumerate_iterator& _rhs)
+				{
+					return _lhs.at_ == _rhs.at_;
+				};
+				friend inline JCLIB_CONSTEXPR bool operator!=(const enumerate_iterator& _lhs, const enumerate_iterator& _rhs)
+				{
+					return !(_lhs == _rhs);
+				};
+
+				JCLIB_CONSTEXPR reference operator*() const
+				{
+					return reference{ this->index_, *this->at_ };
+				};
+
+				/**
+				 * @brief Gets the index of the current element
+				*/
+				JCLIB_CONSTEXPR difference_type index() const noexcept
+				{
+					return this->index_;
+				};
+
+				JCLIB_CONSTEXPR enumerate_iterator& operator++()
+				{
+					++this->at_;
+					++this->index_;
+					return *this;
+				};
+				JCLIB_CONSTEXPR enumerate_iterator operator++(int)
+				{
+					auto _out = *this;
+					++(*this);
+					return _out;
+				};
+
+				// The following are only usable if the wrapped iterator supports them
+
+				JCLIB_CONSTEXPR enumerate_iterator& operator--()
+				{
+					--this->at_;
+					--this->index_;
+					return *this;
+				};
+				JCLIB_CONSTEXPR enumerate_iterator operator--(int)
+				{
+					auto _out = *this;
+					--(*this);
+					return _out;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR enumerate_iterator& operator+=(difference_type _count)
+				{
+					this->at_ += _count;
+					this->index_ += _count;
+					return *this;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR enumerate_iterator& operator-=(difference_type _count)
+				{
+					return *this += -_count;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR enumerate_iterator operator+(enumerate_iterator _lhs, difference_type _count)
+				{
+					return _lhs += _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR enumerate_iterator operator+(difference_type _count, enumerate_iterator _rhs)
+				{
+					return _rhs += _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR enumerate_iterator operator-(enumerate_iterator _lhs, difference_type _count)
+				{
+					return _lhs -= _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR difference_type operator-(const enumerate_iterator& _lhs, const enumerate_iterator& _rhs)
+				{
+					return _lhs.index_ - _rhs.index_;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR reference operator[](difference_type _offset) const
+				{
+					return *(*this + _offset);
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator<(const enumerate_iterator& _lhs, const enumerate_iterator& _rhs)
+				{
+					return _lhs.index_ < _rhs.index_;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator>(const enumerate_iterator& _lhs, const enumerate_iterator& _rhs)
+				{
+					return _rhs < _lhs;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator<=(const enumerate_iterator& _lhs, const enumerate_iterator& _rhs)
+				{
+					return !(_rhs < _lhs);
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator>=(const enumerate_iterator& _lhs, const enumerate_iterator& _rhs)
+				{
+					return !(_lhs < _rhs);
+				};
+
+				JCLIB_CONSTEXPR enumerate_iterator() = default;
+				JCLIB_CONSTEXPR enumerate_iterator(UnderlyingT _at, difference_type _index) :
+					at_{ _at }, index_{ _index }
+				{};
+
+			private:
+				UnderlyingT at_{};
+				difference_type index_ = 0;
+			};
+
+			template <typename RangeT>
+			struct enumerate_view_impl : public view_interface<enumerate_view_impl<RangeT>>
+			{
+			public:
+				using iterator = enumerate_iterator<iterator_t<RangeT>>;
+
+				JCLIB_CONSTEXPR iterator begin() const noexcept { return this->begin_; };
+				JCLIB_CONSTEXPR iterator end() const noexcept { return this->end_; };
+
+				JCLIB_CONSTEXPR enumerate_view_impl(RangeT& _range) :
+					begin_{ ranges::begin(_range), 0 },
+					end_{ ranges::end(_range), enumerate_view_impl::end_index(ranges::begin(_range), ranges::end(_range),
+						jc::bool_constant<is_random_view_iterator<iterator_t<RangeT>>::value>{}) }
+				{};
+
+			private:
+
+				/**
+				 * @brief Gets the index of the end iterator in constant time for random access iterators
+				*/
+				static JCLIB_CONSTEXPR std::ptrdiff_t end_index(const iterator_t<RangeT>& _begin, const iterator_t<RangeT>& _end, jc::true_type)
+				{
+					return static_cast<std::ptrdiff_t>(_end - _begin);
+				};
+
+				/**
+				 * @brief Iterators without random access only compare their underlying iterators, so the end index isn't
+				 * needed and the range isn't walked when the view is made
+				*/
+				static JCLIB_CONSTEXPR std::ptrdiff_t end_index(const iterator_t<RangeT>&, const iterator_t<RangeT>&, jc::false_type)
+				{
+					return 0;
+				};
+
+				iterator begin_;
+				iterator end_;
+			};
+		};
+
+		template <typename RangeT>
+		struct enumerate_view<RangeT, enable_if_t<jc::ranges::is_range<RangeT>::value>> :
+			public impl::enumerate_view_impl<RangeT>
+		{
+		private:
+			using parent_type = impl::enumerate_view_impl<RangeT>;
+		public:
+			using parent_type::parent_type;
+			using parent_type::operator=;
+		};
+	};
+
+	namespace views
+	{
+		namespace impl
+		{
+			struct enumerate_t
+			{
+				template <typename RangeT>
+				constexpr auto operator()(RangeT&& _range) const -> ranges::enumerate_view<remove_reference_t<RangeT>>
+				{
+					return ranges::enumerate_view<remove_reference_t<RangeT>>(_range);
+				};
+
+				template <typename RangeT>
+				constexpr friend inline auto operator|(RangeT&& _range, const enumerate_t& _enumerate) ->
+					ranges::enumerate_view<remove_reference_t<RangeT>>
+				{
+					return _enumerate(_range);
+				};
+			};
+		};
+
+		/**
+		 * @brief Views a range as pairs of each element's index and the element
+		*/
+		constexpr static impl::enumerate_t enumerate{};
+	};
+};
+
+#pragma endregion ENUMERATE_VIEW
+
+
+
+/*
+	Zip view
+*/
+
+#pragma region ZIP_VIEW
+
+namespace jc
+{
+	namespace ranges
+	{
+		namespace impl
+		{
+			/**
+			 * @brief Iterator over several ranges at once, the category is the lowest of the wrapped iterators'
+			*/
+			template <typename... UnderlyingTs>
+			struct zip_iterator
+			{
+			private:
+				using indices = std::index_sequence_for<UnderlyingTs...>;
+
+			public:
+				using iterator_category = std::common_type_t<view_iterator_category_t<UnderlyingTs>...>;
+				using difference_type = std::ptrdiff_t;
+				using value_type = std::tuple<jc::remove_cvref_t<decltype(*std::declval<const UnderlyingTs&>())>...>;
+				using reference = std::tuple<decltype(*std::declval<const UnderlyingTs&>())...>;
+				using pointer = void;
+
+			private:
+				template <size_t... Is>
+				JCLIB_CONSTEXPR bool any_equal(const zip_iterator& _other, std::index_sequence<Is...>) const
+				{
+					bool _out = false;
+					const bool _results[]{ false, (_out = _out || std::get<Is>(this->at_) == std::get<Is>(_other.at_))... };
+					static_cast<void>(_results);
+					return _out;
+				};
+
+				template <size_t... Is>
+				JCLIB_CONSTEXPR reference get(std::index_sequence<Is...>) const
+				{
+					return reference{ *std::get<Is>(this->at_)... };
+				};
+
+				template <size_t... Is>
+				JCLIB_CONSTEXPR void advance(difference_type _count, std::index_sequence<Is...>)
+				{
+					const int _results[]{ 0, ((std::get<Is>(this->at_) += _count), 0)... };
+					static_cast<void>(_results);
+				};
+
+				template <size_t... Is>
+				JCLIB_CONSTEXPR void increment(std::index_sequence<Is...>)
+				{
+					const int _results[]{ 0, (++std::get<Is>(this->at_), 0)... };
+					static_cast<void>(_results);
+				};
+
+				template <size_t... Is>
+				JCLIB_CONSTEXPR void decrement(std::index_sequence<Is...>)
+				{
+					const int _results[]{ 0, (--std::get<Is>(this->at_), 0)... };
+					static_cast<void>(_results);
+				};
+
+			public:
+
+				/**
+				 * @brief Iterators are equal if any of their wrapped iterators are, so the view ends with the shortest range
+				*/
+				friend inline JCLIB_CONSTEXPR bool operator==(const zip_iterator& _lhs, const zip_iterator& _rhs)
+				{
+					return _lhs.any_equal(_rhs, indices{});
+				};
+				friend inline JCLIB_CONSTEXPR bool operator!=(const zip_iterator& _lhs, const zip_iterator& _rhs)
+				{
+					return !(_lhs == _rhs);
+				};
+
+				JCLIB_CONSTEXPR reference operator*() const
+				{
+					return this->get(indices{});
+				};
+
+				JCLIB_CONSTEXPR zip_iterator& operator++()
+				{
+					this->increment(indices{});
+					return *this;
+				};
+				JCLIB_CONSTEXPR zip_iterator operator++(int)
+				{
+					auto _out = *this;
+					++(*this);
+					return _out;
+				};
+
+				// The following are only usable if the wrapped iterators support them
+
+				JCLIB_CONSTEXPR zip_iterator& operator--()
+				{
+					this->decrement(indices{});
+					return *this;
+				};
+				JCLIB_CONSTEXPR zip_iterator operator--(int)
+				{
+					auto _out = *this;
+					--(*this);
+					return _out;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR zip_iterator& operator+=(difference_type _count)
+				{
+					this->advance(_count, indices{});
+					return *this;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR zip_iterator& operator-=(difference_type _count)
+				{
+					return *this += -_count;
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR zip_iterator operator+(zip_iterator _lhs, difference_type _count)
+				{
+					return _lhs += _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR zip_iterator operator+(difference_type _count, zip_iterator _rhs)
+				{
+					return _rhs += _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR zip_iterator operator-(zip_iterator _lhs, difference_type _count)
+				{
+					return _lhs -= _count;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR difference_type operator-(const zip_iterator& _lhs, const zip_iterator& _rhs)
+				{
+					return static_cast<difference_type>(std::get<0>(_lhs.at_) - std::get<0>(_rhs.at_));
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				JCLIB_CONSTEXPR reference operator[](difference_type _offset) const
+				{
+					return *(*this + _offset);
+				};
+
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator<(const zip_iterator& _lhs, const zip_iterator& _rhs)
+				{
+					return std::get<0>(_lhs.at_) < std::get<0>(_rhs.at_);
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator>(const zip_iterator& _lhs, const zip_iterator& _rhs)
+				{
+					return _rhs < _lhs;
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator<=(const zip_iterator& _lhs, const zip_iterator& _rhs)
+				{
+					return !(_rhs < _lhs);
+				};
+				template <typename CategoryT = iterator_category, typename = impl::enable_if_random_category_t<CategoryT>>
+				friend inline JCLIB_CONSTEXPR bool operator>=(const zip_iterator& _lhs, const zip_iterator& _rhs)
+				{
+					return !(_lhs < _rhs);
+				};
+
+				JCLIB_CONSTEXPR zip_iterator() = default;
+				JCLIB_CONSTEXPR explicit zip_iterator(UnderlyingTs... _at) :
+					at_{ _at... }
+				{};
+
+			private:
+				std::tuple<UnderlyingTs...> at_;
+			};
+
+			template <typename... RangeTs>
+			struct zip_view_impl : public view_interface<zip_view_impl<RangeTs...>>
+			{
+			public:
+				using iterator = zip_iterator<iterator_t<RangeTs>...>;
+
+				JCLIB_CONSTEXPR iterator begin() const noexcept { return this->begin_; };
+				JCLIB_CONSTEXPR iterator end() const noexcept { return this->end_; };
+
+				JCLIB_CONSTEXPR explicit zip_view_impl(RangeTs&... _ranges) :
+					begin_{ ranges::begin(_ranges)... },
+					end_{ zip_view_impl::make_end(jc::bool_constant<std::is_same<typename iterator::iterator_category, std::random_access_iterator_tag>::value>{}, _ranges...) }
+				{};
+
+			private:
+
+				/**
+				 * @brief With random access every range ends at the length of the shortest, so iterators can be
+				 * compared and subtracted using any of the wrapped iterators
+				*/
+				static JCLIB_CONSTEXPR iterator make_end(jc::true_type, RangeTs&... _ranges)
+				{
+					const std::ptrdiff_t _lengths[]{ static_cast<std::ptrdiff_t>(ranges::end(_ranges) - ranges::begin(_ranges))... };
+					const auto _length = *std::min_element(std::begin(_lengths), std::end(_lengths));
+					return iterator{ (ranges::begin(_ranges) + _length)... };
+				};
+				static JCLIB_CONSTEXPR iterator make_end(jc::false_type, RangeTs&... _ranges)
+				{
+					return iterator{ ranges::end(_ranges)... };
+				};
+
+				iterator begin_;
+				iterator end_;
+			};
+		};
+
+		template <typename... RangeTs>
+		struct zip_view :
+			public impl::zip_view_impl<RangeTs...>
+		{
+		private:
+			using parent_type = impl::zip_view_impl<RangeTs...>;
+		public:
+			using parent_type::parent_type;
+			using parent_type::operator=;
+		};
+	};
+
+	namespace views
+	{
+		namespace impl
+		{
+			struct zip_t
+			{
+				template <typename... RangeTs>
+				constexpr auto operator()(RangeTs&&... _ranges) const -> ranges::zip_view<remove_reference_t<RangeTs>...>
+				{
+					return ranges::zip_view<remove_reference_t<RangeTs>...>(_ranges...);
+				};
+			};
+		};
+
+		/**
+		 * @brief Views several ranges at once as tuples of their elements, ends with the shortest range
+		*/
+		constexpr static impl::zip_t zip{};
+	};
+};
+
+#pragma endregion ZIP_VIEW
+
+
+
+/*
+	Join view
+*/
+
+#pragma region JOIN_VIEW
+
+namespace jc
+{
+	namespace ranges
+	{
+		namespace impl
+		{
+			/**
+			 * @brief Iterator flattening a range of ranges, empty inner ranges are skipped
+			 * @tparam OuterT Iterator into the range of ranges
+			*/
+			template <typename OuterT>
+			struct join_iterator
+			{
+			private:
+				using inner_range = decltype(*std::declval<const OuterT&>());
+				using inner_iterator = iterator_t<jc::remove_reference_t<inner_range>>;
+
+				static_assert(is_borrowed_range<inner_range>::value || is_borrowed_range<jc::remove_cvref_t<inner_range>>::value,
+					"join view inner ranges must be references or views which don't own their elements");
+
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using difference_type = std::ptrdiff_t;
+				using reference = decltype(*std::declval<const inner_iterator&>());
+				using value_type = jc::remove_cvref_t<reference>;
+				using pointer = std::add_pointer_t<std::remove_reference_t<reference>>;
+
+			private:
+
+				/**
+				 * @brief Moves to the first element of the next non-empty inner range, starting with the current one
+				*/
+				JCLIB_CONSTEXPR void satisfy()
+				{
+					for (; this->outer_ != this->outer_end_; ++this->outer_)
+					{
+						auto&& _inner = *this->outer_;
+						this->inner_ = ranges::begin(_inner);
+						this->inner_end_ = ranges::end(_inner);
+						if (this->inner_ != this->inner_end_)
+						{
+							return;
+						};
+					};
+				};
+
+			public:
+				friend inline JCLIB_CONSTEXPR bool operator==(const join_iterator& _lhs, const join_iterator& _rhs)
+				{
+					return _lhs.outer_ == _rhs.outer_ && (_lhs.outer_ == _lhs.outer_end_ || _lhs.inner_ == _rhs.inner_);
+				};
+				friend inline JCLIB_CONSTEXPR bool operator!=(const join_iterator& _lhs, const join_iterator& _rhs)
+				{
+					return !(_lhs == _rhs);
+				};
+
+				JCLIB_CONSTEXPR reference operator*() const
+				{
+					return *this->inner_;
+				};
+				JCLIB_CONSTEXPR pointer operator->() const
+				{
+					return std::addressof(*this->inner_);
+				};
+
+				JCLIB_CONSTEXPR join_iterator& operator++()
+				{
+					++this->inner_;
+					if (this->inner_ == this->inner_end_)
+					{
+						++this->outer_;
+						this->satisfy();
+					};
+					return *this;
+				};
+				JCLIB_CONSTEXPR join_iterator operator++(int)
+				{
+					auto _out = *this;
+					++(*this);
+					return _out;
+				};
+
+				JCLIB_CONSTEXPR join_iterator() = default;
+				JCLIB_CONSTEXPR join_iterator(OuterT _outer, OuterT _outerEnd) :
+					outer_{ _outer }, outer_end_{ _outerEnd }, inner_{}, inner_end_{}
+				{
+					this->satisfy();
+				};
+
+			private:
+				OuterT outer_{};
+				OuterT outer_end_{};
+				inner_iterator inner_{};
+				inner_iterator inner_end_{};
+			};
+
+			template <typename RangeT>
+			struct join_view_impl : public view_interface<join_view_impl<RangeT>>
+			{
+			public:
+				using iterator = join_iterator<iterator_t<RangeT>>;
+
+				JCLIB_CONSTEXPR iterator begin() const { return iterator{ this->first_, this->last_ }; };
+				JCLIB_CONSTEXPR iterator end() const { return iterator{ this->last_, this->last_ }; };
+
+				JCLIB_CONSTEXPR join_view_impl(RangeT& _range) :
+					first_{ ranges::begin(_range) }, last_{ ranges::end(_range) }
+				{};
+
+			private:
+				iterator_t<RangeT> first_;
+				iterator_t<RangeT> last_;
+			};
+		};
+
+		template <typename RangeT>
+		struct join_view<RangeT, enable_if_t<jc::ranges::is_range<RangeT>::value>> :
+			public impl::join_view_impl<RangeT>
+		{
+		private:
+			using parent_type = impl::join_view_impl<RangeT>;
+		public:
+			using parent_type::parent_type;
+			using parent_type::operator=;
+		};
+
+		template <typename RangeT>
+		struct is_borrowed_range<join_view<RangeT>> : jc::true_type {};
+	};
+
+	namespace views
+	{
+		namespace impl
+		{
+			struct join_t
+			{
+				template <typename RangeT>
+				constexpr auto operator()(RangeT&& _range) const -> ranges::join_view<remove_reference_t<RangeT>>
+				{
+					return ranges::join_view<remove_reference_t<RangeT>>(_range);
+				};
+
+				template <typename RangeT>
+				constexpr friend inline auto operator|(RangeT&& _range, const join_t& _join) ->
+					ranges::join_view<remove_reference_t<RangeT>>
+				{
+					return _join(_range);
+				};
+			};
+		};
+
+		/**
+		 * @brief Views a range of ranges as one flattened range
+		*/
+		constexpr static impl::join_t join{};
+	};
+};
+
+#pragma endregion JOIN_VIEW
+
+
+
+/*
+	Range materialization
+*/
+
+#pragma region RANGES_TO
+
+namespace jc
+{
+	namespace ranges
+	{
+		namespace impl
+		{
+			/**
+			 * @brief Overloads for detecting view_interface bases
+			*/
+			template <typename T>
+			jc::true_type is_view_test(const view_interface<T>*);
+			jc::false_type is_view_test(...);
+
+			/**
+			 * @brief Checks if a type inherits from view_interface
+			*/
+			template <typename T>
+			struct is_view : decltype(impl::is_view_test(std::declval<const jc::remove_cvref_t<T>*>())) {};
+
+			/**
+			 * @brief Checks if a type has a size() member
+			*/
+			template <typename T, typename Enable = void>
+			struct has_size_member : jc::false_type {};
+			template <typename T>
+			struct has_size_member<T, jc::void_t<decltype(std::declval<const T&>().size())>> : jc::true_type {};
+
+			/**
+			 * @brief Checks if the number of elements in a range can be found without walking it.
+			 * 
+			 * This is true for random access ranges, and for ranges which aren't views but have a size() member such as
+			 * standard library containers. Views without random access only find their size by walking the range.
+			*/
+			template <typename RangeT>
+			struct is_sized_range : jc::bool_constant
+			<
+				is_random_view_iterator<iterator_t<RangeT>>::value ||
+				(has_size_member<RangeT>::value && !is_view<RangeT>::value)
+			> {};
+
+			template <typename RangeT>
+			JCLIB_CONSTEXPR inline size_t sized_range_size(RangeT& _range, jc::true_type /* random access */)
+			{
+				return static_cast<size_t>(ranges::end(_range) - ranges::begin(_range));
+			};
+			template <typename RangeT>
+			JCLIB_CONSTEXPR inline size_t sized_range_size(RangeT& _range, jc::false_type /* random access */)
+			{
+				return static_cast<size_t>(_range.size());
+			};
+
+			/**
+			 * @brief Gets the number of elements in a sized range
+			*/
+			template <typename RangeT>
+			JCLIB_CONSTEXPR inline size_t sized_range_size(RangeT& _range)
+			{
+				return impl::sized_range_size(_range, jc::bool_constant<is_random_view_iterator<iterator_t<RangeT>>::value>{});
+			};
+
+			/**
+			 * @brief Checks if a container can reserve space for a number of elements
+			*/
+			template <typename ContainerT, typename Enable = void>
+			struct has_reserve : jc::false_type {};
+			template <typename ContainerT>
+			struct has_reserve<ContainerT, jc::void_t<decltype(std::declval<ContainerT&>().reserve(size_t{}))>> : jc::true_type {};
+
+			/**
+			 * @brief Gets a pointer to the elements of a range if its data() member returns one, otherwise void
+			*/
+			template <typename RangeT, typename Enable = void>
+			struct range_data_pointer { using type = void; };
+			template <typename RangeT>
+			struct range_data_pointer<RangeT, jc::enable_if_t<std::is_pointer<decltype(std::declval<RangeT&>().data())>::value>>
+			{
+				using type = decltype(std::declval<RangeT&>().data());
+			};
+
+			/**
+			 * @brief Checks if a container can be constructed by copying the bytes of a range's elements in one go.
+			 * 
+			 * The range must have random access and a data() member returning a pointer to elements of the container's
+			 * value type, which must be trivially copyable, and the container must be constructible from a pointer pair.
+			*/
+			template <typename ContainerT, typename RangeT, typename Enable = void>
+			struct is_bulk_copyable : jc::false_type {};
+			template <typename ContainerT, typename RangeT>
+			struct is_bulk_copyable<ContainerT, RangeT, jc::enable_if_t<
+				!std::is_void<typename range_data_pointer<RangeT>::type>::value
+			>> : jc::bool_constant
+			<
+				is_random_view_iterator<iterator_t<RangeT>>::value &&
+				jc::is_same<jc::remove_cv_t<std::remove_pointer_t<typename range_data_pointer<RangeT>::type>>, typename ContainerT::value_type>::value &&
+				std::is_trivially_copyable<typename ContainerT::value_type>::value &&
+				std::is_constructible<ContainerT, typename range_data_pointer<RangeT>::type, typename range_data_pointer<RangeT>::type>::value
+			> {};
+
+			template <typename ContainerT, typename RangeT>
+			JCLIB_CONSTEXPR ContainerT to(RangeT& _range);
+
+			/**
+			 * @brief Appends an element which converts to the container's value type
+			*/
+			template <typename ContainerT, typename T>
+			JCLIB_CONSTEXPR inline void to_append(ContainerT& _out, T&& _value, jc::true_type /* converts */)
+			{
+				_out.insert(_out.end(), std::forward<T>(_value));
+			};
+
+			/**
+			 * @brief Appends an element which is a range, by materializing it as the container's value type
+			*/
+			template <typename ContainerT, typename T>
+			JCLIB_CONSTEXPR inline void to_append(ContainerT& _out, T&& _value, jc::false_type /* converts */)
+			{
+				_out.insert(_out.end(), impl::to<typename ContainerT::value_type>(_value));
+			};
+
+			template <typename ContainerT, typename T>
+			JCLIB_CONSTEXPR inline void to_append(ContainerT& _out, T&& _value)
+			{
+				impl::to_append(_out, std::forward<T>(_value),
+					jc::bool_constant<std::is_convertible<T&&, typename ContainerT::value_type>::value>{});
+			};
+
+			/**
+			 * @brief Materializes a range of unknown size element by element
+			*/
+			template <typename ContainerT, typename RangeT>
+			JCLIB_CONSTEXPR inline ContainerT to_impl(RangeT& _range, jc::false_type /* sized */, jc::false_type /* bulk */)
+			{
+				ContainerT _out{};
+				for (auto&& v : _range)
+				{
+					impl::to_append(_out, std::forward<decltype(v)>(v));
+				};
+				return _out;
+			};
+
+			/**
+			 * @brief Materializes a sized range, reserving space for every element before appending
+			*/
+			template <typename ContainerT, typename RangeT>
+			JCLIB_CONSTEXPR inline ContainerT to_impl(RangeT& _range, jc::true_type /* sized */, jc::false_type /* bulk */)
+			{
+				ContainerT _out{};
+				_out.reserve(impl::sized_range_size(_range));
+				for (auto&& v : _range)
+				{
+					impl::to_append(_out, std::forward<decltype(v)>(v));
+				};
+				return _out;
+			};
+
+			/**
+			 * @brief Materializes a contiguous range of trivially copyable elements with a single allocation and copy
+			*/
+			template <typename ContainerT, typename RangeT>
+			JCLIB_CONSTEXPR inline ContainerT to_impl(RangeT& _range, jc::true_type /* sized */, jc::true_type /* bulk */)
+			{
+				const auto _count = impl::sized_range_size(_range);
+				const auto _data = _range.data();
+				return ContainerT(_data, _data + _count);
+			};
+
+			template <typename ContainerT, typename RangeT>
+			JCLIB_CONSTEXPR inline ContainerT to(RangeT& _range)
+			{
+				using is_bulk = is_bulk_copyable<ContainerT, RangeT>;
+				using is_sized = jc::bool_constant<is_bulk::value || (is_sized_range<RangeT>::value && has_reserve<ContainerT>::value)>;
+				return impl::to_impl<ContainerT>(_range, is_sized{}, jc::bool_constant<is_bulk::value>{});
+			};
+
+			/**
+			 * @brief Pipeable adaptor for ranges::to with a given container type
+			*/
+			template <typename ContainerT>
+			struct to_t
+			{
+				template <typename RangeT>
+				JCLIB_CONSTEXPR friend inline auto operator|(RangeT&& _range, to_t) ->
+					jc::enable_if_t<is_range<jc::remove_reference_t<RangeT>>::value, ContainerT>
+				{
+					return impl::to<ContainerT>(_range);
+				};
+			};
+
+			/**
+			 * @brief Gets a container template instantiated for the elements of a range
+			*/
+			template <template <typename...> class ContainerT, typename RangeT>
+			using to_container_t = ContainerT<jc::remove_cvref_t<decltype(*ranges::begin(std::declval<RangeT&>()))>>;
+
+			/**
+			 * @brief Pipeable adaptor for ranges::to with a container template
+			*/
+			template <template <typename...> class ContainerT>
+			struct to_template_t
+			{
+				template <typename RangeT>
+				JCLIB_CONSTEXPR friend inline auto operator|(RangeT&& _range, to_template_t) ->
+					to_container_t<ContainerT, jc::remove_reference_t<RangeT>>
+				{
+					return impl::to<to_container_t<ContainerT, jc::remove_reference_t<RangeT>>>(_range);
+				};
+			};
+		};
+
+		/**
+		 * @brief Collects the elements of a range into a container.
+		 * 
+		 * Containers with reserve() allocate once when the size of the range is known without walking it, ranges of
+		 * trivially copyable elements with a data() pointer are copied in one go. Elements which are ranges themselves
+		 * are collected into the container's value type.
+		 * 
+		 * @tparam ContainerT Container type to construct
+		 * @tparam RangeT Range type to collect
+		 * @param _range Range to collect
+		 * @return Container holding the range's elements
+		*/
+		template <typename ContainerT, typename RangeT>
+		JCLIB_CONSTEXPR inline auto to(RangeT&& _range) ->
+			jc::enable_if_t<is_range<jc::remove_reference_t<RangeT>>::value, ContainerT>
+		{
+			return impl::to<ContainerT>(_range);
+		};
+
+		/**
+		 * @brief Collects the elements of a range into a container template instantiated for the range's element type
+		 * @tparam ContainerT Container template, such as std::vector
+		 * @tparam RangeT Range type to collect
+		 * @param _range Range to collect
+		 * @return Container holding the range's elements
+		*/
+		template <template <typename...> class ContainerT, typename RangeT>
+		JCLIB_CONSTEXPR inline auto to(RangeT&& _range) ->
+			jc::enable_if_t<is_range<jc::remove_reference_t<RangeT>>::value, impl::to_container_t<ContainerT, jc::remove_reference_t<RangeT>>>
+		{
+			return impl::to<impl::to_container_t<ContainerT, jc::remove_reference_t<RangeT>>>(_range);
+		};
+
+		/**
+		 * @brief Gets a pipeable adaptor collecting a range into a container
+		 * @tparam ContainerT Container type to construct
+		*/
+		template <typename ContainerT>
+		constexpr inline impl::to_t<ContainerT> to() noexcept
+		{
+			return impl::to_t<ContainerT>{};
+		};
+
+		/**
+		 * @brief Gets a pipeable adaptor collecting a range into a container template instantiated for the range's element type
+		 * @tparam ContainerT Container template, such as std::vector
+		*/
+		template <template <typename...> class ContainerT>
+		constexpr inline impl::to_template_t<ContainerT> to() noexcept
+		{
+			return impl::to_template_t<ContainerT>{};
+		};
+	};
+};
+
+#pragma endregion RANGES_TO
+
+
+
+/*
+	Pipeline chunking, lets parallel algorithms split views without random access
+*/
+
+#pragma region PIPELINE_CHUNKING
+
+namespace jc
+{
+	namespace ranges
+	{
+		namespace impl
+		{
+			/**
+			 * @brief Random access iterators are split directly
+			*/
+			template <typename IterT>
+			struct iterator_chunker<IterT, enable_if_t<is_random_view_iterator<IterT>::value>>
+			{
+				/**
+				 * @brief Gets the number of underlying elements between two iterators
+				*/
+				static size_t size(const IterT& _begin, const IterT& _end)
+				{
+					return static_cast<size_t>(_end - _begin);
+				};
+
+				/**
+				 * @brief Gets iterators over the underlying elements [_first, _last) of a range
+				*/
+				static std::pair<IterT, IterT> chunk(const IterT& _begin, const IterT&, size_t _first, size_t _last)
+				{
+					using difference_type = jc::difference_type_t<IterT>;
+					return { _begin + static_cast<difference_type>(_first), _begin + static_cast<difference_type>(_last) };
+				};
+			};
+
+			/**
+			 * @brief Checks if the iterators of a view can be split by position in the random access range underneath
+			*/
+			template <typename IterT, typename Enable = void>
+			struct is_chunkable_iterator : jc::false_type {};
+			template <typename IterT>
+			struct is_chunkable_iterator<IterT, jc::void_t<decltype(iterator_chunker<IterT>::size(std::declval<const IterT&>(), std::declval<const IterT&>()))>> :
+				jc::true_type
+			{};
+
+			/**
+			 * @brief Filter iterators over a chunkable iterator are split by chunking the underlying iterators, each chunk
+			 * only visits the passing elements within it
+			*/
+			template <typename UnderlyingT, typename OpT>
+			struct iterator_chunker<condition_iterator<UnderlyingT, OpT>, enable_if_t<is_chunkable_iterator<UnderlyingT>::value>>
+			{
+			private:
+				using iterator = condition_iterator<UnderlyingT, OpT>;
+				using underlying_chunker = iterator_chunker<UnderlyingT>;
+
+			public:
+				static size_t size(const iterator& _begin, const iterator& _end)
+				{
+					return underlying_chunker::size(_begin.at_, _end.at_);
+				};
+				static std::pair<iterator, iterator> chunk(const iterator& _begin, const iterator& _end, size_t _first, size_t _last)
+				{
+					const auto _chunk = underlying_chunker::chunk(_begin.at_, _end.at_, _first, _last);
+					return
+					{
+						iterator{ _chunk.first, _chunk.second, *_begin.op_ },
+						iterator{ _chunk.second, _chunk.second, *_begin.op_, condition_positioned_t{} }
+					};
+				};
+			};
+
+			/**
+			 * @brief Transform iterators over a chunkable iterator without random access are split by chunking the
+			 * underlying iterators
+			*/
+			template <typename UnderlyingT, typename OpT>
+			struct iterator_chunker<transform_iterator<UnderlyingT, OpT>, enable_if_t<
+				!is_random_view_iterator<UnderlyingT>::value && is_chunkable_iterator<UnderlyingT>::value
+			>>
+			{
+			private:
+				using iterator = transform_iterator<UnderlyingT, OpT>;
+				using underlying_chunker = iterator_chunker<UnderlyingT>;
+
+			public:
+				static size_t size(const iterator& _begin, const iterator& _end)
+				{
+					return underlying_chunker::size(_begin.at_, _end.at_);
+				};
+				static std::pair<iterator, iterator> chunk(const iterator& _begin, const iterator& _end, size_t _first, size_t _last)
+				{
+					const auto _chunk = underlying_chunker::chunk(_begin.at_, _end.at_, _first, _last);
+					return { iterator{ _chunk.first, *_begin.op_ }, iterator{ _chunk.second, *_begin.op_ } };
+				};
+			};
+
+			/**
+			 * @brief Checks if a range is a view pipeline without random access, such as a filter view, over a random
+			 * access range. Parallel algorithms split these by position in the underlying range, each chunk runs the
+			 * pipeline over its own part of the underlying range.
+			*/
+			template <typename RangeT>
+			struct is_chunkable_pipeline : jc::bool_constant
+			<
+				is_chunkable_iterator<iterator_t<RangeT>>::value && !is_random_view_iterator<iterator_t<RangeT>>::value
+			> {};
+		};
+	};
+};
+
+#pragma endregion PIPELINE_CHUNKING
+
+
+
 #endif
\ No newline at end of file
@@ -0,0 +1,457 @@
+#pragma once
+#ifndef JCLIB_SIGNAL_H
+#define JCLIB_SIGNAL_H
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	jc::signal<> is a multicast delegate, invoking it calls every connected listener.
+
+	Listeners are held in a single contiguous array of jc::unique_functor<>, so small listeners are never individually
+	allocated. Connecting returns a jc::signal_connection handle that can be used to disconnect the listener in constant time.
+	
+	Listeners may connect or disconnect (including themselves) while the signal is being invoked, these changes are applied
+	once the outermost invocation has finished. Listeners connected during an invocation are not called by it, and listeners
+	disconnected during an invocation will not be called by it afterwards.
+
+	Every function locks the signal's (recursive) mutex by default, the jc::nolock overloads can be used instead when the
+	signal is only ever accessed from a single thread.
+
+	Example Code:
+
+	#include "jclib/signal.h"
+	#include <iostream>
+
+	int main()
+	{
+		jc::signal<void(int)> _signal{};
+		const auto _connection = _signal.connect([](int _value) { std::cout << _value << '\n'; });
+		_signal(2);
+		_signal.disconnect(_connection);
+		_signal(3);
+		return 0;
+	};
+*/
+
+#include "jclib/config.h"
+#include "jclib/functor.h"
+#include "jclib/thread.h"
+
+#define _JCLIB_SIGNAL_
+
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <utility>
+
+namespace jc
+{
+	/**
+	 * @brief Handle to a listener connected to a signal
+	*/
+	struct signal_connection
+	{
+	public:
+		using index_type = uint32_t;
+		using generation_type = uint32_t;
+
+		/**
+		 * @brief Index of the listener within the signal
+		*/
+		index_type index = 0;
+
+		/**
+		 * @brief Generation of the listener's slot, used to detect handles to disconnected listeners
+		*/
+		generation_type generation = 0;
+	};
+
+	JCLIB_CONSTEXPR inline bool operator==(const signal_connection& lhs, const signal_connection& rhs) noexcept
+	{
+		return lhs.index == rhs.index && lhs.generation == rhs.generation;
+	};
+	JCLIB_CONSTEXPR inline bool operator!=(const signal_connection& lhs, const signal_connection& rhs) noexcept
+	{
+		return !(lhs == rhs);
+	};
+
+	/**
+	 * @brief Multicast delegate that invokes every connected listener matching its signature
+	*/
+	template <typename T>
+	struct signal;
+
+	/**
+	 * @brief Multicast delegate that invokes every connected listener matching its signature
+	 * @tparam ...ArgTs Listener arguement types
+	*/
+	template <typename... ArgTs>
+	struct signal<void(ArgTs...)>
+	{
+	public:
+
+		/**
+		 * @brief Function object type used to hold listeners
+		*/
+		using function_type = jc::unique_functor<void(ArgTs...)>;
+
+		/**
+		 * @brief Handle type returned by connect()
+		*/
+		using connection = signal_connection;
+
+		using size_type = size_t;
+
+		/**
+		 * @brief Mutex type locked by the locking overloads
+		*/
+		using mutex_type = std::recursive_mutex;
+
+	private:
+		using index_type = typename connection::index_type;
+		using generation_type = typename connection::generation_type;
+
+		/**
+		 * @brief Storage for a single listener
+		*/
+		struct slot
+		{
+			function_type function;
+			generation_type generation = 0;
+			bool connected = false;
+		};
+
+		/**
+		 * @brief Tracks invocation depth so that changes made by listeners are deferred until the outermost invocation ends
+		*/
+		struct invoke_scope
+		{
+		public:
+			explicit invoke_scope(signal& _signal) noexcept :
+				signal_{ &_signal }
+			{
+				++this->signal_->depth_;
+			};
+
+			invoke_scope(const invoke_scope& other) = delete;
+			invoke_scope& operator=(const invoke_scope& other) = delete;
+
+			~invoke_scope()
+			{
+				if (--this->signal_->depth_ == 0)
+				{
+					this->signal_->apply_deferred();
+				};
+			};
+
+		private:
+			signal* signal_;
+		};
+
+		JCLIB_CONSTEXPR bool is_invoking() const noexcept
+		{
+			return this->depth_ != 0;
+		};
+
+		/**
+		 * @brief Gets the slot a connection refers to, including connections deferred during invocation
+		 * @return Pointer to the slot, or nullptr if the index is out of range
+		*/
+		slot* find_slot(const connection& _connection) noexcept
+		{
+			const size_t _index = static_cast<size_t>(_connection.index);
+			if (_index < this->slots_.size())
+			{
+				return &this->slots_[_index];
+			}
+			else if (_index - this->slots_.size() < this->pending_.size())
+			{
+				return &this->pending_[_index - this->slots_.size()];
+			}
+			else
+			{
+				return nullptr;
+			};
+		};
+		const slot* find_slot(const connection& _connection) const noexcept
+		{
+			return const_cast<signal*>(this)->find_slot(_connection);
+		};
+
+		/**
+		 * @brief Destroys a disconnected slot's listener and allows the slot to be reused
+		*/
+		void release_slot(index_type _index)
+		{
+			this->slots_[_index].function.reset();
+			this->free_.push_back(_index);
+		};
+
+		/**
+		 * @brief Applies the connections and disconnections made during invocation
+		*/
+		void apply_deferred()
+		{
+			for (auto& _slot : this->pending_)
+			{
+				this->slots_.push_back(std::move(_slot));
+			};
+			this->pending_.clear();
+			
+			for (auto& _index : this->graveyard_)
+			{
+				this->release_slot(_index);
+			};
+			this->graveyard_.clear();
+		};
+
+	public:
+
+		/**
+		 * @brief Connects a listener without locking the signal's mutex
+		 * @param _function Listener to connect, must be invocable with the signal's arguements
+		 * @return Connection handle used to disconnect the listener
+		*/
+		template <typename OpT>
+		connection connect(nolock_t, OpT&& _function)
+		{
+			function_type _listener{ std::forward<OpT>(_function) };
+			JCLIB_ASSERT(_listener.good());
+
+			++this->count_;
+			if (!this->is_invoking() && !this->free_.empty())
+			{
+				// Reuse a disconnected slot
+				const index_type _index = this->free_.back();
+				this->free_.pop_back();
+
+				auto& _slot = this->slots_[_index];
+				_slot.function = std::move(_listener);
+				_slot.connected = true;
+				return connection{ _index, _slot.generation };
+			}
+			else
+			{
+				// New slots made during invocation are deferred so that the array is not resized while invoking
+				auto& _slots = (this->is_invoking()) ? this->pending_ : this->slots_;
+				const auto _index = static_cast<index_type>(this->slots_.size() + this->pending_.size());
+				_slots.push_back(slot{ std::move(_listener), 0, true });
+				return connection{ _index, 0 };
+			};
+		};
+
+		/**
+		 * @brief Connects a listener
+		 * @param _function Listener to connect, must be invocable with the signal's arguements
+		 * @return Connection handle used to disconnect the listener
+		*/
+		template <typename OpT>
+		connection connect(OpT&& _function)
+		{
+			std::unique_lock<mutex_type> _lock{ this->mtx_ };
+			return this->connect(nolock, std::forward<OpT>(_function));
+		};
+
+		/**
+		 * @brief Disconnects a listener without locking the signal's mutex, does nothing if it was already disconnected
+		 * @param _connection Handle returned by connect()
+		 * @return True if the listener was disconnected, false if it was not connected
+		*/
+		bool disconnect(nolock_t, const connection& _connection)
+		{
+			slot* _slot = this->find_slot(_connection);
+			if (!_slot || !_slot->connected || _slot->generation != _connection.generation)
+			{
+				return false;
+			};
+
+			_slot->connected = false;
+			++_slot->generation;
+			--this->count_;
+
+			// A listener may be running (or be about to run) while invoking, so it must not be destroyed yet
+			if (this->is_invoking())
+			{
+				this->graveyard_.push_back(_connection.index);
+			}
+			else
+			{
+				this->release_slot(_connection.index);
+			};
+			return true;
+		};
+
+		/**
+		 * @brief Disconnects a listener, does nothing if it was already disconnected
+		 * @param _connection Handle returned by connect()
+		 * @return True if the listener was disconnected, false if it was not connected
+		*/
+		bool disconnect(const connection& _connection)
+		{
+			std::unique_lock<mutex_type> _lock{ this->mtx_ };
+			return this->disconnect(nolock, _connection);
+		};
+
+		/**
+		 * @brief Checks if a listener is still connected without locking the signal's mutex
+		 * @param _connection Handle returned by connect()
+		*/
+		bool connected(nolock_t, const connection& _connection) const noexcept
+		{
+			const slot* _slot = this->find_slot(_connection);
+			return _slot && _slot->connected && _slot->generation == _connection.generation;
+		};
+
+		/**
+		 * @brief Checks if a listener is still connected
+		 * @param _connection Handle returned by connect()
+		*/
+		bool connected(const connection& _connection) const
+		{
+			std::unique_lock<mutex_type> _lock{ this->mtx_ };
+			return this->connected(nolock, _connection);
+		};
+
+		/**
+		 * @brief Disconnects every listener without locking the signal's mutex
+		*/
+		void clear(nolock_t)
+		{
+			const auto _count = static_cast<index_type>(this->slots_.size() + this->pending_.size());
+			for (index_type n = 0; n != _count; ++n)
+			{
+				const slot* _slot = this->find_slot(connection{ n, 0 });
+				if (_slot->connected)
+				{
+					this->disconnect(nolock, connection{ n, _slot->generation });
+				};
+			};
+		};
+
+		/**
+		 * @brief Disconnects every listener
+		*/
+		void clear()
+		{
+			std::unique_lock<mutex_type> _lock{ this->mtx_ };
+			this->clear(nolock);
+		};
+
+		/**
+		 * @brief Gets the number of connected listeners
+		*/
+		size_type size(nolock_t) const noexcept
+		{
+			return this->count_;
+		};
+
+		/**
+		 * @brief Gets the number of connected listeners
+		*/
+		size_type size() const
+		{
+			std::unique_lock<mutex_type> _lock{ this->mtx_ };
+			return this->size(nolock);
+		};
+
+		/**
+		 * @brief Returns true if no listeners are connected
+		*/
+		bool empty(nolock_t) const noexcept
+		{
+			return this->size(nolock) == 0;
+		};
+
+		/**
+		 * @brief Returns true if no listeners are connected
+		*/
+		bool empty() const
+		{
+			return this->size() == 0;
+		};
+
+		/**
+		 * @brief Invokes every connected listener without locking the signal's mutex
+		 * @param _args Arguements to invoke the listeners with
+		*/
+		void invoke(nolock_t, ArgTs... _args)
+		{
+			const invoke_scope _scope{ *this };
+
+			// Only listeners connected before invoking are called
+			const size_t _count = this->slots_.size();
+			for (size_t n = 0; n != _count; ++n)
+			{
+				const auto& _slot = this->slots_[n];
+				if (_slot.connected)
+				{
+					_slot.function(_args...);
+				};
+			};
+		};
+
+		/**
+		 * @brief Invokes every connected listener
+		 * @param _args Arguements to invoke the listeners with
+		*/
+		void invoke(ArgTs... _args)
+		{
+			std::unique_lock<mutex_type> _lock{ this->mtx_ };
+			this->invoke(nolock, _args...);
+		};
+
+		/**
+		 * @brief Same as invoke(nolock, ...)
+		*/
+		void operator()(nolock_t, ArgTs... _args)
+		{
+			this->invoke(nolock, _args...);
+		};
+
+		/**
+		 * @brief Same as invoke()
+		*/
+		void operator()(ArgTs... _args)
+		{
+			this->invoke(_args...);
+		};
+
+		signal() = default;
+
+		// Listeners may hold pointers to their signal, so signals cannot be copied or moved
+		signal(const signal& other) = delete;
+		signal& operator=(const signal& other) = delete;
+		signal(signal&& other) = delete;
+		signal& operator=(signal&& other) = delete;
+
+	private:
+		std::vector<slot> slots_{};
+		
+		// Slots connected during invocation
+		std::vector<slot> pending_{};
+
+		// Indices of reusable slots
+		std::vector<index_type> free_{};
+
+		// Indices of slots disconnected during invocation
+		std::vector<index_type> graveyard_{};
+
+		size_type count_ = 0;
+		size_type depth_ = 0;
+		
+		mutable mutex_type mtx_{};
+	};
+};
+
+#endif
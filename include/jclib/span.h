@@ -16,7 +16,8 @@
 */
 
 /*
-	Implements a simple C++20-ish span type for referring to contiguous ranges.
+	Implements a simple C++20-ish span type for referring to contiguous ranges, along with views::split which
+	views a contiguous range as spans separated by a delimiter.
 */
 
 #include <jclib/ranges.h>
@@ -25,6 +26,9 @@
 #include <array>
 #include <limits>
 #include <iterator>
+#include <vector>
+#include <algorithm>
+#include <cstring>
 
 #if JCLIB_FEATURE_SPAN_V
 // Include standard span if available
@@ -832,6 +836,408 @@ namespace jc
 
 #endif
 
+	namespace ranges
+	{
+		/**
+		 * @brief Iterators into a span point at the viewed elements
+		*/
+		template <typename T, size_t Extent>
+		struct is_borrowed_range<span<T, Extent>> : jc::true_type {};
+
+		namespace impl
+		{
+			/**
+			 * @brief Checks if an element type can be searched for with memchr
+			*/
+			template <typename E>
+			struct is_memchr_searchable : jc::bool_constant
+			<
+				sizeof(E) == 1 && (std::is_integral<E>::value || std::is_enum<E>::value)
+			> {};
+
+			/**
+			 * @brief Finds an element in an array using memchr
+			*/
+			template <typename E>
+			inline E* split_find(E* _begin, E* _end, const jc::remove_cv_t<E>& _value, jc::true_type) noexcept
+			{
+				if (_begin == _end)
+				{
+					return _end;
+				};
+
+				unsigned char _byte{};
+				std::memcpy(&_byte, &_value, sizeof(_byte));
+				const auto _at = std::memchr(_begin, _byte, static_cast<size_t>(_end - _begin));
+				return (_at) ? _begin + (static_cast<const unsigned char*>(_at) - reinterpret_cast<const unsigned char*>(_begin)) : _end;
+			};
+
+			/**
+			 * @brief Finds an element in an array by comparing each element
+			*/
+			template <typename E>
+			inline E* split_find(E* _begin, E* _end, const jc::remove_cv_t<E>& _value, jc::false_type)
+			{
+				return std::find(_begin, _end, _value);
+			};
+
+			template <typename E>
+			inline E* split_find(E* _begin, E* _end, const jc::remove_cv_t<E>& _value)
+			{
+				return impl::split_find(_begin, _end, _value, jc::bool_constant<is_memchr_searchable<jc::remove_cv_t<E>>::value>{});
+			};
+
+			/**
+			 * @brief Split delimiter matching a single element
+			*/
+			template <typename E>
+			struct split_element_delimiter
+			{
+				/**
+				 * @brief Finds the next delimiter
+				 * @return Pointer to the first element of the delimiter, or the end if there are none
+				*/
+				E* find(E* _begin, E* _end) const
+				{
+					return impl::split_find(_begin, _end, this->value);
+				};
+
+				/**
+				 * @brief Gets the number of elements in the delimiter
+				*/
+				constexpr size_t size() const noexcept { return 1; };
+
+				jc::remove_cv_t<E> value;
+			};
+
+			/**
+			 * @brief Split delimiter matching a sequence of elements, candidates are found by searching for the first
+			 * element of the sequence
+			*/
+			template <typename E>
+			struct split_pattern_delimiter
+			{
+				/**
+				 * @brief Finds the next delimiter
+				 * @return Pointer to the first element of the delimiter, or the end if there are none
+				*/
+				E* find(E* _begin, E* const _end) const
+				{
+					const size_t _size = this->size();
+					while (static_cast<size_t>(_end - _begin) >= _size)
+					{
+						_begin = impl::split_find(_begin, _end - (_size - 1), this->value.front());
+						if (_begin == _end - (_size - 1))
+						{
+							break;
+						}
+						else if (std::equal(this->value.begin() + 1, this->value.end(), _begin + 1))
+						{
+							return _begin;
+						};
+						++_begin;
+					};
+					return _end;
+				};
+
+				/**
+				 * @brief Gets the number of elements in the delimiter
+				*/
+				size_t size() const noexcept { return this->value.size(); };
+
+				std::vector<jc::remove_cv_t<E>> value;
+			};
+
+			/**
+			 * @brief Iterator over the subranges between delimiters, refers to its split view for the delimiter
+			 * @tparam ViewT Split view type
+			 * @tparam E Element type, may be const
+			*/
+			template <typename ViewT, typename E>
+			struct split_iterator
+			{
+			public:
+				using iterator_category = std::forward_iterator_tag;
+				using difference_type = std::ptrdiff_t;
+				using value_type = jc::span<E>;
+				using reference = value_type;
+				using pointer = void;
+
+				friend inline bool operator==(const split_iterator& _lhs, const split_iterator& _rhs) noexcept
+				{
+					return _lhs.at_ == _rhs.at_ && _lhs.trailing_ == _rhs.trailing_;
+				};
+				friend inline bool operator!=(const split_iterator& _lhs, const split_iterator& _rhs) noexcept
+				{
+					return !(_lhs == _rhs);
+				};
+
+				reference operator*() const noexcept
+				{
+					return (this->at_ == this->field_end_) ?
+						value_type{} :
+						value_type{ this->at_, static_cast<size_t>(this->field_end_ - this->at_) };
+				};
+
+				split_iterator& operator++()
+				{
+					const auto _end = this->view_->last_;
+					if (this->field_end_ == _end)
+					{
+						// Past the last subrange
+						this->at_ = _end;
+						this->trailing_ = false;
+					}
+					else
+					{
+						this->at_ = this->field_end_ + this->view_->delimiter_.size();
+						this->trailing_ = (this->at_ == _end);
+						this->field_end_ = (this->trailing_) ? _end : this->view_->delimiter_.find(this->at_, _end);
+					};
+					return *this;
+				};
+				split_iterator operator++(int)
+				{
+					auto _out = *this;
+					++(*this);
+					return _out;
+				};
+
+				split_iterator() = default;
+
+				/**
+				 * @brief Constructs an iterator to the first subrange starting at an element
+				*/
+				split_iterator(const ViewT* _view, E* _at) :
+					view_{ _view }, at_{ _at },
+					field_end_{ (_at == _view->last_) ? _at : _view->delimiter_.find(_at, _view->last_) }
+				{};
+
+			private:
+				const ViewT* view_ = nullptr;
+				E* at_ = nullptr;
+				E* field_end_ = nullptr;
+
+				/**
+				 * @brief True for the empty subrange following a delimiter at the end of the range
+				*/
+				bool trailing_ = false;
+			};
+
+			/**
+			 * @brief Views a contiguous range as the spans between delimiters, iterators refer to the view
+			 * @tparam E Element type, may be const
+			 * @tparam DelimiterT Split delimiter type
+			*/
+			template <typename E, typename DelimiterT>
+			struct split_view_impl : public view_interface<split_view_impl<E, DelimiterT>>
+			{
+			public:
+				using iterator = split_iterator<split_view_impl, E>;
+
+				iterator begin() const { return iterator{ this, this->first_ }; };
+				iterator end() const { return iterator{ this, this->last_ }; };
+
+				split_view_impl(jc::span<E> _range, DelimiterT _delimiter) :
+					first_{ _range.data() }, last_{ _range.data() + _range.size() }, delimiter_{ std::move(_delimiter) }
+				{
+					JCLIB_ASSERT(this->delimiter_.size() != 0);
+				};
+
+			private:
+				friend iterator;
+
+				E* first_;
+				E* last_;
+				DelimiterT delimiter_;
+			};
+		};
+
+		/**
+		 * @brief View into a contiguous range as the spans between delimiters.
+		 * 
+		 * Adjacent delimiters produce empty spans, as does a delimiter at the end of the range. An empty range has no
+		 * spans. Iterators refer to the view so it must outlive them.
+		 * 
+		 * @tparam E Element type, may be const
+		 * @tparam DelimiterT Split delimiter type
+		*/
+		template <typename E, typename DelimiterT>
+		struct split_view : public impl::split_view_impl<E, DelimiterT>
+		{
+		private:
+			using parent_type = impl::split_view_impl<E, DelimiterT>;
+		public:
+			using parent_type::parent_type;
+		};
+	};
+
+	namespace views
+	{
+		namespace impl
+		{
+			/**
+			 * @brief Gets the element type of a contiguous range including its constness
+			*/
+			template <typename RangeT>
+			using split_element_t = jc::remove_reference_t<decltype(*jc::begin(std::declval<RangeT&>()))>;
+
+			/**
+			 * @brief Views a contiguous range as a span, avoids dereferencing the begin iterator of an empty range
+			*/
+			template <typename RangeT>
+			inline jc::span<split_element_t<RangeT>> split_span(RangeT& _range)
+			{
+				using span_type = jc::span<split_element_t<RangeT>>;
+				return (jc::begin(_range) == jc::end(_range)) ? span_type{} : span_type{ _range };
+			};
+
+			/**
+			 * @brief Split adaptor for a single element delimiter
+			*/
+			template <typename T>
+			struct split_element_impl_t
+			{
+				template <typename RangeT, typename E = split_element_t<RangeT>>
+				friend inline auto operator|(RangeT&& _range, const split_element_impl_t& _split) ->
+					ranges::split_view<E, ranges::impl::split_element_delimiter<E>>
+				{
+					return ranges::split_view<E, ranges::impl::split_element_delimiter<E>>
+					{
+						impl::split_span(_range), ranges::impl::split_element_delimiter<E>{ static_cast<jc::remove_cv_t<E>>(_split.value) }
+					};
+				};
+
+				T value;
+			};
+
+			/**
+			 * @brief Split adaptor for a delimiter made of a range of elements
+			*/
+			template <typename T>
+			struct split_pattern_impl_t
+			{
+				template <typename RangeT, typename E = split_element_t<RangeT>>
+				friend inline auto operator|(RangeT&& _range, const split_pattern_impl_t& _split) ->
+					ranges::split_view<E, ranges::impl::split_pattern_delimiter<E>>
+				{
+					return ranges::split_view<E, ranges::impl::split_pattern_delimiter<E>>
+					{
+						impl::split_span(_range),
+						ranges::impl::split_pattern_delimiter<E>{ std::vector<jc::remove_cv_t<E>>(_split.value.begin(), _split.value.end()) }
+					};
+				};
+
+				std::vector<T> value;
+			};
+
+			struct split_t
+			{
+				/**
+				 * @brief Splits on a single element
+				*/
+				template <typename T, typename = jc::enable_if_t<!ranges::is_range<T>::value>>
+				constexpr split_element_impl_t<T> operator()(const T& _delimiter) const
+				{
+					return split_element_impl_t<T>{ _delimiter };
+				};
+
+				/**
+				 * @brief Splits on a sequence of elements, single element sequences are searched the same as an element
+				*/
+				template <typename DelimiterT, typename = jc::enable_if_t<ranges::is_range<DelimiterT>::value>>
+				auto operator()(const DelimiterT& _delimiter) const ->
+					split_pattern_impl_t<jc::remove_cvref_t<ranges::value_t<const DelimiterT>>>
+				{
+					using value_type = jc::remove_cvref_t<ranges::value_t<const DelimiterT>>;
+					return split_pattern_impl_t<value_type>{ std::vector<value_type>(jc::begin(_delimiter), jc::end(_delimiter)) };
+				};
+
+				/**
+				 * @brief Splits on a string literal, the null terminator is not part of the delimiter
+				*/
+				template <typename CharT, size_t N, typename = jc::enable_if_t<jc::is_character<CharT>::value>>
+				auto operator()(const CharT(&_delimiter)[N]) const -> split_pattern_impl_t<CharT>
+				{
+					static_assert(N > 1, "split delimiter must not be empty");
+					return split_pattern_impl_t<CharT>{ std::vector<CharT>(_delimiter, _delimiter + (N - 1)) };
+				};
+
+				template <typename RangeT, typename DelimiterT>
+				auto operator()(RangeT&& _range, const DelimiterT& _delimiter) const
+				{
+					return _range | (*this)(_delimiter);
+				};
+			};
+		};
+
+		/**
+		 * @brief Views a contiguous range as the spans between delimiters, without copying the elements.
+		 * 
+		 * The delimiter is either a single element, a range of elements or a string literal. Ranges of single byte
+		 * integers are searched with memchr.
+		*/
+		constexpr static impl::split_t split{};
+	};
+
+	namespace impl
+	{
+		/**
+		 * @brief Checks if the elements of a span can be hashed as a single block of bytes, requires that
+		 * equal values always have identical object representations.
+		 * @tparam T Span element type.
+		*/
+		template <typename T>
+		struct is_span_bytes_hashable : jc::bool_constant<
+#if JCLIB_FEATURE_HAS_UNIQUE_OBJECT_REPRESENTATIONS_V
+			std::has_unique_object_representations<T>::value
+#else
+			std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value
+#endif
+		> {};
+	};
+
+	/**
+	 * @brief Hashes the elements of a span in order.
+	 * 
+	 * Spans of trivially copyable types without padding or alternate value representations are hashed
+	 * as one contiguous block of bytes, other types are hashed element by element.
+	 * 
+	 * @tparam T Type held by span.
+	 * @tparam Extent Extent of the span.
+	*/
+	template <typename T, size_t Extent>
+	struct hash_traits<span<T, Extent>>
+	{
+	private:
+		using element_type = jc::remove_cv_t<T>;
+		using is_bytes_hashable = impl::is_span_bytes_hashable<element_type>;
+
+		template <typename EngineT>
+		static size_t hash_impl(const span<T, Extent>& _value, uint64_t _seed, jc::true_type) noexcept
+		{
+			return static_cast<size_t>(EngineT::hash_bytes(_value.data(), _value.size_bytes(), _seed));
+		};
+
+		template <typename EngineT>
+		static size_t hash_impl(const span<T, Extent>& _value, uint64_t _seed, jc::false_type)
+		{
+			uint64_t _state = EngineT::hash_integer(static_cast<uint64_t>(_value.size()), _seed);
+			for (auto& v : _value)
+			{
+				_state = impl::hash_fold<EngineT>(_state, impl::hash_value<EngineT>(v, _seed));
+			};
+			return static_cast<size_t>(_state);
+		};
+
+	public:
+		template <typename EngineT>
+		static auto hash(const span<T, Extent>& _value, uint64_t _seed) ->
+			jc::enable_if_t<is_bytes_hashable::value || impl::is_hashable<EngineT, element_type>::value, size_t>
+		{
+			return hash_impl<EngineT>(_value, _seed, jc::bool_constant<is_bytes_hashable::value>{});
+		};
+	};
 
 };
 
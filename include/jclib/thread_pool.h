@@ -0,0 +1,322 @@
+#pragma once
+#ifndef JCLIB_THREAD_POOL_H
+#define JCLIB_THREAD_POOL_H
+
+/*
+	Copyright 2021 Jonathan Cline
+	Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+	(the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge,
+	publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do
+	so, subject to the following conditions:
+	The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+	THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+	WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+	COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+	OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+	Provides a fixed size pool of worker threads used to run the parallel versions of jclib algorithms.
+
+	Tasks are queued with submit() and run by the first free worker. for_each_index() splits a loop across the workers
+	and the calling thread, the calling thread claims indices alongside the workers and only blocks for indices other
+	threads are still running. This means for_each_index() may be called from within a task running on the same pool
+	without deadlocking, even when every worker is busy.
+
+	Tasks must not throw, an exception escaping a task running on a worker thread calls std::terminate().
+
+	Example Code:
+
+	#include "jclib/thread_pool.h"
+
+	int main()
+	{
+		int _values[64]{};
+		jc::thread_pool _pool{ 4 };
+		_pool.for_each_index(64, [&](size_t n) { _values[n] = static_cast<int>(n * n); });
+		return 0;
+	};
+*/
+
+#include "jclib/config.h"
+#include "jclib/functor.h"
+#include "jclib/thread.h"
+
+#define _JCLIB_THREAD_POOL_
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <deque>
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+namespace jc
+{
+	namespace impl
+	{
+		/**
+		 * @brief Shared state for a thread_pool::for_each_index() call.
+		 * 
+		 * Helper tasks hold shared ownership so a helper that only gets to run after the call has returned can still
+		 * safely see there is nothing left to do.
+		*/
+		struct thread_pool_bulk_job
+		{
+		public:
+			using function_type = jc::function_ref<void(size_t)>;
+
+			/**
+			 * @brief Claims and runs indices until none are left.
+			 * 
+			 * If the function throws, the indices nobody has claimed yet are skipped and counted as done along with
+			 * the throwing index before the exception is rethrown, so wait() still returns.
+			*/
+			void run()
+			{
+				while (true)
+				{
+					const size_t _index = this->next_.fetch_add(1, std::memory_order_relaxed);
+					if (_index >= this->count_)
+					{
+						break;
+					};
+
+#if JCLIB_EXCEPTIONS_V
+					try
+					{
+						this->function_(_index);
+					}
+					catch (...)
+					{
+						const size_t _unclaimed = this->next_.exchange(this->count_, std::memory_order_relaxed);
+						this->finish(1 + ((_unclaimed < this->count_) ? this->count_ - _unclaimed : 0));
+						throw;
+					};
+#else
+					this->function_(_index);
+#endif
+					this->finish(1);
+				};
+			};
+
+			/**
+			 * @brief Blocks until every index has been run
+			*/
+			void wait()
+			{
+				std::unique_lock<std::mutex> _lock{ this->mtx_ };
+				this->cvar_.wait(_lock, [this]()
+				{
+					return this->done_.load(std::memory_order_acquire) == this->count_;
+				});
+			};
+
+			thread_pool_bulk_job(size_t _count, function_type _function) :
+				function_{ _function }, count_{ _count }
+			{};
+
+		private:
+			/**
+			 * @brief Counts indices as done, waking wait() once every index is
+			*/
+			void finish(size_t _count)
+			{
+				if (this->done_.fetch_add(_count, std::memory_order_acq_rel) + _count == this->count_)
+				{
+					std::unique_lock<std::mutex> _lock{ this->mtx_ };
+					this->cvar_.notify_all();
+				};
+			};
+
+			function_type function_;
+			const size_t count_;
+			std::atomic<size_t> next_{ 0 };
+			std::atomic<size_t> done_{ 0 };
+			std::mutex mtx_;
+			std::condition_variable cvar_;
+		};
+	};
+
+	/**
+	 * @brief Fixed size pool of worker threads
+	*/
+	struct thread_pool
+	{
+	public:
+
+		/**
+		 * @brief Function object type used to hold queued tasks
+		*/
+		using task_type = jc::unique_functor<void()>;
+
+		using size_type = size_t;
+
+		/**
+		 * @brief Gets the number of threads used by default, one less than the hardware thread count as the thread
+		 * calling for_each_index() also takes part
+		*/
+		static size_type default_size() noexcept
+		{
+			const size_type _hardware = static_cast<size_type>(std::thread::hardware_concurrency());
+			return (_hardware > 1) ? _hardware - 1 : 0;
+		};
+
+		/**
+		 * @brief Gets the number of worker threads
+		*/
+		size_type size() const noexcept
+		{
+			return this->threads_.size();
+		};
+
+		/**
+		 * @brief Queues a task to be run by a worker thread
+		 * @param _task Function object invocable with no arguements
+		*/
+		template <typename OpT>
+		void submit(OpT&& _task)
+		{
+			{
+				std::unique_lock<std::mutex> _lock{ this->mtx_ };
+				this->tasks_.emplace_back(std::forward<OpT>(_task));
+			};
+			this->cvar_.notify_one();
+		};
+
+		/**
+		 * @brief Invokes a function with every index in [0, _count) using the worker threads and the calling thread,
+		 * returns once every invocation has returned.
+		 * 
+		 * If _op throws on the calling thread, indices not yet started are skipped and the exception is rethrown
+		 * once the worker threads have stopped invoking _op. Like any task, _op must not throw on a worker thread.
+		 * 
+		 * @param _count Number of indices
+		 * @param _op Function object invocable with a size_t index
+		*/
+		template <typename OpT>
+		void for_each_index(size_type _count, OpT&& _op)
+		{
+			if (_count == 0)
+			{
+				return;
+			}
+			else if (_count == 1 || this->size() == 0)
+			{
+				for (size_type n = 0; n != _count; ++n)
+				{
+					_op(n);
+				};
+				return;
+			};
+
+			const auto _job = std::make_shared<impl::thread_pool_bulk_job>(_count, _op);
+
+			// Wake up to one helper per index not run by this thread
+			const size_type _helpers = (_count - 1 < this->size()) ? _count - 1 : this->size();
+			{
+				std::unique_lock<std::mutex> _lock{ this->mtx_ };
+				for (size_type n = 0; n != _helpers; ++n)
+				{
+					this->tasks_.emplace_back([_job]() { _job->run(); });
+				};
+			};
+			this->cvar_.notify_all();
+
+			// Helpers may still be invoking _op, so an exception from this thread is only rethrown once they are done
+#if JCLIB_EXCEPTIONS_V
+			try
+			{
+				_job->run();
+			}
+			catch (...)
+			{
+				_job->wait();
+				throw;
+			};
+#else
+			_job->run();
+#endif
+			_job->wait();
+		};
+
+		/**
+		 * @brief Starts the worker threads
+		 * @param _threads Number of worker threads, may be zero in which case everything runs on the calling thread
+		*/
+		explicit thread_pool(size_type _threads = thread_pool::default_size())
+		{
+			this->threads_.reserve(_threads);
+			for (size_type n = 0; n != _threads; ++n)
+			{
+				this->threads_.emplace_back([this]() { this->work(); });
+			};
+		};
+
+		thread_pool(const thread_pool& other) = delete;
+		thread_pool& operator=(const thread_pool& other) = delete;
+		thread_pool(thread_pool&& other) = delete;
+		thread_pool& operator=(thread_pool&& other) = delete;
+
+		/**
+		 * @brief Runs any remaining queued tasks and joins the worker threads
+		*/
+		~thread_pool()
+		{
+			{
+				std::unique_lock<std::mutex> _lock{ this->mtx_ };
+				this->stop_ = true;
+			};
+			this->cvar_.notify_all();
+			for (auto& _thread : this->threads_)
+			{
+				_thread.join();
+			};
+		};
+
+	private:
+
+		/**
+		 * @brief Worker thread main loop
+		*/
+		void work()
+		{
+			while (true)
+			{
+				task_type _task{};
+				{
+					std::unique_lock<std::mutex> _lock{ this->mtx_ };
+					this->cvar_.wait(_lock, [this]() { return this->stop_ || !this->tasks_.empty(); });
+					if (this->tasks_.empty())
+					{
+						return;
+					};
+					_task = std::move(this->tasks_.front());
+					this->tasks_.pop_front();
+				};
+				_task();
+			};
+		};
+
+		std::mutex mtx_;
+		std::condition_variable cvar_;
+		std::deque<task_type> tasks_;
+		std::vector<std::thread> threads_;
+		bool stop_ = false;
+	};
+
+	/**
+	 * @brief Gets the thread pool used by the jc::execution::par and jc::execution::par_unseq policies, created on
+	 * first use with thread_pool::default_size() threads
+	*/
+	inline thread_pool& default_thread_pool()
+	{
+		static thread_pool pool_{};
+		return pool_;
+	};
+};
+
+#endif
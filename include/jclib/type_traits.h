@@ -30,6 +30,32 @@
 #include <utility>
 #include <cstdint>
 
+/*
+	Determine how constant evaluation can be detected for jc::is_constant_evaluated
+*/
+#if JCLIB_FEATURE_IS_CONSTANT_EVALUATED_V
+	// True/False depending on if jc::is_constant_evaluated() can detect constant evaluation
+	#define JCLIB_IS_CONSTANT_EVALUATED_V true
+#elif defined(__has_builtin)
+	#if __has_builtin(__builtin_is_constant_evaluated)
+		// Compiler builtin is available from GCC 9, Clang 9 and MSVC 19.25 regardless of the language version
+		#define JCLIB_IS_CONSTANT_EVALUATED_BUILTIN
+	#endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+	// Compiler builtin is available from GCC 9, Clang 9 and MSVC 19.25 regardless of the language version
+	#define JCLIB_IS_CONSTANT_EVALUATED_BUILTIN
+#endif
+
+#ifndef JCLIB_IS_CONSTANT_EVALUATED_V
+	#ifdef JCLIB_IS_CONSTANT_EVALUATED_BUILTIN
+		// True/False depending on if jc::is_constant_evaluated() can detect constant evaluation
+		#define JCLIB_IS_CONSTANT_EVALUATED_V true
+	#else
+		// True/False depending on if jc::is_constant_evaluated() can detect constant evaluation
+		#define JCLIB_IS_CONSTANT_EVALUATED_V false
+	#endif
+#endif
+
 namespace jc
 {
 
@@ -1062,6 +1088,26 @@ namespace jc
 	constexpr inline auto is_polymorphic_base_of_v = is_polymorphic_base_of<BaseT, DerivedT>::value;
 #endif
 
+	/**
+	 * @brief Checks if the call is occuring during constant evaluation, allows constexpr functions to use a faster
+	 * implementation at runtime.
+	 * 
+	 * Always returns false when JCLIB_IS_CONSTANT_EVALUATED_V is false, so the runtime path must not be taken
+	 * based on this alone if the function also needs to work in constant expressions.
+	 * 
+	 * @return True if constant evaluated, false otherwise
+	*/
+	constexpr inline bool is_constant_evaluated() noexcept
+	{
+#if JCLIB_FEATURE_IS_CONSTANT_EVALUATED_V
+		return std::is_constant_evaluated();
+#elif defined(JCLIB_IS_CONSTANT_EVALUATED_BUILTIN)
+		return __builtin_is_constant_evaluated();
+#else
+		return false;
+#endif
+	};
+
 };
 
 #endif
\ No newline at end of file
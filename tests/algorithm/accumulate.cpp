@@ -0,0 +1,119 @@
+#include <jclib/algorithm.h>
+#include <jclib/execution.h>
+#include <jclib/span.h>
+#include <jclib-test.hpp>
+
+#include <vector>
+#include <array>
+#include <limits>
+#include <numeric>
+#include <cstdint>
+#include <cmath>
+
+// Sequential reference loop
+template <typename T, typename E, typename OpT>
+T reference_accumulate(const std::vector<E>& _data, OpT _op, T _init)
+{
+	for (auto& v : _data)
+	{
+		_init = _op(_init, v);
+	};
+	return _init;
+};
+
+// Sequential reference loop for integers, done as unsigned to get the wrapped result without overflow
+template <typename T, typename E, typename OpT>
+T reference_accumulate_wrapped(const std::vector<E>& _data, OpT _op, T _init)
+{
+	using unsigned_type = std::make_unsigned_t<decltype(T() + E())>;
+	unsigned_type _value = static_cast<unsigned_type>(_init);
+	for (auto& v : _data)
+	{
+		_value = static_cast<unsigned_type>(_op(_value, static_cast<unsigned_type>(static_cast<T>(v))));
+	};
+	return static_cast<T>(_value);
+};
+
+template <typename E, typename T>
+int test_integers()
+{
+	NEWTEST();
+
+	for (size_t _length : { 0, 1, 3, 15, 16, 17, 64, 1000, 5001 })
+	{
+		std::vector<E> _data(_length);
+		for (size_t n = 0; n != _length; ++n)
+		{
+			// Mix of large positive and negative values so partial sums wrap
+			_data[n] = static_cast<E>((n % 2 == 0) ? std::numeric_limits<E>::max() - static_cast<E>(n) : static_cast<E>(n * 7 + 3));
+		};
+
+		const auto _sum = reference_accumulate_wrapped(_data, jc::plus, T(5));
+		ASSERT(jc::accumulate(_data, jc::plus, T(5)) == _sum, "integer sum mismatch");
+		ASSERT(jc::accumulate(_data.data(), _data.data() + _data.size(), jc::plus, T(5)) == _sum, "pointer integer sum mismatch");
+		ASSERT(jc::reduce(jc::execution::unseq, _data, jc::plus, T(5)) == _sum, "unsequenced integer reduce mismatch");
+
+		const auto _product = reference_accumulate_wrapped(_data, jc::times, T(1));
+		ASSERT(jc::accumulate(_data, jc::times, T(1)) == _product, "integer product mismatch");
+		ASSERT(jc::reduce(jc::execution::par_unseq, _data, jc::times, T(1)) == _product, "parallel integer product mismatch");
+	};
+
+	PASS();
+};
+
+int test_floating_point()
+{
+	NEWTEST();
+
+	std::vector<float> _data(10007);
+	for (size_t n = 0; n != _data.size(); ++n)
+	{
+		_data[n] = 1.0f / static_cast<float>(n + 1);
+	};
+
+	// Floating point accumulate must keep the sequential order, so the result is bit identical
+	const auto _sequential = reference_accumulate(_data, jc::plus, 0.0f);
+	ASSERT(jc::accumulate(_data, jc::plus, 0.0f) == _sequential, "float accumulate was reordered");
+	ASSERT(jc::reduce(jc::execution::seq, _data, jc::plus, 0.0f) == _sequential, "float reduce with seq was reordered");
+
+	// Reordering is opted into with the unsequenced policies
+	const auto _exact = reference_accumulate(_data, jc::plus, 0.0);
+	const auto _unsequenced = jc::reduce(jc::execution::unseq, _data, jc::plus, 0.0f);
+	ASSERT(std::abs(_unsequenced - _exact) < 1e-4, "unsequenced float reduce is inaccurate");
+
+	const auto _doubles = jc::reduce(jc::execution::par_unseq, _data, jc::plus, 0.0);
+	ASSERT(std::abs(_doubles - _exact) < 1e-9, "unsequenced double reduce is inaccurate");
+
+	PASS();
+};
+
+int test_ranges()
+{
+	NEWTEST();
+
+	const int _array[]{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+	ASSERT(jc::accumulate(_array) == 210, "c-array sum mismatch");
+
+	const std::array<uint16_t, 4> _small{ 60000, 60000, 60000, 60000 };
+	ASSERT(jc::accumulate(_small, jc::plus, 0) == 240000, "uint16_t elements summed into int mismatch");
+
+	std::vector<int32_t> _data(100, -1);
+	ASSERT(jc::accumulate(jc::span<int32_t>{ _data }, jc::plus, int64_t(0)) == -100, "span sum into int64_t mismatch");
+
+	PASS();
+};
+
+int main()
+{
+	NEWTEST();
+
+	SUBTEST((test_integers<int32_t, int32_t>));
+	SUBTEST((test_integers<uint32_t, uint32_t>));
+	SUBTEST((test_integers<int64_t, int64_t>));
+	SUBTEST((test_integers<int32_t, int64_t>));
+	SUBTEST((test_integers<uint8_t, int>));
+	SUBTEST(test_floating_point);
+	SUBTEST(test_ranges);
+
+	PASS();
+};
@@ -0,0 +1,7 @@
+# algorithm test driver
+JCLIB_ADD_TEST("algorithm" "${CMAKE_CURRENT_LIST_DIR}/test.cpp")
+JCLIB_ADD_TEST("algorithm-find" "${CMAKE_CURRENT_LIST_DIR}/find.cpp")
+JCLIB_ADD_TEST("algorithm-accumulate" "${CMAKE_CURRENT_LIST_DIR}/accumulate.cpp")
+JCLIB_ADD_TEST("algorithm-copy" "${CMAKE_CURRENT_LIST_DIR}/copy.cpp")
+JCLIB_ADD_TEST("algorithm-sort" "${CMAKE_CURRENT_LIST_DIR}/sort.cpp")
+JCLIB_ADD_TEST("algorithm-search" "${CMAKE_CURRENT_LIST_DIR}/search.cpp")
@@ -0,0 +1,167 @@
+#include <jclib/algorithm.h>
+#include <jclib/span.h>
+#include <jclib/memory.h>
+#include <jclib-test.hpp>
+
+#include <vector>
+#include <string>
+#include <iterator>
+#include <cstdint>
+
+namespace test
+{
+	// Trivially copyable element which doesn't tile a 16 byte store
+	struct triple
+	{
+		uint8_t a, b, c;
+	};
+
+	inline bool operator==(const triple& lhs, const triple& rhs)
+	{
+		return lhs.a == rhs.a && lhs.b == rhs.b && lhs.c == rhs.c;
+	};
+};
+
+// Checks every element of a range is equal to a value
+template <typename RangeT, typename T>
+bool all_equal(const RangeT& _range, const T& _value)
+{
+	for (auto& v : _range)
+	{
+		if (!(v == _value))
+		{
+			return false;
+		};
+	};
+	return true;
+};
+
+// Fills with values that can and can't be written using memset
+template <typename T>
+int test_fill_values()
+{
+	NEWTEST();
+
+	for (size_t _length : { 0, 1, 3, 16, 33, 1000 })
+	{
+		std::vector<T> _data(_length, T(9));
+		for (T _value : { T(0), T(1), T(-1), T(0x41), T(-2) })
+		{
+			jc::fill(_data, _value);
+			ASSERT(all_equal(_data, _value), "fill did not assign every element");
+		};
+	};
+
+	PASS();
+};
+
+// Fills and copies through spans and borrow_ptr destinations
+int test_wrappers()
+{
+	NEWTEST();
+
+	std::vector<int> _data(64, 1);
+	auto _span = jc::span<int>{ _data.data() + 8, 16 };
+
+	jc::fill(_span, 5);
+	ASSERT(_data[7] == 1 && _data[8] == 5 && _data[23] == 5 && _data[24] == 1, "span fill wrote outside of the span");
+
+	std::vector<int> _dest(64, 0);
+	const auto _end = jc::copy(_span, jc::borrow_ptr<int>{ _dest.data() + 1 });
+	ASSERT(_end.get() == _dest.data() + 17, "copy to borrow_ptr returned the wrong end");
+	ASSERT(_dest[0] == 0 && _dest[1] == 5 && _dest[16] == 5 && _dest[17] == 0, "copy to borrow_ptr wrote the wrong elements");
+
+	auto _destSpan = jc::span<int>{ _dest.data(), _dest.size() };
+	const auto _spanEnd = jc::copy(_data, jc::begin(_destSpan));
+	ASSERT(_spanEnd == jc::end(_destSpan), "copy to span iterator returned the wrong end");
+	ASSERT(_dest == _data, "copy to span iterator did not copy every element");
+
+	// Empty source must not touch the destination
+	const std::vector<int> _empty{};
+	ASSERT(jc::copy(_empty, _dest.data() + 3) == _dest.data() + 3, "empty copy moved the destination");
+	ASSERT(jc::copy_nontemporal(_empty, _dest.data() + 3) == _dest.data() + 3, "empty copy moved the destination");
+
+	PASS();
+};
+
+// Copies which must take the generic path
+int test_generic()
+{
+	NEWTEST();
+
+	const std::vector<std::string> _strings{ "a", "bb", "ccc" };
+	std::vector<std::string> _out;
+	jc::copy(_strings, std::back_inserter(_out));
+	ASSERT(_out == _strings, "copy into a back inserter failed");
+
+	// Converting copy
+	const std::vector<int> _ints{ 1, 2, 3 };
+	std::vector<long long> _longs(3);
+	jc::copy(_ints, _longs.begin());
+	ASSERT(_longs[0] == 1 && _longs[2] == 3, "converting copy failed");
+
+	// Overlapping copy towards the front
+	std::vector<int> _shift{ 0, 1, 2, 3, 4, 5 };
+	jc::copy(jc::span<const int>{ _shift.data() + 2, 4 }, _shift.data());
+	ASSERT((_shift == std::vector<int>{ 2, 3, 4, 5, 4, 5 }), "overlapping copy failed");
+
+	PASS();
+};
+
+// Non-temporal variants with buffers above and below the streaming threshold at odd alignments
+int test_nontemporal()
+{
+	NEWTEST();
+
+	for (size_t _length : { size_t(5), size_t(1) << 17, (size_t(1) << 17) + 7 })
+	{
+		for (size_t _offset : { 0, 1, 3 })
+		{
+			std::vector<uint32_t> _source(_length + _offset);
+			for (size_t n = 0; n != _source.size(); ++n)
+			{
+				_source[n] = static_cast<uint32_t>(n * 2654435761u);
+			};
+
+			std::vector<uint32_t> _dest(_length + 4, 0);
+			const auto _from = jc::span<const uint32_t>{ _source.data() + _offset, _length };
+			const auto _end = jc::copy_nontemporal(_from, _dest.data() + 1);
+			ASSERT(_end == _dest.data() + 1 + _length, "copy_nontemporal returned the wrong end");
+			ASSERT(_dest[0] == 0 && _dest[_length + 1] == 0, "copy_nontemporal wrote outside of the destination");
+			ASSERT(std::equal(_from.begin(), _from.end(), _dest.begin() + 1), "copy_nontemporal did not copy every element");
+
+			auto _fillSpan = jc::span<uint32_t>{ _dest.data() + _offset, _length };
+			jc::fill_nontemporal(_fillSpan, 0xDEADBEEF);
+			ASSERT(all_equal(_fillSpan, 0xDEADBEEF), "fill_nontemporal did not assign every element");
+		};
+
+		std::vector<uint16_t> _shorts(_length + 1, 0);
+		auto _shortSpan = jc::span<uint16_t>{ _shorts.data() + 1, _length };
+		jc::fill_nontemporal(_shortSpan, uint16_t(0x1234));
+		ASSERT(_shorts[0] == 0 && all_equal(_shortSpan, uint16_t(0x1234)), "fill_nontemporal failed at an odd offset");
+
+		std::vector<test::triple> _triples(_length, test::triple{ 1, 2, 3 });
+		std::vector<test::triple> _triplesOut(_length);
+		jc::copy_nontemporal(_triples, _triplesOut.data());
+		ASSERT(_triples == _triplesOut, "copy_nontemporal failed for an element which doesn't tile the store width");
+	};
+
+	PASS();
+};
+
+int main()
+{
+	NEWTEST();
+
+	SUBTEST(test_fill_values<uint8_t>);
+	SUBTEST(test_fill_values<int16_t>);
+	SUBTEST(test_fill_values<int32_t>);
+	SUBTEST(test_fill_values<uint64_t>);
+	SUBTEST(test_fill_values<float>);
+	SUBTEST(test_fill_values<double>);
+	SUBTEST(test_wrappers);
+	SUBTEST(test_generic);
+	SUBTEST(test_nontemporal);
+
+	PASS();
+};
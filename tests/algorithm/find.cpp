@@ -0,0 +1,200 @@
+#include <jclib/algorithm.h>
+#include <jclib/span.h>
+#include <jclib/execution.h>
+#include <jclib/thread_pool.h>
+#include <jclib-test.hpp>
+
+#include <vector>
+#include <list>
+#include <atomic>
+#include <array>
+#include <string>
+#include <algorithm>
+#include <cstdint>
+
+namespace test
+{
+	enum class color : uint16_t
+	{
+		red = 1,
+		green = 0x0100,
+		blue = 0xFFFF,
+	};
+};
+
+// Compares jc::find against std::find for every position in ranges of several lengths
+template <typename T>
+int test_matches_std()
+{
+	NEWTEST();
+
+	for (size_t _length : { 0, 1, 7, 8, 15, 16, 31, 32, 33, 64, 100, 257 })
+	{
+		std::vector<T> _data(_length);
+		for (size_t n = 0; n != _length; ++n)
+		{
+			// Odd values only, so zero is never present even once small types wrap around
+			_data[n] = static_cast<T>(n * 2 + 1);
+		};
+
+		for (size_t n = 0; n != _length; ++n)
+		{
+			const auto _it = jc::find(_data, _data[n]);
+			ASSERT(_it == std::find(_data.begin(), _data.end(), _data[n]), "found a different element than std::find");
+			ASSERT(_it <= _data.begin() + n && *_it == _data[n], "did not find the first matching element");
+		};
+
+		ASSERT(jc::find(_data, static_cast<T>(0)) == _data.end(), "found a value that isn't in the range");
+		ASSERT(!jc::contains(_data, static_cast<T>(0)), "contains returned true for a value that isn't in the range");
+
+		// Duplicates must return the first match
+		if (_length > 2 && _length <= 100)
+		{
+			_data.back() = _data[1];
+			ASSERT(jc::find(_data, _data[1]) == _data.begin() + 1, "did not find the first of two matching elements");
+		};
+	};
+
+	PASS();
+};
+
+// Searching for values that can't be represented by the element type
+int test_conversions()
+{
+	NEWTEST();
+
+	{
+		const std::vector<uint8_t> _data{ 0, 1, 255 };
+		ASSERT(jc::find(_data, 256) == _data.end(), "256 should not match any uint8_t");
+		ASSERT(jc::find(_data, -1) == _data.end(), "-1 should not match 255 as uint8_t promotes to int");
+		ASSERT(jc::find(_data, 255) == _data.begin() + 2, "255 should be found");
+	};
+	{
+		const std::vector<int8_t> _data{ 0, -1, 127 };
+		ASSERT(jc::find(_data, 255) == _data.end(), "255 should not match -1 as int8_t promotes to int");
+		ASSERT(jc::find(_data, 0xFFFFFFFFu) == _data.begin() + 1, "-1 converts to UINT_MAX when compared with unsigned");
+		ASSERT(jc::find(_data, -1) == _data.begin() + 1, "-1 should be found");
+	};
+	{
+		const std::vector<uint32_t> _data(40, 7);
+		ASSERT(jc::find(_data, int64_t(0x100000007)) == _data.end(), "value wider than uint32_t should not be found");
+		ASSERT(jc::find(_data, int64_t(7)) == _data.begin(), "7 should be found");
+	};
+	{
+		const bool _data[]{ false, false, true };
+		ASSERT(jc::find(_data, 2) == jc::end(_data), "2 should not compare equal to true");
+		ASSERT(jc::find(_data, true) == jc::begin(_data) + 2, "true should be found");
+	};
+
+	PASS();
+};
+
+// Other contiguous range types and element types
+int test_ranges()
+{
+	NEWTEST();
+
+	{
+		const char _text[] = "key = value; other = thing";
+		ASSERT(jc::find(_text, ';') == _text + 11, "did not find character in c-array");
+		ASSERT(!jc::contains(_text, '#'), "found character not in c-array");
+
+		const std::string _str{ _text };
+		ASSERT(jc::find(_str, '=') == _str.begin() + 4, "did not find character in std::string");
+	};
+	{
+		std::array<test::color, 20> _data{};
+		_data.fill(test::color::red);
+		_data[17] = test::color::blue;
+		ASSERT(jc::find(_data, test::color::blue) == _data.begin() + 17, "did not find enum value");
+		ASSERT(!jc::contains(_data, test::color::green), "found enum value not in the range");
+	};
+	{
+		std::vector<uint64_t> _data(50, 0xFFFFFFFFFFFFFFFF);
+		_data[49] = 2;
+		const auto _span = jc::span<uint64_t>{ _data };
+		ASSERT(jc::find(_span, uint64_t(2)) == _span.begin() + 49, "did not find value in span");
+	};
+	{
+		const std::vector<std::string> _data{ "a", "b", "c" };
+		ASSERT(jc::find(_data, std::string("c")) == _data.begin() + 2, "did not find non-integral element");
+	};
+
+	PASS();
+};
+
+// Parallel find_if must return the first match by position, wherever the matches are
+int test_parallel_find_if(jc::thread_pool& _pool)
+{
+	NEWTEST();
+
+	for (size_t _length : { 0, 1, 1000, 5000, 200000 })
+	{
+		std::vector<uint32_t> _data(_length);
+		for (size_t n = 0; n != _length; ++n)
+		{
+			_data[n] = static_cast<uint32_t>(n);
+		};
+
+		for (size_t _at : { size_t(0), size_t(1), _length / 3, _length / 2, _length - 1, _length })
+		{
+			// Matches at _at and every 997th element after it
+			const auto _pred = [_at](uint32_t v) { return v >= _at && (v - _at) % 997 == 0; };
+			const auto _expected = std::find_if(_data.begin(), _data.end(), _pred);
+
+			ASSERT(jc::find_if(jc::execution::on(_pool), _data, _pred) == _expected, "parallel find_if did not return the first match");
+			ASSERT(jc::find_if(jc::execution::par, _data, _pred) == _expected, "par find_if did not return the first match");
+			ASSERT(jc::find_if(jc::execution::seq, _data, _pred) == _expected, "seq find_if did not return the first match");
+			ASSERT(jc::contains_if(jc::execution::on(_pool), _data, _pred) == (_expected != _data.end()), "parallel contains_if mismatch");
+		};
+	};
+
+	// Once a match is found most of the remaining range must be skipped
+	std::vector<uint32_t> _data(1000000, 0);
+	_data[10] = 1;
+	std::atomic<size_t> _calls{ 0 };
+	const auto _it = jc::find_if(jc::execution::on(_pool), _data, [&_calls](uint32_t v)
+	{
+		_calls.fetch_add(1, std::memory_order_relaxed);
+		return v == 1;
+	});
+	ASSERT(_it == _data.begin() + 10, "parallel find_if did not find the match");
+	ASSERT(_calls.load() < _data.size() / 2, "parallel find_if did not stop early");
+
+	// Ranges without random access are searched sequentially
+	const std::list<int> _list{ 1, 3, 5, 8, 9 };
+	ASSERT(*jc::find_if(jc::execution::par, _list, [](int v) { return v % 2 == 0; }) == 8, "parallel find_if of a list failed");
+	ASSERT(!jc::contains_if(jc::execution::par, _list, [](int v) { return v > 9; }), "parallel contains_if of a list failed");
+
+	PASS();
+};
+
+#if JCLIB_IS_CONSTANT_EVALUATED_V && (defined(JCLIB_ALGORITHM_H_USE_CUSTOM_ALGORITHMS) || JCLIB_FEATURE_CPP_CONSTEXPR_ALGORITHMS_V)
+constexpr int find_in_constant_expression()
+{
+	const int _data[]{ 4, 5, 6, 7 };
+	return static_cast<int>(jc::find(_data, 6) - _data);
+};
+static_assert(find_in_constant_expression() == 2, "find must remain usable in constant expressions");
+#endif
+
+int main()
+{
+	NEWTEST();
+
+	SUBTEST(test_matches_std<uint8_t>);
+	SUBTEST(test_matches_std<int8_t>);
+	SUBTEST(test_matches_std<char>);
+	SUBTEST(test_matches_std<uint16_t>);
+	SUBTEST(test_matches_std<int32_t>);
+	SUBTEST(test_matches_std<uint32_t>);
+	SUBTEST(test_matches_std<int64_t>);
+	SUBTEST(test_matches_std<uint64_t>);
+	SUBTEST(test_conversions);
+	SUBTEST(test_ranges);
+
+	jc::thread_pool _pool{ 3 };
+	SUBTEST(test_parallel_find_if, _pool);
+
+	PASS();
+};
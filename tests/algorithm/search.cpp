@@ -0,0 +1,120 @@
+#include <jclib/algorithm.h>
+#include <jclib/span.h>
+#include <jclib-test.hpp>
+
+#include <vector>
+#include <list>
+#include <string>
+#include <iterator>
+#include <algorithm>
+#include <cstdint>
+
+// Compares jc::lower_bound and jc::binary_search against the standard library for every value around a sorted range
+int test_matches_std()
+{
+	NEWTEST();
+
+	for (int _length = 0; _length != 70; ++_length)
+	{
+		// Even values with some duplicates, odd values are never present
+		std::vector<int> _data{};
+		for (int n = 0; n != _length; ++n)
+		{
+			_data.push_back((n - n % 3) * 2);
+		};
+
+		for (int v = -2; v <= _length * 2 + 2; ++v)
+		{
+			ASSERT(jc::lower_bound(_data, v) == std::lower_bound(_data.begin(), _data.end(), v), "lower_bound did not match std::lower_bound");
+			ASSERT(jc::binary_search(_data, v) == std::binary_search(_data.begin(), _data.end(), v), "binary_search did not match std::binary_search");
+		};
+	};
+
+	PASS();
+};
+
+// Custom comparisons and ranges without random access
+int test_ranges()
+{
+	NEWTEST();
+
+	const std::vector<std::string> _descending{ "pear", "fig", "banana", "apple" };
+	ASSERT(jc::lower_bound(_descending, std::string("cherry"), jc::greater) == _descending.begin() + 2, "lower_bound ignored the comparison");
+	ASSERT(jc::binary_search(_descending, std::string("fig"), jc::greater), "binary_search did not find a string");
+	ASSERT(!jc::binary_search(_descending, std::string("kiwi"), jc::greater), "binary_search found a missing string");
+
+	const std::list<int> _list{ 1, 3, 5, 7 };
+	ASSERT(*jc::lower_bound(_list, 4) == 5, "lower_bound of a list failed");
+	ASSERT(jc::lower_bound(_list, 8) == _list.end(), "lower_bound of a list past the end failed");
+	ASSERT(jc::binary_search(_list, 7) && !jc::binary_search(_list, 2), "binary_search of a list failed");
+
+	const int _array[]{ 2, 4, 6 };
+	ASSERT(jc::lower_bound(_array, 5) == _array + 2, "lower_bound of a c-array failed");
+
+	PASS();
+};
+
+// Batched lower bounds must match individual searches, including partial batches
+int test_batch()
+{
+	NEWTEST();
+
+	for (size_t _length : { 0, 1, 2, 3, 16, 17, 1000, 65537 })
+	{
+		std::vector<uint32_t> _table(_length);
+		for (size_t n = 0; n != _length; ++n)
+		{
+			_table[n] = static_cast<uint32_t>(n * 3);
+		};
+
+		for (size_t _queryCount : { 0, 1, 15, 16, 17, 100 })
+		{
+			std::vector<uint32_t> _queries(_queryCount);
+			for (size_t n = 0; n != _queryCount; ++n)
+			{
+				_queries[n] = static_cast<uint32_t>((n * 7919) % (_length * 3 + 5));
+			};
+
+			std::vector<std::vector<uint32_t>::iterator> _results{};
+			const auto _out = jc::lower_bound_batch(_table, jc::span<const uint32_t>{ _queries.data(), _queries.size() }, std::back_inserter(_results));
+			static_cast<void>(_out);
+			ASSERT(_results.size() == _queryCount, "lower_bound_batch wrote the wrong number of results");
+			for (size_t n = 0; n != _queryCount; ++n)
+			{
+				ASSERT(_results[n] == std::lower_bound(_table.begin(), _table.end(), _queries[n]), "lower_bound_batch did not match std::lower_bound");
+			};
+		};
+	};
+
+	// Through a span, with a comparison
+	std::vector<int> _descending{ 9, 7, 5, 3, 1 };
+	const auto _span = jc::span<int>{ _descending.data(), _descending.size() };
+	const int _queries[]{ 10, 6, 1, 0 };
+	jc::impl::span_iterator<int> _results[4]{};
+	const auto _end = jc::lower_bound_batch(_span, _queries, _results, jc::greater);
+	ASSERT(_end == _results + 4, "lower_bound_batch returned the wrong output end");
+	ASSERT(_results[0] == _span.begin() && _results[1] == _span.begin() + 2 && _results[2] == _span.begin() + 4 && _results[3] == _span.end(),
+		"lower_bound_batch through a span failed");
+
+	PASS();
+};
+
+#if JCLIB_IS_CONSTANT_EVALUATED_V && (defined(JCLIB_ALGORITHM_H_USE_CUSTOM_ALGORITHMS) || JCLIB_FEATURE_CPP_CONSTEXPR_ALGORITHMS_V)
+constexpr bool search_in_constant_expression()
+{
+	const int _data[]{ 1, 3, 5, 7, 9 };
+	return jc::lower_bound(_data, 6) == _data + 3 && jc::binary_search(_data, 9) && !jc::binary_search(_data, 4);
+};
+static_assert(search_in_constant_expression(), "binary searches must be usable in constant expressions");
+#endif
+
+int main()
+{
+	NEWTEST();
+
+	SUBTEST(test_matches_std);
+	SUBTEST(test_ranges);
+	SUBTEST(test_batch);
+
+	PASS();
+};
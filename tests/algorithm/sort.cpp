@@ -0,0 +1,308 @@
+#include <jclib/algorithm.h>
+#include <jclib/execution.h>
+#include <jclib/thread_pool.h>
+#include <jclib/span.h>
+#include <jclib-test.hpp>
+
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+#include <cmath>
+
+namespace test
+{
+	// Record sorted by a key member, the index checks radix sort is stable
+	struct record
+	{
+		int32_t key;
+		uint32_t index;
+	};
+
+	// Projection returning a record's key
+	struct record_key
+	{
+		int32_t operator()(const record& _record) const noexcept
+		{
+			return _record.key;
+		};
+	};
+
+	// Comparison on a record's key only
+	struct record_less
+	{
+		bool operator()(const record& lhs, const record& rhs) const noexcept
+		{
+			return lhs.key < rhs.key;
+		};
+	};
+
+	// Element which can't be default constructed, must still be sortable by the comparison sorts
+	struct no_default
+	{
+		explicit no_default(int _value) : value(_value) {};
+		friend bool operator<(const no_default& lhs, const no_default& rhs) { return lhs.value < rhs.value; };
+
+		int value;
+	};
+};
+
+// Generates values of a type with some duplicates, limited to a number of distinct values if non-zero
+template <typename T>
+std::vector<T> make_values(size_t _count, uint64_t _seed, uint64_t _distinct = 0)
+{
+	std::mt19937_64 _random{ _seed };
+	std::vector<T> _out(_count);
+	for (auto& v : _out)
+	{
+		auto _bits = _random();
+		if (_distinct != 0)
+		{
+			_bits %= _distinct;
+		};
+		v = static_cast<T>(_bits);
+	};
+	return _out;
+};
+
+// Checks jc::sort and its parallel overload against std::sort for several lengths
+template <typename T>
+int test_comparison_sort(jc::thread_pool& _pool)
+{
+	NEWTEST();
+
+	for (size_t _length : { 0, 1, 2, 15, 16, 17, 100, 1000, 70000 })
+	{
+		for (uint64_t _distinct : { 0, 3 })
+		{
+			auto _expected = make_values<T>(_length, _length + 1, _distinct);
+			auto _sorted = _expected;
+			auto _parallel = _expected;
+			std::sort(_expected.begin(), _expected.end());
+
+			jc::sort(_sorted);
+			ASSERT(_sorted == _expected, "sort did not match std::sort");
+
+			jc::sort(jc::execution::on(_pool), _parallel);
+			ASSERT(_parallel == _expected, "parallel sort did not match std::sort");
+
+			jc::sort(jc::execution::par, _parallel, jc::greater);
+			ASSERT(std::is_sorted(_parallel.rbegin(), _parallel.rend()), "parallel sort ignored the comparison");
+		};
+	};
+
+	PASS();
+};
+
+// The constexpr introsort, including the heap sort fallback, which is used during constant evaluation
+int test_introsort()
+{
+	NEWTEST();
+
+	auto _compare = jc::less;
+	for (size_t _length : { 0, 1, 17, 1000, 5000 })
+	{
+		for (uint64_t _distinct : { 0, 2 })
+		{
+			auto _values = make_values<int>(_length, 7, _distinct);
+			auto _heap = _values;
+			jc::impl_algorithms_sort::introsort(_values.begin(), _values.end(), _compare,
+				jc::impl_algorithms_sort::introsort_depth(_length));
+			ASSERT(std::is_sorted(_values.begin(), _values.end()), "introsort did not sort");
+
+			jc::impl_algorithms_sort::introsort(_heap.begin(), _heap.end(), _compare, 0);
+			ASSERT(_heap == _values, "introsort heap sort fallback did not sort");
+		};
+	};
+
+	// Organ pipe input is a classic bad case for median of three pivots
+	std::vector<int> _organ{};
+	for (int n = 0; n != 4096; ++n)
+	{
+		_organ.push_back(n < 2048 ? n : 4096 - n);
+	};
+	jc::impl_algorithms_sort::introsort(_organ.begin(), _organ.end(), _compare, jc::impl_algorithms_sort::introsort_depth(_organ.size()));
+	ASSERT(std::is_sorted(_organ.begin(), _organ.end()), "introsort did not sort organ pipe input");
+
+	PASS();
+};
+
+// Checks radix sort against std::stable_sort for several lengths
+template <typename T>
+int test_radix_sort(jc::thread_pool& _pool)
+{
+	NEWTEST();
+
+	for (size_t _length : { 0, 1, 63, 64, 65, 1000, 200000 })
+	{
+		for (uint64_t _distinct : { 0, 300 })
+		{
+			auto _values = make_values<T>(_length, _length * 3 + 1, _distinct);
+			if (std::is_signed<T>::value && _distinct != 0)
+			{
+				// Shift down so there are negative values
+				for (auto& v : _values)
+				{
+					v = static_cast<T>(v - static_cast<T>(100));
+				};
+			};
+
+			auto _expected = _values;
+			auto _parallel = _values;
+			std::sort(_expected.begin(), _expected.end());
+
+			jc::radix_sort(_values);
+			ASSERT(_values == _expected, "radix sort did not match std::sort");
+
+			jc::radix_sort(jc::execution::on(_pool), _parallel);
+			ASSERT(_parallel == _expected, "parallel radix sort did not match std::sort");
+		};
+	};
+
+	PASS();
+};
+
+// Floating point keys including negative values, signed zeros and infinities
+template <typename T>
+int test_radix_floats(jc::thread_pool& _pool)
+{
+	NEWTEST();
+
+	std::mt19937_64 _random{ 11 };
+	std::uniform_real_distribution<T> _distribution{ T(-1000), T(1000) };
+	std::vector<T> _values(150000);
+	for (auto& v : _values)
+	{
+		v = _distribution(_random);
+	};
+	_values[10] = std::numeric_limits<T>::infinity();
+	_values[20] = -std::numeric_limits<T>::infinity();
+	_values[30] = T(0);
+	_values[40] = -T(0);
+	_values[50] = std::numeric_limits<T>::denorm_min();
+	_values[60] = std::numeric_limits<T>::lowest();
+
+	auto _expected = _values;
+	auto _parallel = _values;
+	std::sort(_expected.begin(), _expected.end());
+
+	jc::radix_sort(_values);
+	ASSERT(_values == _expected, "radix sort of floating point keys did not match std::sort");
+
+	jc::radix_sort(jc::execution::on(_pool), _parallel);
+	ASSERT(_parallel == _expected, "parallel radix sort of floating point keys did not match std::sort");
+
+	// -0 must come before +0
+	const auto _zero = std::find(_values.begin(), _values.end(), T(0));
+	ASSERT(std::signbit(_zero[0]) && !std::signbit(_zero[1]), "radix sort did not order -0 before +0");
+
+	PASS();
+};
+
+// Projected keys must sort stably
+int test_radix_projection(jc::thread_pool& _pool)
+{
+	NEWTEST();
+
+	for (size_t _length : { 50, 5000, 300000 })
+	{
+		const auto _keys = make_values<int32_t>(_length, 5, 1000);
+		std::vector<test::record> _records(_length);
+		for (size_t n = 0; n != _length; ++n)
+		{
+			_records[n] = test::record{ _keys[n] - 500, static_cast<uint32_t>(n) };
+		};
+
+		auto _expected = _records;
+		auto _parallel = _records;
+		std::stable_sort(_expected.begin(), _expected.end(), test::record_less{});
+
+		const auto _same = [](const test::record& lhs, const test::record& rhs)
+		{
+			return lhs.key == rhs.key && lhs.index == rhs.index;
+		};
+
+		jc::radix_sort(_records, test::record_key{});
+		ASSERT(std::equal(_records.begin(), _records.end(), _expected.begin(), _same), "radix sort by projection was not stable");
+
+		jc::radix_sort(jc::execution::on(_pool), _parallel, test::record_key{});
+		ASSERT(std::equal(_parallel.begin(), _parallel.end(), _expected.begin(), _same), "parallel radix sort by projection was not stable");
+	};
+
+	PASS();
+};
+
+// Other range and element types
+int test_ranges(jc::thread_pool& _pool)
+{
+	NEWTEST();
+
+	// Sorting through a span sorts the viewed elements
+	auto _values = make_values<uint64_t>(100000, 3);
+	auto _expected = _values;
+	std::sort(_expected.begin() + 10, _expected.end());
+	jc::radix_sort(jc::span<uint64_t>{ _values.data() + 10, _values.size() - 10 });
+	ASSERT(_values == _expected, "radix sort through a span failed");
+
+	int _array[]{ 5, 3, 9, 1, 7 };
+	jc::sort(_array);
+	ASSERT(std::is_sorted(std::begin(_array), std::end(_array)), "sort of a c-array failed");
+
+	std::vector<std::string> _strings{ "pear", "apple", "fig", "banana" };
+	jc::sort(jc::execution::par, _strings);
+	ASSERT((_strings == std::vector<std::string>{ "apple", "banana", "fig", "pear" }), "parallel sort of strings failed");
+
+	std::vector<test::no_default> _noDefault{};
+	for (int n = 0; n != 50000; ++n)
+	{
+		_noDefault.emplace_back((n * 7919) % 50000);
+	};
+	jc::sort(jc::execution::on(_pool), _noDefault);
+	ASSERT(std::is_sorted(_noDefault.begin(), _noDefault.end()), "sort of elements without a default constructor failed");
+
+	PASS();
+};
+
+#if JCLIB_IS_CONSTANT_EVALUATED_V && (defined(JCLIB_ALGORITHM_H_USE_CUSTOM_ALGORITHMS) || JCLIB_FEATURE_CPP_CONSTEXPR_ALGORITHMS_V)
+constexpr int sort_in_constant_expression()
+{
+	int _data[]{ 9, 4, 7, 1, 8, 2, 6, 3, 5, 0, 19, 14, 17, 11, 18, 12, 16, 13, 15, 10 };
+	jc::sort(_data);
+	for (int n = 0; n != 20; ++n)
+	{
+		if (_data[n] != n)
+		{
+			return n;
+		};
+	};
+	return 20;
+};
+static_assert(sort_in_constant_expression() == 20, "sort must be usable in constant expressions");
+#endif
+
+int main()
+{
+	NEWTEST();
+
+	jc::thread_pool _pool{ 3 };
+
+	SUBTEST(test_comparison_sort<int32_t>, _pool);
+	SUBTEST(test_comparison_sort<uint64_t>, _pool);
+	SUBTEST(test_comparison_sort<double>, _pool);
+	SUBTEST(test_introsort);
+	SUBTEST(test_radix_sort<uint8_t>, _pool);
+	SUBTEST(test_radix_sort<int8_t>, _pool);
+	SUBTEST(test_radix_sort<int16_t>, _pool);
+	SUBTEST(test_radix_sort<uint32_t>, _pool);
+	SUBTEST(test_radix_sort<int32_t>, _pool);
+	SUBTEST(test_radix_sort<int64_t>, _pool);
+	SUBTEST(test_radix_sort<uint64_t>, _pool);
+	SUBTEST(test_radix_floats<float>, _pool);
+	SUBTEST(test_radix_floats<double>, _pool);
+	SUBTEST(test_radix_projection, _pool);
+	SUBTEST(test_ranges, _pool);
+
+	PASS();
+};
@@ -433,6 +433,32 @@ int test_accumulate()
 
 
 
+// Algorithms must work in constant expressions when constexpr backports are enabled, while runtime calls are
+// sent to the standard library
+#if defined(JCLIB_ALGORITHM_H_USE_CUSTOM_ALGORITHMS) || JCLIB_FEATURE_CPP_CONSTEXPR_ALGORITHMS_V
+constexpr int constexpr_algorithms()
+{
+	int _data[4]{ 1, 2, 3, 4 };
+	int _copy[4]{};
+
+	jc::fill(_copy, 7);
+	if (!jc::contains(_copy, 7))
+	{
+		return -1;
+	};
+
+	jc::copy(_data, jc::begin(_copy));
+	if (*jc::find_if(_copy, jc::equals & 3) != 3 || jc::contains_if(_copy, jc::equals & 7))
+	{
+		return -2;
+	};
+
+	return jc::accumulate(_copy);
+};
+static_assert(constexpr_algorithms() == 10, "algorithms must be usable in constant expressions");
+#endif
+
+
 
 int main()
 {
@@ -0,0 +1,2 @@
+# parallel view pipeline test driver
+JCLIB_ADD_TEST("execution-pipeline" "${CMAKE_CURRENT_LIST_DIR}/pipeline.cpp")
@@ -0,0 +1,155 @@
+#include <jclib/algorithm.h>
+#include <jclib/execution.h>
+#include <jclib/ranges.h>
+#include <jclib-test.hpp>
+
+#include <vector>
+#include <list>
+#include <string>
+#include <atomic>
+#include <cstdint>
+
+namespace test
+{
+	// Filter passing multiples of a value
+	struct multiple_of
+	{
+		bool operator()(uint64_t v) const noexcept
+		{
+			return v % this->divisor == 0;
+		};
+		uint64_t divisor;
+	};
+
+	inline uint64_t square(uint64_t v) noexcept
+	{
+		return v * v;
+	};
+};
+
+static_assert(jc::ranges::impl::is_chunkable_pipeline<
+	jc::ranges::filter_view<std::vector<uint64_t>, test::multiple_of>>::value, "filter view over a vector must be splittable");
+static_assert(!jc::ranges::impl::is_chunkable_pipeline<
+	jc::ranges::filter_view<std::list<uint64_t>, test::multiple_of>>::value, "filter view over a list can't be split");
+
+// Filter and transform pipelines over random access ranges, compared against a sequential loop
+int test_pipeline_reduce()
+{
+	NEWTEST();
+
+	jc::thread_pool _pool{ 3 };
+
+	for (size_t _count : { 0, 1, 100, 5000, 100000 })
+	{
+		std::vector<uint64_t> _data(_count);
+		for (size_t n = 0; n != _count; ++n)
+		{
+			_data[n] = n;
+		};
+
+		for (uint64_t _divisor : { 1, 3, 7919, 1000000 })
+		{
+			uint64_t _expected = 0;
+			for (auto v : _data)
+			{
+				if (v % _divisor == 0)
+				{
+					_expected += v * v;
+				};
+			};
+
+			// Views refer to the view they adapt so each stage is kept as a named view
+			auto _filtered = _data | jc::views::filter(test::multiple_of{ _divisor });
+			auto _pipeline = _filtered | jc::views::transform(&test::square);
+			ASSERT(jc::reduce(jc::execution::on(_pool), _pipeline) == _expected, "parallel reduce over a pipeline mismatch");
+			ASSERT(jc::reduce(jc::execution::seq, _pipeline) == _expected, "sequential reduce over a pipeline mismatch");
+			ASSERT(jc::reduce(jc::execution::on(_pool), _data | jc::views::filter(test::multiple_of{ _divisor }) | jc::views::transform(&test::square)) == _expected,
+				"parallel reduce over a temporary pipeline mismatch");
+
+			ASSERT(jc::transform_reduce(jc::execution::par, _filtered, &test::square, jc::plus, uint64_t(5)) == _expected + 5,
+				"parallel transform_reduce over a filter view mismatch");
+		};
+	};
+
+	// Nested filters, chunks which pass nothing must not contribute
+	std::vector<uint64_t> _data(60000, 1);
+	_data[12345] = 6;
+	_data[54321] = 12;
+	auto _evens = _data | jc::views::filter(test::multiple_of{ 2 });
+	auto _nested = _evens | jc::views::filter(test::multiple_of{ 3 });
+	ASSERT(jc::reduce(jc::execution::on(_pool), _nested) == 18, "parallel reduce over nested filters mismatch");
+
+	PASS();
+};
+
+// Chunks of a pipeline are combined in order
+int test_pipeline_order()
+{
+	NEWTEST();
+
+	jc::thread_pool _pool{ 3 };
+	std::vector<uint64_t> _data(30000);
+	std::string _expected{};
+	for (size_t n = 0; n != _data.size(); ++n)
+	{
+		_data[n] = n;
+		if (n % 3 == 0)
+		{
+			_expected += static_cast<char>('a' + n % 26);
+		};
+	};
+
+	auto _filtered = _data | jc::views::filter(test::multiple_of{ 3 });
+	auto _letters = _filtered | jc::views::transform([](uint64_t v) { return std::string(1, static_cast<char>('a' + v % 26)); });
+	ASSERT(jc::reduce(jc::execution::on(_pool), _letters) == _expected, "parallel reduce over a pipeline combined chunks out of order");
+
+	PASS();
+};
+
+// Parallel for_each over plain ranges and pipelines
+int test_for_each()
+{
+	NEWTEST();
+
+	jc::thread_pool _pool{ 3 };
+	std::vector<uint64_t> _data(100000);
+	for (size_t n = 0; n != _data.size(); ++n)
+	{
+		_data[n] = n;
+	};
+
+	// Writes through a random access range
+	std::vector<uint64_t> _copy = _data;
+	jc::for_each(jc::execution::on(_pool), _copy, [](uint64_t& v) { v *= 2; });
+	ASSERT(_copy[99999] == 199998 && _copy[1] == 2, "parallel for_each over a vector failed");
+
+	// Visits every element passing a pipeline exactly once
+	std::atomic<uint64_t> _sum{ 0 };
+	std::atomic<size_t> _visits{ 0 };
+	auto _filtered = _data | jc::views::filter(test::multiple_of{ 5 });
+	auto _pipeline = _filtered | jc::views::transform(&test::square);
+	jc::for_each(jc::execution::on(_pool), _pipeline, [&](uint64_t v)
+	{
+		_sum += v;
+		++_visits;
+	});
+	ASSERT(_visits == 20000 && _sum == jc::reduce(jc::execution::seq, _pipeline), "parallel for_each over a pipeline failed");
+
+	// Ranges which can't be split are processed sequentially
+	const std::list<uint64_t> _list{ 1, 2, 3 };
+	uint64_t _listSum = 0;
+	jc::for_each(jc::execution::par, _list | jc::views::transform(&test::square), [&](uint64_t v) { _listSum += v; });
+	ASSERT(_listSum == 14 && jc::reduce(jc::execution::par, _list | jc::views::transform(&test::square)) == 14,
+		"for_each and reduce over a list pipeline failed");
+
+	PASS();
+};
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(test_pipeline_reduce);
+	SUBTEST(test_pipeline_order);
+	SUBTEST(test_for_each);
+	PASS();
+};
@@ -0,0 +1,2 @@
+# reduce test driver
+JCLIB_ADD_TEST("reduce" "${CMAKE_CURRENT_LIST_DIR}/reduce.cpp")
@@ -0,0 +1,83 @@
+#include <jclib/algorithm.h>
+#include <jclib/execution.h>
+#include <jclib-test.hpp>
+
+#include <vector>
+#include <list>
+#include <string>
+#include <cstdint>
+
+int test_reduce()
+{
+	NEWTEST();
+
+	jc::thread_pool _pool{ 3 };
+
+	for (size_t _count : { 0, 1, 100, 4096, 100000 })
+	{
+		std::vector<uint64_t> _data(_count);
+		for (size_t n = 0; n != _count; ++n)
+		{
+			_data[n] = n;
+		};
+		const uint64_t _expected = (_count == 0) ? 0 : (_count * (_count - 1)) / 2;
+
+		ASSERT(jc::reduce(jc::execution::seq, _data) == _expected, "sequential reduce mismatch");
+		ASSERT(jc::reduce(jc::execution::par, _data) == _expected, "parallel reduce mismatch");
+		ASSERT(jc::reduce(jc::execution::par_unseq, _data) == _expected, "parallel unsequenced reduce mismatch");
+		ASSERT(jc::reduce(jc::execution::on(_pool), _data) == _expected, "thread pool reduce mismatch");
+		ASSERT(jc::reduce(jc::execution::on(_pool), _data, jc::plus, uint64_t(10)) == _expected + 10, "reduce ignored initial value");
+	};
+
+	PASS();
+};
+
+int test_order()
+{
+	NEWTEST();
+
+	// String concatenation is associative but not commutative, the chunks must be combined in order
+	jc::thread_pool _pool{ 3 };
+	std::vector<std::string> _data(20000);
+	std::string _expected{};
+	for (size_t n = 0; n != _data.size(); ++n)
+	{
+		_data[n] = std::string(1, static_cast<char>('a' + n % 26));
+		_expected += _data[n];
+	};
+
+	ASSERT(jc::reduce(jc::execution::on(_pool), _data) == _expected, "parallel reduce combined chunks out of order");
+
+	PASS();
+};
+
+int test_transform_reduce()
+{
+	NEWTEST();
+
+	jc::thread_pool _pool{ 2 };
+	std::vector<int> _data(50000, 3);
+
+	const auto _square = [](int v) { return static_cast<int64_t>(v) * v; };
+	ASSERT(jc::transform_reduce(jc::execution::on(_pool), _data, _square) == int64_t(50000) * 9, "transform_reduce mismatch");
+	ASSERT(jc::transform_reduce(jc::execution::par, _data, _square, jc::plus, int64_t(1)) == int64_t(50000) * 9 + 1,
+		"transform_reduce ignored initial value");
+
+	ASSERT(jc::transform_reduce(jc::execution::on(_pool), _data, [](int v) { return v == 3; }, [](bool a, bool b) { return a && b; }, true),
+		"bool transform_reduce mismatch");
+
+	// Ranges without random access are reduced sequentially
+	const std::list<int> _list{ 1, 2, 3, 4 };
+	ASSERT(jc::reduce(jc::execution::par, _list) == 10, "reduce over list mismatch");
+
+	PASS();
+};
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(test_reduce);
+	SUBTEST(test_order);
+	SUBTEST(test_transform_reduce);
+	PASS();
+};
@@ -0,0 +1,2 @@
+# thread_pool test driver
+JCLIB_ADD_TEST("thread_pool" "${CMAKE_CURRENT_LIST_DIR}/thread_pool.cpp")
@@ -0,0 +1,124 @@
+#include <jclib/thread_pool.h>
+#include <jclib-test.hpp>
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <stdexcept>
+#include <cstdint>
+
+int test_for_each_index()
+{
+	NEWTEST();
+
+	jc::thread_pool _pool{ 3 };
+	ASSERT(_pool.size() == 3, "pool has the wrong number of threads");
+
+	for (size_t _count : { 0, 1, 2, 7, 1000 })
+	{
+		std::vector<int> _hits(_count, 0);
+		_pool.for_each_index(_count, [&](size_t n) { ++_hits[n]; });
+		for (auto& v : _hits)
+		{
+			ASSERT(v == 1, "index was not run exactly once");
+		};
+	};
+
+	PASS();
+};
+
+int test_nested()
+{
+	NEWTEST();
+
+	// Every worker blocks in a nested call, the calling threads must still finish the work themselves
+	jc::thread_pool _pool{ 2 };
+	std::atomic<size_t> _total{ 0 };
+	_pool.for_each_index(8, [&](size_t)
+	{
+		_pool.for_each_index(100, [&](size_t n) { _total += n; });
+	});
+	ASSERT(_total == 8 * 4950, "nested for_each_index did not run every index");
+
+	PASS();
+};
+
+int test_submit()
+{
+	NEWTEST();
+
+	std::atomic<int> _count{ 0 };
+	{
+		jc::thread_pool _pool{ 2 };
+		for (int n = 0; n != 50; ++n)
+		{
+			_pool.submit([&_count]() { ++_count; });
+		};
+	};
+	ASSERT(_count == 50, "queued tasks were not all run before the pool was destroyed");
+
+	PASS();
+};
+
+int test_empty_pool()
+{
+	NEWTEST();
+
+	jc::thread_pool _pool{ 0 };
+	int _sum = 0;
+	_pool.for_each_index(10, [&](size_t n) { _sum += static_cast<int>(n); });
+	ASSERT(_sum == 45, "pool without workers must run everything on the calling thread");
+
+	PASS();
+};
+
+int test_exception()
+{
+	NEWTEST();
+
+	// An exception on the calling thread is only rethrown once the workers have stopped invoking the function
+	jc::thread_pool _pool{ 2 };
+	const auto _caller = std::this_thread::get_id();
+	std::atomic<size_t> _workerRuns{ 0 };
+	bool _thrown = false;
+	try
+	{
+		_pool.for_each_index(1000, [&](size_t)
+		{
+			if (std::this_thread::get_id() == _caller)
+			{
+				throw std::runtime_error("calling thread");
+			};
+			std::this_thread::sleep_for(std::chrono::microseconds(200));
+			++_workerRuns;
+		});
+	}
+	catch (const std::runtime_error&)
+	{
+		_thrown = true;
+	};
+	ASSERT(_thrown, "exception from the calling thread was not rethrown");
+
+	const size_t _runs = _workerRuns;
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	ASSERT(_workerRuns == _runs && _runs < 1000, "workers kept running after the exception was rethrown");
+
+	// The pool is still usable afterwards
+	std::atomic<size_t> _total{ 0 };
+	_pool.for_each_index(100, [&](size_t n) { _total += n; });
+	ASSERT(_total == 4950, "for_each_index after an exception did not run every index");
+
+	PASS();
+};
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(test_for_each_index);
+	SUBTEST(test_nested);
+	SUBTEST(test_submit);
+	SUBTEST(test_empty_pool);
+	SUBTEST(test_exception);
+	PASS();
+};
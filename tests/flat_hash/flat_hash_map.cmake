@@ -0,0 +1,2 @@
+# flat_hash_map test driver
+JCLIB_ADD_TEST("flat_hash_map" "${CMAKE_CURRENT_LIST_DIR}/flat_hash_map.cpp")
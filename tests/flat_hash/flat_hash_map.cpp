@@ -0,0 +1,220 @@
+#include <jclib/flat_hash_map.h>
+#include <jclib-test.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <random>
+#include <cstdint>
+
+#if JCLIB_FEATURE_STRING_VIEW_V
+#include <string_view>
+#endif
+
+// Counts live instances to check every element is destroyed exactly once
+struct counted
+{
+	static int& live()
+	{
+		static int _count = 0;
+		return _count;
+	};
+
+	int value = 0;
+
+	counted(int _value) : value{ _value } { ++live(); };
+	counted(const counted& other) : value{ other.value } { ++live(); };
+	counted(counted&& other) noexcept : value{ other.value } { ++live(); };
+	counted& operator=(const counted&) = default;
+	counted& operator=(counted&&) = default;
+	~counted() { --live(); };
+};
+
+
+
+int subtest_basic()
+{
+	NEWTEST();
+
+	jc::flat_hash_map<int, std::string> _map{};
+	ASSERT(_map.empty() && _map.size() == 0, "new map should be empty");
+	ASSERT(_map.find(1) == _map.end(), "found key in empty map");
+	ASSERT(_map.begin() == _map.end(), "empty map begin should be end");
+
+	const auto _inserted = _map.insert({ 1, "one" });
+	ASSERT(_inserted.second && _inserted.first->first == 1 && _inserted.first->second == "one", "insert failed");
+	ASSERT(!_map.insert({ 1, "uno" }).second, "insert replaced an existing key");
+	ASSERT(_map.at(1) == "one", "insert should not overwrite");
+
+	ASSERT(_map.emplace(2, "two").second, "emplace failed");
+	ASSERT(_map.try_emplace(3, "three").second, "try_emplace failed");
+	ASSERT(!_map.try_emplace(3, "tres").second, "try_emplace replaced an existing key");
+	_map[4] = "four";
+	ASSERT(_map.insert_or_assign(4, "cuatro").second == false && _map[4] == "cuatro", "insert_or_assign failed");
+
+	ASSERT(_map.size() == 4, "wrong size");
+	ASSERT(_map.contains(2) && _map.count(2) == 1 && !_map.contains(5) && _map.count(5) == 0, "contains/count failed");
+
+	ASSERT(_map.erase(2) == 1 && _map.erase(2) == 0, "erase by key failed");
+	ASSERT(!_map.contains(2) && _map.size() == 3, "erase did not remove the key");
+
+	size_t _count = 0;
+	for (auto& v : _map)
+	{
+		ASSERT(v.first != 2, "erased key visited");
+		++_count;
+	};
+	ASSERT(_count == _map.size(), "iteration visited the wrong number of elements");
+
+	_map.clear();
+	ASSERT(_map.empty() && _map.find(1) == _map.end(), "clear failed");
+
+	PASS();
+};
+
+int subtest_random()
+{
+	NEWTEST();
+
+	// Compare against std::unordered_map through many inserts and erases, exercising deleted slot reuse
+	jc::flat_hash_map<uint64_t, uint64_t> _map{};
+	std::unordered_map<uint64_t, uint64_t> _expected{};
+
+	std::mt19937_64 _rng{ 12345 };
+	for (int n = 0; n != 200000; ++n)
+	{
+		const uint64_t _key = _rng() % 5000;
+		switch (_rng() % 4)
+		{
+		case 0:
+		case 1:
+		{
+			const auto _a = _map.insert({ _key, static_cast<uint64_t>(n) });
+			const auto _b = _expected.insert({ _key, static_cast<uint64_t>(n) });
+			ASSERT(_a.second == _b.second, "insert result mismatch");
+			break;
+		}
+		case 2:
+			ASSERT(_map.erase(_key) == _expected.erase(_key), "erase result mismatch");
+			break;
+		default:
+		{
+			const auto _it = _map.find(_key);
+			const auto _eit = _expected.find(_key);
+			ASSERT((_it == _map.end()) == (_eit == _expected.end()), "find result mismatch");
+			if (_it != _map.end())
+			{
+				ASSERT(_it->second == _eit->second, "found value mismatch");
+			};
+			break;
+		}
+		};
+		ASSERT(_map.size() == _expected.size(), "size mismatch");
+	};
+
+	size_t _count = 0;
+	for (auto& v : _map)
+	{
+		ASSERT(_expected.at(v.first) == v.second, "iterated value mismatch");
+		++_count;
+	};
+	ASSERT(_count == _expected.size(), "iteration count mismatch");
+
+	// Erase everything by iterator
+	for (auto it = _map.begin(); it != _map.end();)
+	{
+		it = _map.erase(it);
+	};
+	ASSERT(_map.empty() && _map.begin() == _map.end(), "erasing by iterator failed");
+
+	PASS();
+};
+
+int subtest_lifetime()
+{
+	NEWTEST();
+
+	{
+		jc::flat_hash_map<std::string, counted> _map{};
+		for (int n = 0; n != 1000; ++n)
+		{
+			_map.try_emplace(std::to_string(n), n);
+		};
+		ASSERT(counted::live() == 1000, "wrong live count after insert");
+
+		for (int n = 0; n != 1000; n += 2)
+		{
+			_map.erase(std::to_string(n));
+		};
+		ASSERT(counted::live() == 500, "wrong live count after erase");
+
+		auto _copy = _map;
+		ASSERT(counted::live() == 1000, "wrong live count after copy");
+		ASSERT(_copy.size() == 500 && _copy.at("1").value == 1, "copy lost elements");
+
+		auto _moved = std::move(_copy);
+		ASSERT(counted::live() == 1000, "move should not create elements");
+		ASSERT(_copy.empty() && _moved.size() == 500, "move failed");
+
+		_moved.rehash(0);
+		ASSERT(counted::live() == 1000 && _moved.size() == 500 && _moved.at("999").value == 999, "rehash lost elements");
+	};
+	ASSERT(counted::live() == 0, "elements leaked");
+
+	PASS();
+};
+
+int subtest_copy()
+{
+	NEWTEST();
+
+	jc::flat_hash_map<int, int> _map{ { 1, 2 }, { 3, 4 } };
+	auto _copy = _map;
+	ASSERT(_copy == _map, "copies should compare equal");
+	_copy[1] = 5;
+	ASSERT(_copy != _map, "different values should compare unequal");
+	_copy = _map;
+	ASSERT(_copy == _map, "copy assignment failed");
+
+	_map.reserve(1000);
+	ASSERT(_map.capacity() >= 1000 && _map.at(3) == 4, "reserve failed");
+	const auto _capacity = _map.capacity();
+	for (int n = 0; n != 1000; ++n)
+	{
+		_map[n] = n;
+	};
+	ASSERT(_map.capacity() == _capacity, "reserve did not prevent rehashing");
+
+	PASS();
+};
+
+int subtest_heterogeneous()
+{
+	NEWTEST();
+
+	jc::flat_hash_map<std::string, int, jc::transparent<jc::hash_t>, jc::transparent<jc::equals_t>> _map{};
+	_map["foo"] = 1;
+	_map["bar"] = 2;
+
+	ASSERT(_map.find("foo") != _map.end() && _map.at("foo") == 1, "literal lookup failed");
+	ASSERT(_map.contains("bar") && !_map.contains("baz"), "literal contains failed");
+#if JCLIB_FEATURE_STRING_VIEW_V
+	ASSERT(_map.at(std::string_view{ "bar" }) == 2, "string_view lookup failed");
+	ASSERT(_map.erase(std::string_view{ "foo" }) == 1 && !_map.contains("foo"), "string_view erase failed");
+#endif
+
+	PASS();
+};
+
+
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_basic);
+	SUBTEST(subtest_random);
+	SUBTEST(subtest_lifetime);
+	SUBTEST(subtest_copy);
+	SUBTEST(subtest_heterogeneous);
+	PASS();
+};
@@ -0,0 +1,2 @@
+# flat_hash_set test driver
+JCLIB_ADD_TEST("flat_hash_set" "${CMAKE_CURRENT_LIST_DIR}/flat_hash_set.cpp")
@@ -0,0 +1,80 @@
+#include <jclib/flat_hash_set.h>
+#include <jclib-test.hpp>
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <random>
+#include <cstdint>
+
+int subtest_basic()
+{
+	NEWTEST();
+
+	jc::flat_hash_set<int> _set{ 1, 2, 3 };
+	ASSERT(_set.size() == 3 && _set.contains(1) && _set.contains(3) && !_set.contains(4), "initializer list failed");
+	ASSERT(!_set.insert(2).second && _set.insert(4).second, "insert failed");
+	ASSERT(_set.emplace(5).second && _set.size() == 5, "emplace failed");
+	ASSERT(_set.erase(1) == 1 && !_set.contains(1), "erase failed");
+
+	int _sum = 0;
+	for (auto& v : _set)
+	{
+		_sum += v;
+	};
+	ASSERT(_sum == 2 + 3 + 4 + 5, "iteration failed");
+
+	const auto& _const = _set;
+	ASSERT(_const.find(3) != _const.end() && *_const.find(3) == 3, "const find failed");
+
+	PASS();
+};
+
+int subtest_random()
+{
+	NEWTEST();
+
+	jc::flat_hash_set<std::string> _set{};
+	std::unordered_set<std::string> _expected{};
+
+	std::mt19937 _rng{ 42 };
+	for (int n = 0; n != 50000; ++n)
+	{
+		const auto _key = std::to_string(_rng() % 2000);
+		if (_rng() % 3 != 0)
+		{
+			ASSERT(_set.insert(_key).second == _expected.insert(_key).second, "insert result mismatch");
+		}
+		else
+		{
+			ASSERT(_set.erase(_key) == _expected.erase(_key), "erase result mismatch");
+		};
+	};
+	ASSERT(_set.size() == _expected.size(), "size mismatch");
+	for (auto& v : _expected)
+	{
+		ASSERT(_set.contains(v), "missing element");
+	};
+
+	// Small tables fill every slot before growing
+	jc::flat_hash_set<int> _small{};
+	for (int n = 0; n != 64; ++n)
+	{
+		ASSERT(_small.insert(n).second, "insert failed");
+		for (int i = 0; i <= n; ++i)
+		{
+			ASSERT(_small.contains(i), "small table lost an element");
+		};
+		ASSERT(!_small.contains(n + 1), "small table found a missing element");
+	};
+
+	PASS();
+};
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_basic);
+	SUBTEST(subtest_random);
+	PASS();
+};
@@ -0,0 +1,2 @@
+# eytzinger_set test driver
+JCLIB_ADD_TEST("eytzinger_set" "${CMAKE_CURRENT_LIST_DIR}/eytzinger_set.cpp")
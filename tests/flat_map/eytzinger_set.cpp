@@ -0,0 +1,130 @@
+#include <jclib/eytzinger_set.h>
+#include <jclib/ranges.h>
+#include <jclib-test.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+#include <random>
+#include <iterator>
+#include <algorithm>
+#include <cstdint>
+
+static_assert(jc::ranges::is_range<jc::eytzinger_set<int>>::value, "eytzinger_set must be a range");
+
+// Prefetch strides for keys whose size isn't a power of two must still be a power of two
+static_assert(jc::impl::eytzinger_floor_pow2(64 / 12) == 4 && jc::impl::eytzinger_floor_pow2(64 / 24) == 2 &&
+	jc::impl::eytzinger_floor_pow2(16) == 16 && jc::impl::eytzinger_floor_pow2(1) == 1, "eytzinger_floor_pow2 failed");
+
+int subtest_basic()
+{
+	NEWTEST();
+
+	const jc::eytzinger_set<int> _set{ 5, 3, 1, 3, 4, 1, 7 };
+	ASSERT(_set.size() == 5, "duplicates were not removed");
+	ASSERT(std::is_sorted(_set.begin(), _set.end()), "iteration is not in sorted order");
+
+	// Breadth first order of { 1, 3, 4, 5, 7 }
+	const auto _layout = _set.layout();
+	ASSERT(_layout.size() == 5 && _layout[0] == 5 && _layout[1] == 3 && _layout[2] == 7 && _layout[3] == 1 && _layout[4] == 4,
+		"layout is not in Eytzinger order");
+
+	ASSERT(_set.contains(3) && !_set.contains(2) && _set.count(4) == 1, "contains/count failed");
+	ASSERT(*_set.lower_bound(2) == 3 && *_set.upper_bound(3) == 4, "bounds failed");
+	ASSERT(_set.lower_bound(8) == _set.end() && _set.upper_bound(7) == _set.end(), "bounds past the end failed");
+	ASSERT(_set.find(6) == _set.end(), "found a missing element");
+
+	const auto _range = _set.equal_range(4);
+	ASSERT(*_range.first == 4 && *_range.second == 5, "equal_range failed");
+
+	ASSERT(*std::prev(_set.end()) == 7 && *_set.rbegin() == 7, "reverse iteration failed");
+	ASSERT((std::vector<int>(_set.rbegin(), _set.rend()) == std::vector<int>{ 7, 5, 4, 3, 1 }), "reverse iteration order failed");
+
+	const jc::eytzinger_set<int, jc::greater_t> _descending{ 1, 3, 2 };
+	ASSERT(*_descending.begin() == 3 && _descending.contains(2), "greater_t ordering failed");
+
+	const jc::eytzinger_set<int> _sorted{ jc::sorted_unique, { 1, 2, 3 } };
+	ASSERT(_sorted.size() == 3 && _sorted.contains(2), "sorted_unique construction failed");
+
+	const jc::eytzinger_set<int> _empty{};
+	ASSERT(_empty.begin() == _empty.end() && _empty.lower_bound(1) == _empty.end() && !_empty.contains(1), "empty set failed");
+
+	PASS();
+};
+
+// Every size up to a few complete levels, checks iteration and bounds against a sorted vector
+int subtest_sizes()
+{
+	NEWTEST();
+
+	for (size_t _size = 0; _size != 130; ++_size)
+	{
+		std::vector<int> _sorted(_size);
+		for (size_t n = 0; n != _size; ++n)
+		{
+			_sorted[n] = static_cast<int>(n * 2);
+		};
+
+		const jc::eytzinger_set<int> _set{ jc::sorted_unique, _sorted };
+		ASSERT(std::equal(_set.begin(), _set.end(), _sorted.begin(), _sorted.end()), "iteration did not match the sorted elements");
+		ASSERT(std::equal(_set.rbegin(), _set.rend(), _sorted.rbegin(), _sorted.rend()), "reverse iteration did not match the sorted elements");
+
+		for (int v = -1; v <= static_cast<int>(_size * 2); ++v)
+		{
+			const auto _expected = std::lower_bound(_sorted.begin(), _sorted.end(), v) - _sorted.begin();
+			const auto _upper = std::upper_bound(_sorted.begin(), _sorted.end(), v) - _sorted.begin();
+			ASSERT(std::distance(_set.begin(), _set.lower_bound(v)) == _expected, "lower_bound did not match std::lower_bound");
+			ASSERT(std::distance(_set.begin(), _set.upper_bound(v)) == _upper, "upper_bound did not match std::upper_bound");
+		};
+	};
+
+	PASS();
+};
+
+int subtest_random()
+{
+	NEWTEST();
+
+	std::mt19937_64 _rng{ 7 };
+	std::vector<uint64_t> _values(200000);
+	for (auto& v : _values)
+	{
+		v = _rng() % 1000000;
+	};
+
+	const jc::eytzinger_set<uint64_t> _set(_values.begin(), _values.end());
+	const std::set<uint64_t> _expected(_values.begin(), _values.end());
+	ASSERT(_set.size() == _expected.size(), "size mismatch");
+	ASSERT(std::equal(_set.begin(), _set.end(), _expected.begin()), "element mismatch");
+	for (uint64_t n = 0; n < 1000010; n += 7)
+	{
+		const auto _it = _set.lower_bound(n);
+		const auto _expectedIt = _expected.lower_bound(n);
+		ASSERT((_it == _set.end()) == (_expectedIt == _expected.end()), "lower_bound end mismatch");
+		ASSERT(_it == _set.end() || *_it == *_expectedIt, "lower_bound mismatch");
+		ASSERT(_set.contains(n) == (_expected.count(n) != 0), "contains mismatch");
+	};
+
+	PASS();
+};
+
+int subtest_heterogeneous()
+{
+	NEWTEST();
+
+	const jc::eytzinger_set<std::string, jc::transparent<jc::less_t>> _set{ "b", "a", "c" };
+	ASSERT(_set.contains("a") && !_set.contains("d"), "literal lookup failed");
+	ASSERT(*_set.find("c") == "c", "literal find failed");
+
+	PASS();
+};
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_basic);
+	SUBTEST(subtest_sizes);
+	SUBTEST(subtest_random);
+	SUBTEST(subtest_heterogeneous);
+	PASS();
+};
@@ -0,0 +1,2 @@
+# flat_map test driver
+JCLIB_ADD_TEST("flat_map" "${CMAKE_CURRENT_LIST_DIR}/flat_map.cpp")
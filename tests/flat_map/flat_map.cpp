@@ -0,0 +1,163 @@
+#include <jclib/flat_map.h>
+#include <jclib-test.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+
+namespace test
+{
+	// Value whose constructor throws when given a negative value
+	struct throws_if_negative
+	{
+		explicit throws_if_negative(int _value) :
+			value(_value)
+		{
+			if (_value < 0)
+			{
+				throw std::invalid_argument("negative value");
+			};
+		};
+
+		int value;
+	};
+};
+
+int subtest_basic()
+{
+	NEWTEST();
+
+	jc::flat_map<int, std::string> _map{ { 3, "three" }, { 1, "one" }, { 2, "two" }, { 1, "uno" } };
+	ASSERT(_map.size() == 3, "duplicates were not removed");
+	ASSERT(_map.at(1) == "one", "the first value for a duplicate key should be kept");
+
+	const auto _keys = _map.keys();
+	const auto _values = _map.values();
+	ASSERT(_keys.size() == 3 && _keys[0] == 1 && _keys[1] == 2 && _keys[2] == 3, "keys are not sorted");
+	ASSERT(_values[0] == "one" && _values[1] == "two" && _values[2] == "three", "values do not follow their keys");
+
+	int _expectedKey = 1;
+	for (auto it = _map.begin(); it != _map.end(); ++it)
+	{
+		ASSERT((*it).first == _expectedKey && it->first == _expectedKey, "iteration order mismatch");
+		++_expectedKey;
+	};
+	ASSERT(_map.end() - _map.begin() == 3 && _map.begin()[2].second == "three", "random access failed");
+
+	_map.begin()->second = "ONE";
+	ASSERT(_map[1] == "ONE", "assignment through iterator failed");
+
+	ASSERT(_map.try_emplace(0, "zero").second && !_map.try_emplace(0, "nil").second, "try_emplace failed");
+	ASSERT(_map.at(0) == "zero", "try_emplace overwrote a value");
+	_map[5] = "five";
+	ASSERT(!_map.insert_or_assign(5, "FIVE").second && _map.at(5) == "FIVE", "insert_or_assign failed");
+	ASSERT(_map.emplace(4, "four").second && _map.keys()[4] == 4, "emplace failed");
+
+	ASSERT(_map.erase(2) == 1 && !_map.contains(2) && _map.erase(2) == 0, "erase by key failed");
+	const auto _next = _map.erase(_map.find(3));
+	ASSERT(_next != _map.end() && _next->first == 4, "erase by iterator failed");
+
+	ASSERT(_map.lower_bound(2)->first == 4 && _map.upper_bound(4)->first == 5, "bounds failed");
+
+	auto _containers = std::move(_map).extract();
+	ASSERT(_containers.keys.size() == 4 && _containers.values.size() == 4 && _map.empty(), "extract failed");
+
+	PASS();
+};
+
+int subtest_bulk()
+{
+	NEWTEST();
+
+	std::mt19937 _rng{ 99 };
+	std::vector<std::pair<int, int>> _pairs(5000);
+	for (size_t n = 0; n != _pairs.size(); ++n)
+	{
+		_pairs[n] = { static_cast<int>(_rng() % 2000), static_cast<int>(n) };
+	};
+
+	// std::map::insert keeps the first value for each key, like flat_map
+	std::map<int, int> _expected{};
+	for (auto& v : _pairs)
+	{
+		_expected.insert(v);
+	};
+
+	const jc::flat_map<int, int> _map(_pairs.begin(), _pairs.end());
+	ASSERT(_map.size() == _expected.size(), "size mismatch");
+	auto _it = _map.begin();
+	for (auto& v : _expected)
+	{
+		ASSERT(_it->first == v.first && _it->second == v.second, "element mismatch");
+		++_it;
+	};
+
+	// Bulk inserting keeps existing elements
+	jc::flat_map<int, int> _grown{ { 1, -1 }, { 10000, -2 } };
+	_grown.insert(_pairs.begin(), _pairs.end());
+	ASSERT(_grown.at(1) == -1 && _grown.at(10000) == -2, "bulk insert replaced existing elements");
+	ASSERT(_grown.size() == _expected.size() + ((_expected.count(1) == 0) ? 2 : 1), "bulk insert size mismatch");
+
+	// Parallel container construction
+	const jc::flat_map<int, char> _parallel({ 3, 1, 2 }, { 'c', 'a', 'b' });
+	ASSERT(_parallel.keys()[0] == 1 && _parallel.values()[0] == 'a' && _parallel.values()[2] == 'c', "parallel construction failed");
+
+	const jc::flat_map<int, char> _sorted(jc::sorted_unique, { 1, 2, 3 }, { 'a', 'b', 'c' });
+	ASSERT(_sorted == _parallel, "sorted_unique construction failed");
+
+	PASS();
+};
+
+int subtest_heterogeneous()
+{
+	NEWTEST();
+
+	jc::flat_map<std::string, int, jc::transparent<jc::less_t>> _map{ { "foo", 1 }, { "bar", 2 } };
+	ASSERT(_map.at("foo") == 1 && _map.contains("bar") && !_map.contains("baz"), "literal lookup failed");
+	ASSERT(_map.erase("bar") == 1 && _map.size() == 1, "literal erase failed");
+
+	jc::flat_map<int, int, jc::greater_t> _descending{ { 1, 1 }, { 3, 3 }, { 2, 2 } };
+	ASSERT(_descending.keys()[0] == 3 && _descending.at(2) == 2, "greater_t ordering failed");
+
+	PASS();
+};
+
+// A throwing value constructor must leave the keys and values in step
+int subtest_exception_safety()
+{
+	NEWTEST();
+
+	jc::flat_map<int, test::throws_if_negative> _map{};
+	_map.try_emplace(1, 10);
+	_map.try_emplace(3, 30);
+
+	bool _thrown = false;
+	try
+	{
+		_map.try_emplace(2, -1);
+	}
+	catch (const std::invalid_argument&)
+	{
+		_thrown = true;
+	};
+	ASSERT(_thrown, "value constructor did not throw");
+	ASSERT(_map.size() == 2 && _map.keys().size() == _map.values().size() && !_map.contains(2), "failed insert changed the map");
+
+	ASSERT(_map.try_emplace(2, 20).second, "insert after a failed insert failed");
+	ASSERT(_map.at(1).value == 10 && _map.at(2).value == 20 && _map.at(3).value == 30, "keys and values are out of step");
+
+	PASS();
+};
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_basic);
+	SUBTEST(subtest_bulk);
+	SUBTEST(subtest_heterogeneous);
+	SUBTEST(subtest_exception_safety);
+	PASS();
+};
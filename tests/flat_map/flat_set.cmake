@@ -0,0 +1,2 @@
+# flat_set test driver
+JCLIB_ADD_TEST("flat_set" "${CMAKE_CURRENT_LIST_DIR}/flat_set.cpp")
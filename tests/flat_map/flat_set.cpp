@@ -0,0 +1,86 @@
+#include <jclib/flat_set.h>
+#include <jclib-test.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+int subtest_basic()
+{
+	NEWTEST();
+
+	jc::flat_set<int> _set{ 5, 3, 1, 3, 4, 1 };
+	ASSERT(_set.size() == 4, "duplicates were not removed");
+	ASSERT(std::is_sorted(_set.begin(), _set.end()), "elements are not sorted");
+
+	const auto _keys = _set.keys();
+	ASSERT(_keys.size() == 4 && _keys[0] == 1 && _keys[3] == 5, "keys span mismatch");
+
+	ASSERT(_set.contains(3) && !_set.contains(2) && _set.count(4) == 1, "contains/count failed");
+	ASSERT(*_set.lower_bound(2) == 3 && *_set.upper_bound(3) == 4, "bounds failed");
+	ASSERT(_set.find(2) == _set.end(), "found a missing element");
+
+	ASSERT(_set.insert(2).second && !_set.insert(2).second, "insert failed");
+	ASSERT(_set.erase(3) == 1 && _set.erase(3) == 0, "erase failed");
+	ASSERT((_set == jc::flat_set<int>{ 1, 2, 4, 5 }), "wrong elements after insert/erase");
+
+	_set.insert({ 9, 0, 4, 7 });
+	ASSERT((_set == jc::flat_set<int>{ 0, 1, 2, 4, 5, 7, 9 }), "bulk insert failed");
+
+	auto _container = std::move(_set).extract();
+	ASSERT(_container.size() == 7 && _set.empty(), "extract failed");
+
+	const jc::flat_set<int, jc::greater_t> _descending{ 1, 3, 2 };
+	ASSERT(_descending.keys()[0] == 3 && _descending.keys()[2] == 1, "greater_t ordering failed");
+	ASSERT(_descending.contains(2), "lookup with greater_t failed");
+
+	const jc::flat_set<int> _sorted{ jc::sorted_unique, { 1, 2, 3 } };
+	ASSERT(_sorted.size() == 3 && _sorted.contains(2), "sorted_unique construction failed");
+
+	PASS();
+};
+
+int subtest_random()
+{
+	NEWTEST();
+
+	std::mt19937 _rng{ 7 };
+	std::vector<int> _values(5000);
+	for (auto& v : _values)
+	{
+		v = static_cast<int>(_rng() % 3000);
+	};
+
+	const jc::flat_set<int> _set(_values.begin(), _values.end());
+	const std::set<int> _expected(_values.begin(), _values.end());
+	ASSERT(_set.size() == _expected.size(), "size mismatch");
+	ASSERT(std::equal(_set.begin(), _set.end(), _expected.begin()), "element mismatch");
+	for (int n = -10; n != 3010; ++n)
+	{
+		ASSERT(_set.contains(n) == (_expected.count(n) != 0), "contains mismatch");
+	};
+
+	PASS();
+};
+
+int subtest_heterogeneous()
+{
+	NEWTEST();
+
+	const jc::flat_set<std::string, jc::transparent<jc::less_t>> _set{ "b", "a", "c" };
+	ASSERT(_set.contains("a") && !_set.contains("d"), "literal lookup failed");
+	ASSERT(*_set.find("c") == "c", "literal find failed");
+
+	PASS();
+};
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_basic);
+	SUBTEST(subtest_random);
+	SUBTEST(subtest_heterogeneous);
+	PASS();
+};
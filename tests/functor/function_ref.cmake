@@ -0,0 +1,2 @@
+# function_ref test driver
+JCLIB_ADD_TEST("functor-function_ref" "${CMAKE_CURRENT_LIST_DIR}/function_ref.cpp")
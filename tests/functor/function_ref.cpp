@@ -0,0 +1,154 @@
+#include <jclib/functor.h>
+#include <jclib-test.hpp>
+
+#include <utility>
+
+
+
+int add_one(int _a)
+{
+	return _a + 1;
+};
+
+struct counter
+{
+	int add(int _a)
+	{
+		this->count_ += _a;
+		return this->count_;
+	};
+	int get(int _a) const
+	{
+		return this->count_ + _a;
+	};
+
+	int count_ = 0;
+};
+
+// Invokes a callback through a function_ref parameter
+int call_with(jc::function_ref<int(int)> _fn, int _value)
+{
+	return _fn(_value);
+};
+
+
+
+int subtest_construction()
+{
+	NEWTEST();
+
+	static_assert(sizeof(jc::function_ref<int(int)>) == sizeof(void*) * 2, "function_ref is larger than two pointers");
+	static_assert(std::is_trivially_copyable<jc::function_ref<int(int)>>::value, "function_ref is not trivially copyable");
+	static_assert(!std::is_default_constructible<jc::function_ref<int(int)>>::value, "function_ref should not be default constructible");
+	static_assert(!std::is_constructible<jc::function_ref<int(int)>, int>::value, "function_ref constructible from non-callable");
+	static_assert(!std::is_constructible<jc::function_ref<int(int)>, int(*)(int, int)>::value, "function_ref constructible from mismatched signature");
+
+	PASS();
+};
+
+int subtest_free_function()
+{
+	NEWTEST();
+
+	jc::function_ref<int(int)> _fn = &add_one;
+	ASSERT(_fn(1) == 2, "free function invocation failed");
+	ASSERT(_fn.invoke(2) == 3, "free function invoke() failed");
+	ASSERT(call_with(&add_one, 4) == 5, "free function parameter failed");
+
+	// Captureless lambdas decay to a function pointer
+	ASSERT(call_with([](int _a) { return _a * 2; }, 4) == 8, "captureless lambda failed");
+
+	PASS();
+};
+
+int subtest_function_object()
+{
+	NEWTEST();
+
+	int _total = 0;
+	auto _lambda = [&_total](int _a) { _total += _a; return _total; };
+
+	jc::function_ref<int(int)> _fn = _lambda;
+	ASSERT(_fn(2) == 2, "lambda invocation failed");
+	ASSERT(_fn(3) == 5, "lambda state not referenced");
+	ASSERT(_total == 5, "lambda capture not referenced");
+
+	// Copies refer to the same object
+	auto _copy = _fn;
+	ASSERT(_copy(1) == 6, "copied function_ref did not refer to the same object");
+
+	// Temporaries live until the end of the full expression
+	ASSERT(call_with([&_total](int _a) { return _total + _a; }, 4) == 10, "temporary lambda parameter failed");
+
+	// Const function objects
+	const auto _constLambda = [](int _a) { return _a - 1; };
+	jc::function_ref<int(int)> _cfn = _constLambda;
+	ASSERT(_cfn(1) == 0, "const lambda invocation failed");
+
+	// Functors can be referenced
+	jc::functor<int(int)> _functor = &add_one;
+	ASSERT(call_with(_functor, 1) == 2, "functor parameter failed");
+
+	PASS();
+};
+
+int subtest_member_function()
+{
+	NEWTEST();
+
+	counter _counter{};
+
+	jc::function_ref<int(int)> _fn{ jc::member_function_t<decltype(&counter::add), &counter::add>{}, &_counter };
+	ASSERT(_fn(2) == 2, "member function invocation failed");
+	ASSERT(_fn(3) == 5, "member function object not referenced");
+
+	const counter& _cref = _counter;
+	jc::function_ref<int(int)> _cfn{ jc::member_function_t<decltype(&counter::get), &counter::get>{}, &_cref };
+	ASSERT(_cfn(1) == 6, "const member function invocation failed");
+
+	const auto _pair = std::make_pair(&counter::add, &_counter);
+	jc::function_ref<int(int)> _pfn = _pair;
+	ASSERT(_pfn(1) == 6, "member function pair invocation failed");
+
+#if defined(__cpp_nontype_template_parameter_auto) && JCLIB_FEATURE_INLINE_VARIABLES_V
+	jc::function_ref<int(int)> _afn{ jc::member_function<&counter::add>, &_counter };
+	ASSERT(_afn(1) == 7, "member_function tag invocation failed");
+#endif
+
+	PASS();
+};
+
+#ifdef __cpp_noexcept_function_type
+int subtest_noexcept()
+{
+	NEWTEST();
+
+	auto _lambda = [](int _a) noexcept { return _a + 2; };
+	auto _throwing = [](int _a) { return _a + 2; };
+
+	static_assert(std::is_constructible<jc::function_ref<int(int) noexcept>, decltype(_lambda)&>::value, "");
+	static_assert(!std::is_constructible<jc::function_ref<int(int) noexcept>, decltype(_throwing)&>::value,
+		"noexcept function_ref constructible from throwing function object");
+
+	jc::function_ref<int(int) noexcept> _fn = _lambda;
+	static_assert(noexcept(_fn(1)), "noexcept function_ref invocation is not noexcept");
+	ASSERT(_fn(1) == 3, "noexcept invocation failed");
+
+	PASS();
+};
+#endif
+
+
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_construction);
+	SUBTEST(subtest_free_function);
+	SUBTEST(subtest_function_object);
+	SUBTEST(subtest_member_function);
+#ifdef __cpp_noexcept_function_type
+	SUBTEST(subtest_noexcept);
+#endif
+	PASS();
+};
@@ -0,0 +1,2 @@
+# functor test driver
+JCLIB_ADD_TEST("functor" "${CMAKE_CURRENT_LIST_DIR}/test.cpp")
@@ -1,5 +1,31 @@
 
 #include <jclib/functor.h>
+#include <jclib/functional.h>
+
+#include <cstdlib>
+#include <new>
+#include <array>
+
+// Counts global heap allocations so the functor storage can be checked
+static size_t allocation_count = 0;
+
+void* operator new(size_t _size)
+{
+	++allocation_count;
+	if (void* _ptr = std::malloc(_size))
+	{
+		return _ptr;
+	};
+	throw std::bad_alloc{};
+};
+void operator delete(void* _ptr) noexcept
+{
+	std::free(_ptr);
+};
+void operator delete(void* _ptr, size_t) noexcept
+{
+	std::free(_ptr);
+};
 
 int foo(int _a, int _b)
 {
@@ -110,6 +136,81 @@ int main()
 		return -1;
 
 
+	{
+		// Test that builtin function objects are stored inline
+		static_assert(jc::is_functor_inline<int(*)(int, int)>::value, "free function pointer should fit in functor storage");
+		static_assert(!jc::is_functor_inline<char[jc::impl::functor_storage_size + 1]>::value, "oversized type should not fit in functor storage");
+
+		const auto _allocations = allocation_count;
+
+		jc::functor<int(int, int)> _free{ &foo };
+		jc::functor<int(int, int)> _member{ &Bar::foobar, &_b };
+		jc::functor<int(int, int)> _copy{ _member };
+		jc::functor<int(int, int)> _moved{ std::move(_copy) };
+
+		_free = &foo_noexcept;
+		_moved = _free;
+		_moved = std::move(_member);
+
+		if (_free(2, 2) != 4 || _moved(2, 2) != 4)
+			return -1;
+
+		if (_member.good() || !_moved.good())
+			return -1;
+
+		if (allocation_count != _allocations)
+			return -1;
+	};
+
+	{
+		// Test stateful lambdas
+		int _total = 0;
+		jc::functor<int(int)> _lambda = [&_total](int _a) { _total += _a; return _total; };
+		if (_lambda(2) != 2 || _lambda(3) != 5 || _total != 5)
+			return -1;
+
+		// Mutable state is owned by the functor
+		jc::functor<int()> _counter = [n = 0]() mutable { return ++n; };
+		if (_counter() != 1 || _counter() != 2)
+			return -1;
+
+		// Copies hold their own state
+		auto _counterCopy = _counter;
+		if (_counterCopy() != 3 || _counter() != 3)
+			return -1;
+
+		// Non-void results may be discarded
+		jc::functor<void(int)> _discard = [](int _a) { return _a; };
+		_discard(1);
+	};
+
+	{
+		// Test composed function objects
+		jc::functor<int(int, int)> _wrapped = jc::call([](int _a, int _b) { return _a * _b; });
+		if (_wrapped(2, 3) != 6)
+			return -1;
+
+		jc::functor<bool(int, int)> _piped = jc::plus | (jc::equals & 4);
+		if (!_piped(2, 2) || _piped(2, 3))
+			return -1;
+	};
+
+	{
+		// Test function objects too large for the inline storage
+		std::array<int, 32> _values{};
+		_values.back() = 7;
+
+		const auto _allocations = allocation_count;
+		jc::functor<int(int)> _large = [_values](int _a) { return _values.back() + _a; };
+		if (allocation_count == _allocations)
+			return -1;
+		
+		auto _largeCopy = _large;
+		auto _largeMoved = std::move(_large);
+		if (_large.good() || _largeCopy(1) != 8 || _largeMoved(2) != 9)
+			return -1;
+	};
+
 	{
 		// Test const member function
 		struct ConstFoo
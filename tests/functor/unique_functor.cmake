@@ -0,0 +1,2 @@
+# unique_functor test driver
+JCLIB_ADD_TEST("functor-unique_functor" "${CMAKE_CURRENT_LIST_DIR}/unique_functor.cpp")
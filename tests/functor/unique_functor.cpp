@@ -0,0 +1,129 @@
+#include <jclib/functor.h>
+#include <jclib/unique.h>
+#include <jclib-test.hpp>
+
+#include <memory>
+#include <array>
+#include <utility>
+
+// Counts how many times a handle was cleaned up
+static int reset_count = 0;
+
+struct counted_handle_traits
+{
+	using value_type = int;
+	static void reset(value_type&&) { ++reset_count; };
+	static value_type null() { return 0; };
+	static bool good(const value_type& v) { return v != null(); };
+};
+using counted_handle = jc::unique_value<int, counted_handle_traits>;
+
+int add(int _a, int _b)
+{
+	return _a + _b;
+};
+
+
+
+int subtest_traits()
+{
+	NEWTEST();
+
+	using unique_type = jc::unique_functor<int(int)>;
+	using copyable_type = jc::functor<int(int)>;
+
+	auto _moveOnly = [p = std::unique_ptr<int>{}](int _a) { return _a; };
+	using move_only_lambda = decltype(_moveOnly);
+
+	static_assert(!std::is_copy_constructible<unique_type>::value, "unique_functor should not be copy constructible");
+	static_assert(!std::is_copy_assignable<unique_type>::value, "unique_functor should not be copy assignable");
+	static_assert(std::is_nothrow_move_constructible<unique_type>::value, "unique_functor should be nothrow move constructible");
+	static_assert(std::is_nothrow_move_assignable<unique_type>::value, "unique_functor should be nothrow move assignable");
+
+	static_assert(std::is_copy_constructible<copyable_type>::value, "functor should be copy constructible");
+	static_assert(std::is_nothrow_move_constructible<copyable_type>::value, "functor should be nothrow move constructible");
+
+	static_assert(std::is_constructible<unique_type, move_only_lambda>::value, "unique_functor should accept move-only function objects");
+	static_assert(!std::is_constructible<copyable_type, move_only_lambda>::value, "functor should reject move-only function objects");
+
+	static_assert(std::is_constructible<unique_type, copyable_type&&>::value, "unique_functor should be constructible from a moved functor");
+	static_assert(!std::is_constructible<copyable_type, unique_type&&>::value, "functor should not be constructible from a unique_functor");
+
+	PASS();
+};
+
+int subtest_move_only()
+{
+	NEWTEST();
+
+	{
+		jc::unique_functor<int(int)> _fn = [p = std::make_unique<int>(2)](int _a) { return *p + _a; };
+		ASSERT(_fn(1) == 3, "move-only lambda invocation failed");
+
+		auto _moved = std::move(_fn);
+		ASSERT(!_fn.good(), "moved from unique_functor should be empty");
+		ASSERT(_moved(2) == 4, "moved unique_functor invocation failed");
+
+		_fn = std::move(_moved);
+		ASSERT(!_moved.good() && _fn(3) == 5, "move assigned unique_functor invocation failed");
+	};
+
+	// Owned handles are cleaned up exactly once
+	reset_count = 0;
+	{
+		jc::unique_functor<int()> _fn = [h = counted_handle{ 4 }]() { return h.get(); };
+		ASSERT(_fn() == 4, "unique_value capture invocation failed");
+
+		jc::unique_functor<int()> _moved{ std::move(_fn) };
+		ASSERT(_moved() == 4, "moved unique_value capture invocation failed");
+		ASSERT(reset_count == 0, "unique_value capture was cleaned up early");
+	};
+	ASSERT(reset_count == 1, "unique_value capture was not cleaned up exactly once");
+
+	// Large move-only state is moved by pointer
+	{
+		auto _buffer = std::make_unique<std::array<int, 64>>();
+		_buffer->back() = 7;
+		auto _large = [b = std::move(_buffer), padding = std::array<int, 16>{}](int _a) { return b->back() + padding.back() + _a; };
+		static_assert(!jc::is_functor_inline<decltype(_large)>::value, "expected a heap allocated function object");
+
+		jc::unique_functor<int(int)> _fn = std::move(_large);
+		auto _moved = std::move(_fn);
+		ASSERT(!_fn.good() && _moved(1) == 8, "large move-only lambda invocation failed");
+	};
+
+	PASS();
+};
+
+int subtest_from_functor()
+{
+	NEWTEST();
+
+	jc::functor<int(int, int)> _copyable = &add;
+	jc::unique_functor<int(int, int)> _unique = std::move(_copyable);
+	ASSERT(!_copyable.good(), "moved from functor should be empty");
+	ASSERT(_unique(1, 2) == 3, "unique_functor constructed from functor invocation failed");
+
+	int _offset = 3;
+	_copyable = [_offset](int _a, int _b) { return _a + _b + _offset; };
+	_unique = std::move(_copyable);
+	ASSERT(!_copyable.good() && _unique(1, 2) == 6, "unique_functor assigned from functor invocation failed");
+
+	// Copies clone the held function object
+	jc::functor<int()> _counter = [n = 0]() mutable { return ++n; };
+	auto _copy = _counter;
+	ASSERT(_counter() == 1 && _counter() == 2 && _copy() == 1, "functor copies should not share state");
+
+	PASS();
+};
+
+
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_traits);
+	SUBTEST(subtest_move_only);
+	SUBTEST(subtest_from_functor);
+	PASS();
+};
@@ -0,0 +1,2 @@
+# hash test driver
+JCLIB_ADD_TEST("hash" "${CMAKE_CURRENT_LIST_DIR}/hash.cpp")
@@ -0,0 +1,185 @@
+#include <jclib/hash.h>
+#include <jclib/functional.h>
+#include <jclib-test.hpp>
+
+#include <string>
+#include <vector>
+#include <set>
+#include <bitset>
+#include <cstdint>
+
+// Counts how many output bits changed
+int changed_bits(uint64_t _lhs, uint64_t _rhs)
+{
+	return static_cast<int>(std::bitset<64>(_lhs ^ _rhs).count());
+};
+
+
+
+int subtest_bytes()
+{
+	NEWTEST();
+
+	const std::string _text = "the quick brown fox jumps over the lazy dog, again and again and again and again";
+
+	// Every length takes a slightly different path, check each hashes consistently and distinctly
+	std::set<uint64_t> _seen{};
+	for (size_t n = 0; n <= _text.size(); ++n)
+	{
+		const auto _hash = jc::hash_bytes(_text.data(), n);
+		ASSERT(_hash == jc::hash_bytes(_text.data(), n), "hash_bytes is not deterministic");
+		ASSERT(_hash == jc::wyhash_engine::hash_bytes(_text.data(), n, 0), "hash_bytes should use the default engine");
+		_seen.insert(_hash);
+	};
+	ASSERT(_seen.size() == _text.size() + 1, "hash_bytes collided on prefixes");
+
+	// Seeds change the result
+	ASSERT(jc::hash_bytes(_text.data(), _text.size(), 1) != jc::hash_bytes(_text.data(), _text.size(), 2),
+		"hash_bytes ignored the seed");
+
+	// Flipping a single input bit should change roughly half of the output bits
+	std::string _flipped = _text;
+	_flipped[40] ^= 0x01;
+	const int _changed = changed_bits(jc::hash_bytes(_text.data(), _text.size()), jc::hash_bytes(_flipped.data(), _flipped.size()));
+	ASSERT(_changed > 10 && _changed < 54, "hash_bytes avalanche is poor");
+
+	PASS();
+};
+
+int subtest_integer()
+{
+	NEWTEST();
+
+	// Sequential integers must not hash sequentially
+	std::set<uint64_t> _lowBits{};
+	for (uint64_t n = 0; n != 256; ++n)
+	{
+		ASSERT(jc::hash_integer(n) != n, "hash_integer should not be the identity");
+		_lowBits.insert(jc::hash_integer(n) & 0xFF);
+	};
+	ASSERT(_lowBits.size() > 128, "hash_integer low bits are poorly distributed");
+
+	int _totalChanged = 0;
+	for (int n = 0; n != 64; ++n)
+	{
+		_totalChanged += changed_bits(jc::hash_integer(0), jc::hash_integer(uint64_t(1) << n));
+	};
+	ASSERT(_totalChanged > 64 * 20 && _totalChanged < 64 * 44, "hash_integer avalanche is poor");
+
+	ASSERT(jc::hash_integer(5, 1) != jc::hash_integer(5, 2), "hash_integer ignored the seed");
+
+	PASS();
+};
+
+int subtest_operator()
+{
+	NEWTEST();
+
+	// Strings hash the same regardless of how they are held
+	const std::string _str = "hello";
+	ASSERT(jc::hash(_str) == static_cast<size_t>(jc::hash_bytes(_str.data(), _str.size())), "std::string hash mismatch");
+#if JCLIB_FEATURE_STRING_VIEW_V
+	ASSERT(jc::hash(std::string_view{ _str }) == jc::hash(_str), "std::string_view hash mismatch");
+#endif
+	const std::u16string _wstr = u"hello";
+	ASSERT(jc::hash(_wstr) == static_cast<size_t>(jc::hash_bytes(_wstr.data(), _wstr.size() * sizeof(char16_t))), "std::u16string hash mismatch");
+
+	// Integers and enums use the integer mixer
+	enum class colour : int { red = 1 };
+	ASSERT(jc::hash(1) == static_cast<size_t>(jc::hash_integer(1)), "int hash mismatch");
+	ASSERT(jc::hash(colour::red) == jc::hash(1), "enum hash mismatch");
+	ASSERT(jc::hash(2) != 2, "int hash should not be the identity");
+
+	// Other types mix their std::hash value
+	const double _dbl = 2.5;
+	ASSERT(jc::hash(_dbl) == static_cast<size_t>(jc::hash_integer(std::hash<double>{}(_dbl))), "double hash mismatch");
+
+	// Seeded hash
+	const jc::seeded_hash_t _seeded{ 7 };
+	ASSERT(_seeded.seed() == 7, "seeded hash seed mismatch");
+	ASSERT(_seeded(_str) == static_cast<size_t>(jc::hash_bytes(_str.data(), _str.size(), 7)), "seeded string hash mismatch");
+	ASSERT(_seeded(1) != jc::hash(1), "seeded hash ignored the seed");
+	ASSERT(jc::seeded_hash_t{}(1) == jc::hash(1), "default seeded hash should match jc::hash");
+
+	// Piping
+	ASSERT((_str | jc::hash) == jc::hash(_str), "piped hash mismatch");
+
+	PASS();
+};
+
+
+
+// Dispatches on a string using hashed case labels
+int dispatch(const std::string& _name)
+{
+	switch (jc::hash(_name))
+	{
+	case jc::hash("create"):
+		return 1;
+	case jc::hash("destroy"):
+		return 2;
+	case jc::hash("a much longer message name that takes the long input path"):
+		return 3;
+	default:
+		return 0;
+	};
+};
+
+template <size_t Hash>
+struct hash_constant
+{
+	constexpr static size_t value = Hash;
+};
+
+int subtest_constexpr()
+{
+	NEWTEST();
+
+	// String literals hash in constant expressions
+	constexpr auto _hash = jc::hash("hello");
+	static_assert(hash_constant<jc::hash("hello")>::value == _hash, "string literal hash is not a constant expression");
+	static_assert(jc::hash("hello") != jc::hash("hellp"), "string literal hashes collided");
+
+	constexpr jc::seeded_hash_t _seeded{ 3 };
+	static_assert(_seeded("hello") != _hash, "seeded string literal hash ignored the seed");
+
+	// String literals match runtime hashing of the same characters, excluding the null terminator
+	const char* _literals[] =
+	{
+		"", "a", "ab", "abc", "abcd", "hello", "0123456789abcdef", "0123456789abcdefg",
+		"a much longer message name that takes the long input path"
+	};
+	ASSERT(jc::hash("") == jc::hash(std::string{ _literals[0] }), "literal hash mismatch (0)");
+	ASSERT(jc::hash("a") == jc::hash(std::string{ _literals[1] }), "literal hash mismatch (1)");
+	ASSERT(jc::hash("ab") == jc::hash(std::string{ _literals[2] }), "literal hash mismatch (2)");
+	ASSERT(jc::hash("abc") == jc::hash(std::string{ _literals[3] }), "literal hash mismatch (3)");
+	ASSERT(jc::hash("abcd") == jc::hash(std::string{ _literals[4] }), "literal hash mismatch (4)");
+	ASSERT(_hash == jc::hash(std::string{ _literals[5] }), "literal hash mismatch (5)");
+	ASSERT(jc::hash("0123456789abcdef") == jc::hash(std::string{ _literals[6] }), "literal hash mismatch (6)");
+	ASSERT(jc::hash("0123456789abcdefg") == jc::hash(std::string{ _literals[7] }), "literal hash mismatch (7)");
+	ASSERT(jc::hash("a much longer message name that takes the long input path") == jc::hash(std::string{ _literals[8] }),
+		"literal hash mismatch (8)");
+	ASSERT(_seeded("hello") == _seeded(std::string{ "hello" }), "seeded literal hash mismatch");
+
+	// Wide string literals
+	constexpr auto _wide = jc::hash(u"hello wide string literal with many characters");
+	ASSERT(_wide == jc::hash(std::u16string{ u"hello wide string literal with many characters" }), "char16_t literal hash mismatch");
+	ASSERT(jc::hash(U"abc") == jc::hash(std::u32string{ U"abc" }), "char32_t literal hash mismatch");
+
+	ASSERT(dispatch("create") == 1 && dispatch("destroy") == 2 && dispatch("other") == 0, "switch dispatch failed");
+	ASSERT(dispatch("a much longer message name that takes the long input path") == 3, "switch dispatch failed");
+
+	PASS();
+};
+
+
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_bytes);
+	SUBTEST(subtest_integer);
+	SUBTEST(subtest_operator);
+	SUBTEST(subtest_constexpr);
+	PASS();
+};
@@ -0,0 +1,2 @@
+# structural hash test driver
+JCLIB_ADD_TEST("hash-structural" "${CMAKE_CURRENT_LIST_DIR}/structural.cpp")
@@ -0,0 +1,184 @@
+#include <jclib/functional.h>
+#include <jclib/span.h>
+#include <jclib/optional.h>
+#include <jclib/maybe.h>
+#include <jclib-test.hpp>
+
+#include <string>
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <cstdint>
+#include <cstring>
+
+namespace test
+{
+	// Simple user type hashed through the hash_traits customization point
+	struct point
+	{
+		int x;
+		int y;
+	};
+
+	// Type with padding between members, must be hashed per element
+	struct padded
+	{
+		char c;
+		int i;
+	};
+};
+
+template <>
+struct jc::hash_traits<test::point>
+{
+	template <typename EngineT>
+	static size_t hash(const test::point& _value, uint64_t _seed)
+	{
+		return jc::impl::hash_sequence<EngineT>(_seed, _seed, _value.x, _value.y);
+	};
+};
+
+template <>
+struct jc::hash_traits<test::padded>
+{
+	template <typename EngineT>
+	static size_t hash(const test::padded& _value, uint64_t _seed)
+	{
+		return jc::impl::hash_sequence<EngineT>(_seed, _seed, _value.c, _value.i);
+	};
+};
+
+// Non-hashable type used to check SFINAE on the structural overloads
+struct not_hashable {};
+
+template <typename T, typename = void>
+struct is_hashable : jc::false_type {};
+template <typename T>
+struct is_hashable<T, decltype(void(jc::hash(std::declval<const T&>())))> : jc::true_type {};
+
+
+
+int subtest_combine()
+{
+	NEWTEST();
+
+	const auto _base = jc::hash(std::string{ "base" });
+	const auto _ab = jc::hash_combine(_base, 1, 2);
+	const auto _ba = jc::hash_combine(_base, 2, 1);
+	ASSERT(_ab == jc::hash_combine(_base, 1, 2), "hash_combine is not deterministic");
+	ASSERT(_ab != _ba, "hash_combine should depend on order");
+	ASSERT(jc::hash_combine(jc::hash_combine(_base, 1), 2) == _ab, "hash_combine should fold values one at a time");
+	ASSERT(jc::hash_combine(_base, 1) != jc::hash_combine(_base + 1, 1), "hash_combine ignored the seed hash");
+	ASSERT(jc::hash_combine(_base, std::string{ "a" }, 1) != jc::hash_combine(_base, std::string{ "b" }, 1),
+		"hash_combine ignored a value");
+	ASSERT(jc::hash_combine(_base) == _base, "hash_combine with no values should return the seed hash");
+
+	PASS();
+};
+
+int subtest_tuples()
+{
+	NEWTEST();
+
+	const auto _pair = std::make_pair(1, std::string{ "one" });
+	const auto _tuple = std::make_tuple(1, std::string{ "one" });
+	ASSERT(jc::hash(_pair) == jc::hash(std::make_pair(1, std::string{ "one" })), "pair hash is not deterministic");
+	ASSERT(jc::hash(_pair) == jc::hash(_tuple), "pair and tuple of the same values should hash the same");
+	ASSERT(jc::hash(std::make_pair(1, 2)) != jc::hash(std::make_pair(2, 1)), "pair hash should depend on order");
+	ASSERT(jc::hash(std::make_tuple(1, 2, 3)) != jc::hash(std::make_tuple(1, 2, 4)), "tuple hash ignored an element");
+	ASSERT(jc::hash(std::make_tuple()) == jc::hash(std::tuple<>{}), "empty tuple hash is not deterministic");
+
+	// Nested structures hash through their members
+	const auto _nested = std::make_tuple(std::make_pair(1, 2), test::point{ 3, 4 });
+	ASSERT(jc::hash(_nested) == jc::hash(std::make_tuple(std::make_pair(1, 2), test::point{ 3, 4 })),
+		"nested tuple hash is not deterministic");
+	ASSERT(jc::hash(_nested) != jc::hash(std::make_tuple(std::make_pair(1, 2), test::point{ 4, 3 })),
+		"nested tuple hash ignored a member");
+
+	// Argument packs hash the same as a tuple of the values
+	int _value = 5;
+	ASSERT(jc::hash(jc::pack(1, _value, std::string{ "x" })) == jc::hash(std::make_tuple(1, 5, std::string{ "x" })),
+		"argpack should hash the same as a tuple");
+
+	// Seeds change the result
+	const jc::seeded_hash_t _seeded{ 1234 };
+	ASSERT(_seeded(_pair) != jc::hash(_pair), "seed ignored for pair hash");
+	ASSERT(_seeded(_pair) == jc::seeded_hash_t{ 1234 }(_pair), "seeded pair hash is not deterministic");
+
+	// Non-hashable members make the structure non-hashable
+	ASSERT((is_hashable<std::pair<int, int>>::value), "pair of int should be hashable");
+	ASSERT((!is_hashable<std::pair<int, not_hashable>>::value), "pair with a non-hashable member should not be hashable");
+	ASSERT((!is_hashable<std::tuple<int, not_hashable>>::value), "tuple with a non-hashable member should not be hashable");
+
+	PASS();
+};
+
+int subtest_span()
+{
+	NEWTEST();
+
+	std::vector<int> _ints{ 1, 2, 3, 4, 5, 6, 7, 8 };
+	const auto _full = jc::span<int>{ _ints.data(), _ints.size() };
+	const auto _const = jc::span<const int>{ _ints.data(), _ints.size() };
+
+	ASSERT(jc::hash(_full) == jc::hash(_const), "span constness should not change the hash");
+	ASSERT(jc::hash(_full) == jc::hash_bytes(_ints.data(), _ints.size() * sizeof(int)), "span of int should hash its bytes");
+	ASSERT(jc::hash(_full) != jc::hash(jc::span<int>{ _ints.data(), _ints.size() - 1 }), "span hash ignored its size");
+
+	// Element-wise path
+	std::vector<std::string> _strings{ "a", "b", "c" };
+	const auto _hs = jc::hash(jc::span<std::string>{ _strings.data(), _strings.size() });
+	ASSERT(_hs == jc::hash(jc::span<const std::string>{ _strings.data(), _strings.size() }), "string span hash mismatch");
+	_strings[1] = "d";
+	ASSERT(_hs != jc::hash(jc::span<std::string>{ _strings.data(), _strings.size() }), "string span hash ignored an element");
+
+	// Padded types compare equal with different padding bytes, make sure they hash the same
+	test::padded _lhs[2]{};
+	test::padded _rhs[2]{};
+	std::memset(&_lhs, 0x00, sizeof(_lhs));
+	std::memset(&_rhs, 0xFF, sizeof(_rhs));
+	for (size_t n = 0; n != 2; ++n)
+	{
+		_lhs[n].c = _rhs[n].c = static_cast<char>('a' + n);
+		_lhs[n].i = _rhs[n].i = static_cast<int>(n);
+	};
+	ASSERT(jc::hash(jc::span<test::padded>{ _lhs, 2 }) == jc::hash(jc::span<test::padded>{ _rhs, 2 }),
+		"padding bytes changed the span hash");
+
+	PASS();
+};
+
+int subtest_optional()
+{
+	NEWTEST();
+
+	const jc::optional<int> _empty{};
+	const jc::optional<int> _one{ 1 };
+	ASSERT(jc::hash(_one) == jc::hash(jc::optional<int>{ 1 }), "optional hash is not deterministic");
+	ASSERT(jc::hash(_empty) == jc::hash(jc::optional<int>{}), "empty optionals should hash the same");
+	ASSERT(jc::hash(_empty) != jc::hash(_one), "empty and engaged optionals should hash differently");
+	ASSERT(jc::hash(_one) != jc::hash(jc::optional<int>{ 2 }), "optional hash ignored its value");
+
+	const jc::maybe<int, std::string> _value{ 1 };
+	const jc::maybe<int, std::string> _alternate{ std::string{ "1" } };
+	ASSERT(jc::hash(_value) == jc::hash(jc::maybe<int, std::string>{ 1 }), "maybe hash is not deterministic");
+	ASSERT(jc::hash(_value) != jc::hash(_alternate), "maybe hash should depend on the active member");
+	ASSERT(jc::hash(jc::maybe<int, int>{ 1 }) != jc::hash(jc::maybe<int, int>{ jc::alternate, 1 }),
+		"maybe hash should depend on the active member");
+
+	ASSERT((!is_hashable<jc::optional<not_hashable>>::value), "optional of a non-hashable type should not be hashable");
+
+	PASS();
+};
+
+
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_combine);
+	SUBTEST(subtest_tuples);
+	SUBTEST(subtest_span);
+	SUBTEST(subtest_optional);
+	PASS();
+};
@@ -8,6 +8,10 @@
 #include <string>
 #include <functional>
 #include <array>
+#include <list>
+#include <algorithm>
+#include <iterator>
+#include <tuple>
 
 #include <iostream>
 
@@ -246,6 +250,204 @@ constexpr auto double_val(int i)
 	return i * 2;
 };
 
+// Record with a key member, used to check transforms returning references
+struct keyed
+{
+	int key;
+	int index;
+};
+
+// Views over random access ranges must keep random access and constant time sizes
+int test_random_access_views()
+{
+	NEWTEST();
+
+	std::vector<keyed> _records{ { 5, 0 }, { 3, 1 }, { 9, 2 }, { 1, 3 }, { 7, 4 } };
+	const auto _key = [](keyed& _record) -> int& { return _record.key; };
+
+	auto _keys = _records | jc::views::transform(_key);
+	using iterator = jc::ranges::iterator_t<decltype(_keys)>;
+	static_assert(jc::is_same<typename std::iterator_traits<iterator>::iterator_category, std::random_access_iterator_tag>::value,
+		"transform view over a vector must be random access");
+	static_assert(jc::ranges::is_contiguous_range<decltype(_keys)>::value, "transform view over a vector must be splittable");
+
+	ASSERT(_keys.size() == 5, "transform view size mismatch");
+	ASSERT(_keys.end() - _keys.begin() == 5 && _keys.begin()[2] == 9 && *(_keys.begin() + 4) == 7, "transform view random access failed");
+	ASSERT(*(_keys.end() - 1) == 7 && _keys.begin() < _keys.end(), "transform view iterator arithmetic failed");
+
+	// Transforms returning references point at the element instead of a copy
+	ASSERT(&*_keys.begin().operator->() == &_records[0].key, "transform view operator-> did not point to the element");
+
+	// Sorting through the view only reorders the keys
+	std::sort(_keys.begin(), _keys.end());
+	ASSERT(_records[0].key == 1 && _records[4].key == 9 && _records[0].index == 0, "sort through transform view failed");
+
+	// Transforms returning values can still be used with operator->
+	const std::vector<std::string> _strings{ "a", "bb", "ccc" };
+	auto _doubled = _strings | jc::views::transform([](const std::string& v) { return v + v; });
+	ASSERT(_doubled.begin()->size() == 2 && (--_doubled.end())->size() == 6, "transform view operator-> by value failed");
+
+	// Copies of the view use their own transform
+	const auto _copy = _doubled;
+	ASSERT(*_copy.begin() == "aa", "copied transform view failed");
+
+	// Drop and all keep random access, drop clamps to the end of the range
+	const std::vector<int> _ints{ 1, 2, 3, 4, 5, 6 };
+	auto _dropped = _ints | jc::views::all | jc::views::drop(2);
+	static_assert(jc::ranges::is_contiguous_range<decltype(_dropped)>::value, "drop view over a vector must be splittable");
+	ASSERT(_dropped.size() == 4 && *_dropped.begin() == 3, "drop view over all view failed");
+	ASSERT((_ints | jc::views::drop(10)).size() == 0, "drop view did not clamp to the end");
+
+	auto _chained = _ints | jc::views::drop(1) | jc::views::transform(&double_val);
+	ASSERT(_chained.size() == 5 && _chained.begin()[4] == 12, "transform view over drop view failed");
+
+	// Bidirectional ranges stay bidirectional
+	const std::list<int> _list{ 1, 2, 3 };
+	auto _listView = _list | jc::views::transform(&double_val);
+	static_assert(jc::is_same<typename std::iterator_traits<jc::ranges::iterator_t<decltype(_listView)>>::iterator_category, std::bidirectional_iterator_tag>::value,
+		"transform view over a list must be bidirectional");
+	ASSERT(*--_listView.end() == 6 && (_list | jc::views::drop(5)).size() == 0, "views over a list failed");
+
+	PASS();
+};
+
+// Views which reshape a range must keep random access and sizes where the base range has them
+int test_reshaping_views()
+{
+	NEWTEST();
+
+	const std::vector<int> _ints{ 1, 2, 3, 4, 5, 6, 7 };
+	const std::list<int> _list(_ints.begin(), _ints.end());
+
+	// Take uses the range's own iterators so contiguity is kept
+	auto _taken = _ints | jc::views::take(3);
+	static_assert(jc::is_same<jc::ranges::iterator_t<decltype(_taken)>, std::vector<int>::const_iterator>::value,
+		"take view over a vector must use the vector's iterators");
+	ASSERT(_taken.size() == 3 && *(_taken.end() - 1) == 3, "take view failed");
+	ASSERT((_ints | jc::views::take(20)).size() == 7 && (_list | jc::views::take(2)).size() == 2, "take view did not clamp to the end");
+	ASSERT((_ints | jc::views::drop(2) | jc::views::take(2)).begin()[1] == 4, "take view over drop view failed");
+
+	// Stride visits every nth element
+	auto _strided = _ints | jc::views::stride(3);
+	static_assert(jc::is_same<typename std::iterator_traits<jc::ranges::iterator_t<decltype(_strided)>>::iterator_category, std::random_access_iterator_tag>::value,
+		"stride view over a vector must be random access");
+	ASSERT(_strided.size() == 3 && _strided.begin()[2] == 7 && *(_strided.end() - 1) == 7 && *--_strided.end() == 7, "stride view failed");
+	ASSERT((std::vector<int>((_list | jc::views::stride(2)).begin(), (_list | jc::views::stride(2)).end()) == std::vector<int>{ 1, 3, 5, 7 }),
+		"stride view over a list failed");
+
+	// Chunk splits into consecutive subranges, the last one being shorter
+	auto _chunks = _ints | jc::views::chunk(3);
+	ASSERT(_chunks.size() == 3 && _chunks.begin()[1].size() == 3 && *_chunks.begin()[1].begin() == 4, "chunk view failed");
+	ASSERT((*(_chunks.end() - 1)).size() == 1 && *(*(_chunks.end() - 1)).begin() == 7, "chunk view last chunk failed");
+	int _chunkTotal = 0;
+	for (auto _chunk : _list | jc::views::chunk(2))
+	{
+		for (auto v : _chunk)
+		{
+			_chunkTotal += v;
+		};
+	};
+	ASSERT(_chunkTotal == 28, "chunk view over a list failed");
+
+	// Slide visits every window
+	auto _windows = _ints | jc::views::slide(3);
+	ASSERT(_windows.size() == 5 && *_windows.begin()[4].begin() == 5 && (*(_windows.end() - 1)).size() == 3, "slide view failed");
+	ASSERT((_ints | jc::views::slide(8)).size() == 0 && (_ints | jc::views::slide(7)).size() == 1, "slide view with a large window failed");
+	ASSERT((_list | jc::views::slide(2)).size() == 6, "slide view over a list failed");
+
+	// Enumerate pairs elements with their index
+	std::vector<int> _mutable{ 4, 5, 6 };
+	for (auto _pair : _mutable | jc::views::enumerate)
+	{
+		_pair.second += static_cast<int>(_pair.first);
+	};
+	ASSERT((_mutable == std::vector<int>{ 4, 6, 8 }), "enumerate view did not reference the elements");
+	auto _enumerated = jc::views::enumerate(_ints);
+	ASSERT(_enumerated.size() == 7 && _enumerated.begin()[6].first == 6 && (_enumerated.end() - 1).index() == 6, "enumerate view failed");
+
+	// Enumerating a filter view only searches for the first passing element, the rest of the range isn't walked
+	int _filterCalls = 0;
+	const auto _countedEven = [&_filterCalls](int v) { ++_filterCalls; return is_even(v); };
+	auto _evenInts = _ints | jc::views::filter(_countedEven);
+	auto _enumeratedEvens = _evenInts | jc::views::enumerate;
+	ASSERT(_filterCalls == 2, "enumerate view walked the range when it was made");
+	ASSERT((*_enumeratedEvens.begin()).first == 0 && (*++_enumeratedEvens.begin()).second == 4 && _enumeratedEvens.size() == 3,
+		"enumerate view over a filter view failed");
+
+	// Zip ends with the shortest range
+	const std::vector<std::string> _names{ "a", "b", "c" };
+	auto _zipped = jc::views::zip(_ints, _names);
+	static_assert(jc::is_same<typename std::iterator_traits<jc::ranges::iterator_t<decltype(_zipped)>>::iterator_category, std::random_access_iterator_tag>::value,
+		"zip view over vectors must be random access");
+	ASSERT(_zipped.size() == 3 && std::get<1>(_zipped.begin()[2]) == "c" && std::get<0>(*(_zipped.end() - 1)) == 3, "zip view failed");
+	auto _zippedList = jc::views::zip(_list, _names, _ints);
+	ASSERT(_zippedList.size() == 3 && std::get<0>(*++_zippedList.begin()) == 2, "zip view over a list failed");
+
+	PASS();
+};
+
+// Join flattens ranges of ranges, skipping empty ones
+int test_join()
+{
+	NEWTEST();
+
+	std::vector<std::vector<int>> _nested{ {}, { 1, 2 }, {}, { 3 }, {} };
+	auto _joined = _nested | jc::views::join;
+	ASSERT((std::vector<int>(_joined.begin(), _joined.end()) == std::vector<int>{ 1, 2, 3 }), "join view failed");
+	ASSERT(_joined.size() == 3, "join view size mismatch");
+
+	for (auto& v : jc::views::join(_nested))
+	{
+		v *= 10;
+	};
+	ASSERT(_nested[1][1] == 20 && _nested[3][0] == 30, "join view did not reference the elements");
+
+	const std::vector<std::vector<int>> _empty{ {}, {} };
+	ASSERT((_empty | jc::views::join).begin() == (_empty | jc::views::join).end(), "join of empty ranges must be empty");
+
+	// Inner ranges given by value must be views, such as the subranges from chunk
+	const std::list<int> _list{ 1, 2, 3, 4, 5 };
+	auto _rejoined = _list | jc::views::chunk(2) | jc::views::join;
+	ASSERT((std::vector<int>(_rejoined.begin(), _rejoined.end()) == std::vector<int>{ 1, 2, 3, 4, 5 }), "join of chunk view failed");
+
+	PASS();
+};
+
+// Collecting ranges into containers
+int test_to()
+{
+	NEWTEST();
+
+	const std::vector<int> _ints{ 1, 2, 3, 4, 5, 6 };
+
+	// Sized ranges reserve exactly once
+	const auto _doubled = _ints | jc::views::transform(&double_val) | jc::ranges::to<std::vector>();
+	static_assert(jc::is_same<decltype(_doubled), const std::vector<int>>::value, "to<std::vector> deduced the wrong element type");
+	ASSERT((_doubled == std::vector<int>{ 2, 4, 6, 8, 10, 12 }) && _doubled.capacity() == _doubled.size(), "to over a sized view failed");
+
+	const auto _fromList = jc::ranges::to<std::vector<long>>(std::list<int>{ 1, 2, 3 });
+	ASSERT(_fromList.size() == 3 && _fromList.capacity() == 3 && _fromList[2] == 3, "to over a list failed");
+
+	// Contiguous trivially copyable ranges are copied in one go
+	static_assert(jc::ranges::impl::is_bulk_copyable<std::vector<int>, const std::vector<int>>::value, "vector of int must be bulk copyable");
+	static_assert(!jc::ranges::impl::is_bulk_copyable<std::vector<long>, const std::vector<int>>::value, "converting copies can't be bulk copies");
+	const auto _copy = _ints | jc::views::all | jc::ranges::to<std::vector<int>>();
+	ASSERT(_copy == _ints, "to over a contiguous range failed");
+
+	// Ranges of unknown size and other containers
+	const auto _evens = _ints | jc::views::filter(&is_even) | jc::ranges::to<std::list<int>>();
+	ASSERT((_evens == std::list<int>{ 2, 4, 6 }), "to over a filter view failed");
+
+	const std::string _letters = jc::ranges::to<std::string>(std::vector<char>{ 'a', 'b' });
+	ASSERT(_letters == "ab", "to std::string failed");
+
+	// Nested ranges are collected into the inner container type
+	const std::vector<std::vector<int>> _chunks = _ints | jc::views::chunk(4) | jc::ranges::to<std::vector<std::vector<int>>>();
+	ASSERT(_chunks.size() == 2 && (_chunks[1] == std::vector<int>{ 5, 6 }), "to over nested ranges failed");
+
+	PASS();
+};
+
 int main()
 {
 	SUBTEST(test_range_type_traits);
@@ -273,6 +475,37 @@ int main()
 		};
 	};
 
+	{
+		NEWTEST();
+
+		// The first passing element is only searched for once
+		std::vector<int> _ivec{ 1, 3, 5, 7, 8, 9, 10 };
+		int _calls = 0;
+		const auto _counted = [&_calls](int v) { ++_calls; return is_even(v); };
+		auto _filterView = _ivec | jc::views::filter(_counted);
+		ASSERT(_calls == 0, "filter view invoked the filter before begin() was called");
+
+		ASSERT(*_filterView.begin() == 8, "filter view begin() found the wrong element");
+		const int _firstCalls = _calls;
+		ASSERT(*_filterView.begin() == 8 && _calls == _firstCalls, "filter view begin() was not cached");
+
+		// Copies share the cached position and use their own copy of the filter
+		const auto _copy = _filterView;
+		int _count = 0;
+		for (auto v : _copy)
+		{
+			ASSERT(is_even(v), "copied filter view failed to filter");
+			++_count;
+		};
+		ASSERT(_count == 2, "copied filter view visited the wrong number of elements");
+
+		// Const views search without caching so concurrent calls don't race
+		const auto _constView = _ivec | jc::views::filter(_counted);
+		_calls = 0;
+		ASSERT(*_constView.begin() == 8 && *_constView.begin() == 8, "const filter view begin() found the wrong element");
+		ASSERT(_calls == 10, "const filter view begin() cached the first element");
+	};
+
 	{
 		NEWTEST();
 
@@ -330,6 +563,10 @@ int main()
 
 	// Run transform view tests
 	SUBTEST(test_transform);
+	SUBTEST(test_random_access_views);
+	SUBTEST(test_reshaping_views);
+	SUBTEST(test_join);
+	SUBTEST(test_to);
 
 	return 0;
 };
\ No newline at end of file
@@ -0,0 +1,2 @@
+# signal test driver
+JCLIB_ADD_TEST("signal" "${CMAKE_CURRENT_LIST_DIR}/signal.cpp")
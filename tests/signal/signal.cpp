@@ -0,0 +1,149 @@
+#include <jclib/signal.h>
+#include <jclib-test.hpp>
+
+#include <memory>
+#include <thread>
+#include <atomic>
+
+
+
+int subtest_connect()
+{
+	NEWTEST();
+
+	jc::signal<void(int)> _signal{};
+	ASSERT(_signal.empty(), "default constructed signal should have no listeners");
+
+	int _a = 0;
+	int _b = 0;
+	const auto _ca = _signal.connect([&_a](int _v) { _a += _v; });
+	const auto _cb = _signal.connect([&_b](int _v) { _b += _v * 2; });
+	ASSERT(_signal.size() == 2, "signal listener count mismatch");
+	ASSERT(_signal.connected(_ca) && _signal.connected(_cb), "listeners should be connected");
+
+	_signal(2);
+	ASSERT(_a == 2 && _b == 4, "signal did not invoke every listener");
+
+	ASSERT(_signal.disconnect(_ca), "disconnect should succeed for a connected listener");
+	ASSERT(!_signal.disconnect(_ca), "disconnect should fail for a disconnected listener");
+	ASSERT(!_signal.connected(_ca), "disconnected listener reported as connected");
+	
+	_signal(1);
+	ASSERT(_a == 2 && _b == 6, "disconnected listener was invoked");
+
+	// Reused slots must not be reachable through stale handles
+	int _c = 0;
+	const auto _cc = _signal.connect([&_c](int _v) { _c += _v; });
+	ASSERT(_cc.index == _ca.index, "disconnected slot was not reused");
+	ASSERT(!_signal.disconnect(_ca), "stale handle disconnected a reused slot");
+	ASSERT(_signal.connected(_cc), "reused slot listener should be connected");
+
+	_signal.clear();
+	ASSERT(_signal.empty(), "clear should disconnect every listener");
+	_signal(1);
+	ASSERT(_c == 0 && _b == 6, "cleared listeners were invoked");
+
+	// Move-only listeners
+	auto _value = std::make_unique<int>(0);
+	int* _valuePtr = _value.get();
+	_signal.connect([v = std::move(_value)](int _v) { *v += _v; });
+	_signal.invoke(jc::nolock, 3);
+	ASSERT(*_valuePtr == 3, "move-only listener was not invoked");
+
+	PASS();
+};
+
+int subtest_reentrant()
+{
+	NEWTEST();
+
+	jc::signal<void()> _signal{};
+
+	// Listener that disconnects itself
+	int _selfCount = 0;
+	jc::signal_connection _self{};
+	_self = _signal.connect([&]() { ++_selfCount; _signal.disconnect(_self); });
+
+	// Listener that connects another listener
+	int _addedCount = 0;
+	int _adderCount = 0;
+	jc::signal_connection _adder{};
+	_adder = _signal.connect([&]()
+	{
+		++_adderCount;
+		_signal.disconnect(_adder);
+		_signal.connect([&]() { ++_addedCount; });
+	});
+
+	// Listener disconnected by an earlier listener
+	int _victimCount = 0;
+	jc::signal_connection _victim{};
+	_signal.connect([&]() { _signal.disconnect(_victim); });
+	_victim = _signal.connect([&]() { ++_victimCount; });
+
+	_signal();
+	ASSERT(_selfCount == 1, "self disconnecting listener was not invoked once");
+	ASSERT(_adderCount == 1, "connecting listener was not invoked once");
+	ASSERT(_addedCount == 0, "listener connected during invocation should not be invoked by it");
+	ASSERT(_victimCount == 0, "listener disconnected during invocation was invoked");
+	ASSERT(!_signal.connected(_self) && !_signal.connected(_victim), "listeners should be disconnected");
+
+	_signal();
+	ASSERT(_selfCount == 1 && _adderCount == 1, "disconnected listeners were invoked");
+	ASSERT(_addedCount == 1, "listener connected during invocation was not invoked afterwards");
+
+	// Nested invocation
+	int _depth = 0;
+	int _nestedCount = 0;
+	jc::signal<void(int)> _nested{};
+	_nested.connect([&](int _n)
+	{
+		++_nestedCount;
+		if (_n != 0)
+		{
+			++_depth;
+			_nested(_n - 1);
+		};
+	});
+	_nested(3);
+	ASSERT(_depth == 3 && _nestedCount == 4, "nested invocation failed");
+
+	PASS();
+};
+
+int subtest_threaded()
+{
+	NEWTEST();
+
+	jc::signal<void(int)> _signal{};
+	std::atomic<int> _total{ 0 };
+
+	std::thread _connector([&]()
+	{
+		for (int n = 0; n != 100; ++n)
+		{
+			const auto _connection = _signal.connect([&](int _v) { _total += _v; });
+			_signal.disconnect(_connection);
+		};
+	});
+	for (int n = 0; n != 100; ++n)
+	{
+		_signal(1);
+	};
+	_connector.join();
+
+	ASSERT(_signal.empty(), "every listener should have been disconnected");
+
+	PASS();
+};
+
+
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_connect);
+	SUBTEST(subtest_reentrant);
+	SUBTEST(subtest_threaded);
+	PASS();
+};
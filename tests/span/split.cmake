@@ -0,0 +1,2 @@
+# split view test driver
+JCLIB_ADD_TEST("span-split" "${CMAKE_CURRENT_LIST_DIR}/split.cpp")
@@ -0,0 +1,107 @@
+#include <jclib/span.h>
+#include <jclib/ranges.h>
+#include <jclib-test.hpp>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+// Collects the subranges of a split view as strings
+template <typename ViewT>
+std::vector<std::string> collect(const ViewT& _view)
+{
+	std::vector<std::string> _out{};
+	for (auto _field : _view)
+	{
+		_out.emplace_back(_field.begin(), _field.end());
+	};
+	return _out;
+};
+
+// Splitting on a single element, which is searched with memchr for characters
+int subtest_element()
+{
+	NEWTEST();
+
+	const std::string _text = "a,bb,,ccc,";
+	auto _fields = _text | jc::views::split(',');
+	static_assert(jc::is_same<decltype(*_fields.begin()), jc::span<const char>>::value, "split of a const string must give const char spans");
+	ASSERT((collect(_fields) == std::vector<std::string>{ "a", "bb", "", "ccc", "" }), "split on an element failed");
+	ASSERT(_fields.size() == 5, "split view size mismatch");
+
+	// Fields point into the original buffer
+	ASSERT((*_fields.begin()).data() == _text.data() && (*++_fields.begin()).data() == _text.data() + 2, "split view copied the elements");
+
+	ASSERT((collect(std::string("abc") | jc::views::split(',')) == std::vector<std::string>{ "abc" }), "split without delimiters failed");
+	ASSERT((collect(std::string(",") | jc::views::split(',')) == std::vector<std::string>{ "", "" }), "split of a lone delimiter failed");
+	ASSERT(collect(std::string() | jc::views::split(',')).empty(), "split of an empty range must have no subranges");
+
+	// Elements which aren't bytes
+	const std::vector<int> _ints{ 1, 2, 0, 3, 0, 0, 4 };
+	auto _groups = jc::views::split(_ints, 0);
+	ASSERT(_groups.size() == 4 && (*_groups.begin()).size() == 2 && (*_groups.begin())[1] == 2, "split of integers failed");
+
+	// Writable ranges give writable spans
+	std::string _mutable = "ab cd";
+	for (auto _word : _mutable | jc::views::split(' '))
+	{
+		_word[0] = 'X';
+	};
+	ASSERT(_mutable == "Xb Xd", "split view of a writable range was not writable");
+
+	PASS();
+};
+
+// Splitting on a sequence of elements
+int subtest_pattern()
+{
+	NEWTEST();
+
+	const std::string _text = "key: value:: other::";
+	ASSERT((collect(_text | jc::views::split(std::string("::"))) == std::vector<std::string>{ "key: value", " other", "" }), "split on a pattern failed");
+	ASSERT((collect(_text | jc::views::split(std::string(": "))) == std::vector<std::string>{ "key", "value:", "other::" }), "split on a pattern failed");
+	ASSERT((collect(std::string("aaa") | jc::views::split(std::string("aa"))) == std::vector<std::string>{ "", "a" }), "split on overlapping pattern failed");
+	ASSERT((collect(std::string("a") | jc::views::split(std::string("abc"))) == std::vector<std::string>{ "a" }), "split on a pattern longer than the range failed");
+
+	// String literals don't include their null terminator in the pattern
+	ASSERT((collect(_text | jc::views::split("::")) == std::vector<std::string>{ "key: value", " other", "" }), "split on a string literal failed");
+	ASSERT((collect(jc::views::split(_text, ":")) == std::vector<std::string>{ "key", " value", "", " other", "", "" }), "split on a single character string literal failed");
+
+	PASS();
+};
+
+// Records and fields, joined back together
+int subtest_nested()
+{
+	NEWTEST();
+
+	const std::string _text = "1,2\n3\n\n4,5,6";
+	size_t _fieldCount = 0;
+	for (auto _record : _text | jc::views::split('\n'))
+	{
+		for (auto _field : _record | jc::views::split(','))
+		{
+			_fieldCount += _field.size();
+		};
+	};
+	ASSERT(_fieldCount == 6, "nested split failed");
+
+	auto _records = _text | jc::views::split('\n');
+	const auto _joined = _records | jc::views::join;
+	ASSERT(std::string(_joined.begin(), _joined.end()) == "1,234,5,6", "join of split view failed");
+
+	// Materializing copies each subrange into its own string
+	const auto _lines = _text | jc::views::split('\n') | jc::ranges::to<std::vector<std::string>>();
+	ASSERT((_lines == std::vector<std::string>{ "1,2", "3", "", "4,5,6" }), "collecting split view into strings failed");
+
+	PASS();
+};
+
+int main()
+{
+	NEWTEST();
+	SUBTEST(subtest_element);
+	SUBTEST(subtest_pattern);
+	SUBTEST(subtest_nested);
+	PASS();
+};